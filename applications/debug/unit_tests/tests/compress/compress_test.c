@@ -1,6 +1,7 @@
 #include "../test.h" // IWYU pragma: keep
 
 #include <toolbox/compress.h>
+#include <toolbox/frame_delta.h>
 #include <toolbox/md5_calc.h>
 #include <toolbox/tar/tar_archive.h>
 #include <toolbox/dir_walk.h>
@@ -338,9 +339,147 @@ static void compress_test_heatshrink_tar() {
     furi_record_close(RECORD_STORAGE);
 }
 
+#define COMPRESS_ICON_TEST_SIZE (512u)
+
+static size_t compress_test_icon_encode(Compress* comp, uint8_t salt, uint8_t* output) {
+    uint8_t* frame = malloc(COMPRESS_ICON_TEST_SIZE);
+    for(size_t i = 0; i < COMPRESS_ICON_TEST_SIZE; i++) {
+        frame[i] = (i / 8) ^ salt;
+    }
+
+    size_t encoded_size = 0;
+    furi_check(compress_encode(
+        comp, frame, COMPRESS_ICON_TEST_SIZE, output, COMPRESS_ICON_TEST_SIZE, &encoded_size));
+    // Frame must be compressible, otherwise cache is bypassed
+    furi_check(output[0] == 0x01);
+
+    free(frame);
+    return encoded_size;
+}
+
+static bool compress_test_icon_check(const uint8_t* data, uint8_t salt) {
+    for(size_t i = 0; i < COMPRESS_ICON_TEST_SIZE; i++) {
+        if(data[i] != (uint8_t)((i / 8) ^ salt)) return false;
+    }
+    return true;
+}
+
+static void compress_test_icon_cache() {
+    Compress* comp = compress_alloc(CompressTypeHeatshrink, &compress_config_heatshrink_default);
+    uint8_t* icon_a = malloc(COMPRESS_ICON_TEST_SIZE);
+    uint8_t* icon_b = malloc(COMPRESS_ICON_TEST_SIZE);
+    uint8_t* icon_c = malloc(COMPRESS_ICON_TEST_SIZE);
+    compress_test_icon_encode(comp, 0x00, icon_a);
+    compress_test_icon_encode(comp, 0x55, icon_b);
+    compress_test_icon_encode(comp, 0xAA, icon_c);
+
+    // Budget fits two decoded frames
+    CompressIcon* compress_icon =
+        compress_icon_alloc_cached(COMPRESS_ICON_TEST_SIZE, (COMPRESS_ICON_TEST_SIZE + 64) * 2);
+    CompressIconCacheStats stats;
+    uint8_t* output = NULL;
+
+    compress_icon_decode_cached(compress_icon, icon_a, &output);
+    mu_assert(compress_test_icon_check(output, 0x00), "Decoded frame A mismatch");
+    compress_icon_decode_cached(compress_icon, icon_a, &output);
+    mu_assert(compress_test_icon_check(output, 0x00), "Cached frame A mismatch");
+    compress_icon_get_cache_stats(compress_icon, &stats);
+    mu_assert_int_eq(1, stats.hits);
+    mu_assert_int_eq(1, stats.misses);
+
+    // Uncached decode bypasses cache
+    compress_icon_decode(compress_icon, icon_b, &output);
+    mu_assert(compress_test_icon_check(output, 0x55), "Decoded frame B mismatch");
+    compress_icon_get_cache_stats(compress_icon, &stats);
+    mu_assert_int_eq(1, stats.hits);
+    mu_assert_int_eq(1, stats.misses);
+
+    // A is used after B, so B is the least recently used one when C arrives
+    compress_icon_decode_cached(compress_icon, icon_b, &output);
+    compress_icon_decode_cached(compress_icon, icon_a, &output);
+    compress_icon_decode_cached(compress_icon, icon_c, &output);
+    mu_assert(compress_test_icon_check(output, 0xAA), "Decoded frame C mismatch");
+    compress_icon_get_cache_stats(compress_icon, &stats);
+    mu_assert_int_eq(2, stats.hits);
+    mu_assert_int_eq(3, stats.misses);
+    mu_assert_int_eq(1, stats.evictions);
+    mu_assert(stats.size <= stats.size_max, "Cache budget exceeded");
+
+    compress_icon_decode_cached(compress_icon, icon_a, &output);
+    mu_assert(compress_test_icon_check(output, 0x00), "Cached frame A mismatch");
+    compress_icon_decode_cached(compress_icon, icon_b, &output);
+    mu_assert(compress_test_icon_check(output, 0x55), "Decoded frame B mismatch");
+    compress_icon_get_cache_stats(compress_icon, &stats);
+    mu_assert_int_eq(3, stats.hits);
+    mu_assert_int_eq(4, stats.misses);
+    mu_assert_int_eq(2, stats.evictions);
+
+    compress_icon_free(compress_icon);
+    free(icon_c);
+    free(icon_b);
+    free(icon_a);
+    compress_free(comp);
+}
+
+#define FRAME_DELTA_TEST_SIZE (1024u)
+
+static void compress_test_frame_delta() {
+    // Reference encoding, produced by scripts/flipper/utils/framedelta.py
+    static const uint8_t frame[16] = {[3] = 0xFF, [4] = 0x0F, [12] = 0x01};
+    static const uint8_t expected[] = {
+        0xFD, 0x01, 0x07, 0x00, 0x82, 0x01, 0xFF, 0x0F, 0x86, 0x00, 0x01};
+    static const uint8_t empty[16] = {0};
+
+    uint8_t encoded[32];
+    size_t encoded_size = frame_delta_encode(frame, empty, sizeof(frame), 7, encoded);
+    mu_assert_int_eq(sizeof(expected), encoded_size);
+    mu_assert_mem_eq(expected, encoded, sizeof(expected));
+
+    // Round trip over a sequence of partially changed frames
+    uint8_t* source = malloc(FRAME_DELTA_TEST_SIZE);
+    uint8_t* reference = malloc(FRAME_DELTA_TEST_SIZE);
+    uint8_t* decoded = malloc(FRAME_DELTA_TEST_SIZE);
+    uint8_t* output = malloc(frame_delta_get_max_size(FRAME_DELTA_TEST_SIZE));
+
+    bool match = true;
+    for(uint16_t sequence = 0; sequence < 64; sequence++) {
+        const size_t changes = (sequence % 8) * (sequence % 8) * 16;
+        for(size_t i = 0; i < changes; i++) {
+            source[rand() % FRAME_DELTA_TEST_SIZE] = (rand() % 2) ? rand() : 0;
+        }
+
+        const bool key_frame = (sequence % 16) == 0;
+        encoded_size = frame_delta_encode(
+            source, key_frame ? NULL : reference, FRAME_DELTA_TEST_SIZE, sequence, output);
+        furi_check(encoded_size <= frame_delta_get_max_size(FRAME_DELTA_TEST_SIZE));
+        memcpy(reference, source, FRAME_DELTA_TEST_SIZE);
+
+        uint16_t decoded_sequence = 0;
+        furi_check(frame_delta_decode(
+            output, encoded_size, decoded, FRAME_DELTA_TEST_SIZE, &decoded_sequence));
+        if(decoded_sequence != sequence) match = false;
+        if(memcmp(decoded, source, FRAME_DELTA_TEST_SIZE) != 0) match = false;
+    }
+    mu_assert(match, "Decoded frame mismatch");
+
+    // Malformed data is rejected
+    output[FRAME_DELTA_HEADER_SIZE] = 0x7F;
+    mu_assert(
+        !frame_delta_decode(
+            output, FRAME_DELTA_HEADER_SIZE + 1, decoded, FRAME_DELTA_TEST_SIZE, NULL),
+        "Truncated frame accepted");
+
+    free(output);
+    free(decoded);
+    free(reference);
+    free(source);
+}
+
 MU_TEST_SUITE(test_compress) {
     MU_RUN_TEST(compress_test_random_comp_decomp);
     MU_RUN_TEST(compress_test_reference_comp_decomp);
+    MU_RUN_TEST(compress_test_icon_cache);
+    MU_RUN_TEST(compress_test_frame_delta);
     MU_RUN_TEST(compress_test_heatshrink_stream);
     MU_RUN_TEST(compress_test_heatshrink_tar);
 }
@@ -0,0 +1,101 @@
+#include <furi.h>
+#include <furi_hal.h>
+#include "../test.h" // IWYU pragma: keep
+#include <toolbox/crc.h>
+
+#define TEST_BUFFER_SIZE   (2048)
+#define TEST_SOFTWARE_STEP (32)
+#define TEST_ROUNDS        (64)
+
+static const uint8_t test_check_input[] = {'1', '2', '3', '4', '5', '6', '7', '8', '9'};
+
+static uint32_t test_crc_check(CrcEngine engine, uint32_t init) {
+    return crc_update(engine, init, test_check_input, sizeof(test_check_input));
+}
+
+// Bitwise CRC-16 CCITT, LSB first, as in the original ISO13239 implementation
+static uint16_t test_crc16_reflected_reference(uint16_t crc, const uint8_t* data, size_t size) {
+    for(size_t i = 0; i < size; i++) {
+        crc ^= data[i];
+        for(size_t bit = 0; bit < 8; bit++) {
+            crc = (crc & 1U) ? (crc >> 1) ^ 0x8408U : crc >> 1;
+        }
+    }
+    return crc;
+}
+
+// Updates in chunks smaller than hardware threshold stay in software
+static uint32_t test_crc32_software(uint32_t crc, const uint8_t* data, size_t size) {
+    for(size_t offset = 0; offset < size; offset += TEST_SOFTWARE_STEP) {
+        const size_t chunk = MIN((size_t)TEST_SOFTWARE_STEP, size - offset);
+        crc = crc_update(CrcEngine32Poly04C11DB7Reflected, crc, data + offset, chunk);
+    }
+    return crc;
+}
+
+MU_TEST(test_crc_catalogue) {
+    mu_assert_int_eq(0xF7, test_crc_check(CrcEngine8Poly31, 0xFF));
+    mu_assert_int_eq(0x4B, test_crc_check(CrcEngine8Poly1D, 0xFF) ^ 0xFF);
+    mu_assert_int_eq(0x31C3, test_crc_check(CrcEngine16Poly1021, 0x0000));
+    mu_assert_int_eq(0xBF05, test_crc_check(CrcEngine16Poly1021Reflected, 0x6363));
+    mu_assert_int_eq(0x906E, test_crc_check(CrcEngine16Poly1021Reflected, 0xFFFF) ^ 0xFFFF);
+    mu_assert_int_eq(0xCBF43926, ~test_crc_check(CrcEngine32Poly04C11DB7Reflected, ~0U));
+}
+
+MU_TEST(test_crc_sliced) {
+    uint8_t* buffer = malloc(TEST_BUFFER_SIZE);
+    furi_hal_random_fill_buf(buffer, TEST_BUFFER_SIZE);
+
+    for(size_t round = 0; round < TEST_ROUNDS; round++) {
+        const size_t offset = furi_hal_random_get() % 4;
+        const size_t size = furi_hal_random_get() % 256;
+        const uint16_t init = furi_hal_random_get();
+
+        mu_assert_int_eq(
+            test_crc16_reflected_reference(init, buffer + offset, size),
+            crc_update(CrcEngine16Poly1021Reflected, init, buffer + offset, size));
+    }
+
+    free(buffer);
+}
+
+MU_TEST(test_crc_hardware) {
+    uint8_t* buffer = malloc(TEST_BUFFER_SIZE);
+    furi_hal_random_fill_buf(buffer, TEST_BUFFER_SIZE);
+
+    for(size_t round = 0; round < TEST_ROUNDS; round++) {
+        const size_t offset = furi_hal_random_get() % 4;
+        const size_t size = furi_hal_random_get() % (TEST_BUFFER_SIZE - offset);
+        const uint32_t init = furi_hal_random_get();
+
+        const uint32_t expected = test_crc32_software(init, buffer + offset, size);
+
+        mu_assert(furi_hal_crc_acquire(FuriWaitForever), "CRC unit is not available");
+        const uint32_t actual = furi_hal_crc_crc32(init, buffer + offset, size);
+
+        // Library must fall back to software while the unit is busy
+        const uint32_t fallback =
+            crc_update(CrcEngine32Poly04C11DB7Reflected, init, buffer + offset, size);
+        furi_hal_crc_release();
+
+        mu_assert_int_eq(expected, actual);
+        mu_assert_int_eq(expected, fallback);
+        mu_assert_int_eq(
+            expected, crc_update(CrcEngine32Poly04C11DB7Reflected, init, buffer + offset, size));
+    }
+
+    free(buffer);
+}
+
+MU_TEST_SUITE(test_crc_suite) {
+    MU_RUN_TEST(test_crc_catalogue);
+    MU_RUN_TEST(test_crc_sliced);
+    MU_RUN_TEST(test_crc_hardware);
+}
+
+int run_minunit_test_crc(void) {
+    MU_RUN_SUITE(test_crc_suite);
+    return MU_EXIT_CODE;
+}
+
+TEST_API_DEFINE(run_minunit_test_crc)
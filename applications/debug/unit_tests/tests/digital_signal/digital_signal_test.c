@@ -0,0 +1,371 @@
+#include "../test.h" // IWYU pragma: keep
+
+#include <furi.h>
+#include <furi_hal.h>
+
+#include <digital_signal/digital_sequence.h>
+#include <digital_signal/digital_sequence_cache.h>
+#include <digital_signal/digital_sequence_i.h>
+
+#define TEST_GPIO          (&gpio_ext_pa7)
+#define TEST_SEQUENCE_SIZE (16U)
+#define TEST_PERIODS_MAX   (64U)
+#define TEST_KEY_SIZE_MAX  (4U)
+
+/* Durations in 10 ps units, chosen so that conversion to timer ticks leaves a remainder */
+#define TEST_PERIOD_SHORT (94400UL)
+#define TEST_PERIOD_LONG  (188800UL)
+#define TEST_PERIOD_HUGE  (200000000UL)
+
+typedef enum {
+    TestSignalIndexSof,
+    TestSignalIndexZero,
+    TestSignalIndexOne,
+    TestSignalIndexHuge,
+    TestSignalIndexNum,
+} TestSignalIndex;
+
+typedef enum {
+    TestCacheResultMiss,
+    TestCacheResultHit,
+    TestCacheResultMismatch, /* Transmitted periods differ from the live encoder */
+} TestCacheResult;
+
+typedef struct {
+    const uint8_t* data;
+    size_t size;
+} TestFrame;
+
+typedef struct {
+    bool start_level;
+    bool is_alternating;
+    uint32_t count;
+    uint32_t periods[TEST_PERIODS_MAX];
+} TestCapture;
+
+/* SOF ends high, Zero starts low and ends high, One starts high, so Zero -> One gets merged */
+static const uint8_t test_frame_a[] = {
+    TestSignalIndexSof,
+    TestSignalIndexZero,
+    TestSignalIndexOne,
+};
+static const uint8_t test_frame_b[] = {
+    TestSignalIndexSof,
+    TestSignalIndexOne,
+    TestSignalIndexOne,
+    TestSignalIndexZero,
+    TestSignalIndexZero,
+};
+static const uint8_t test_frame_c[] = {
+    TestSignalIndexSof,
+    TestSignalIndexZero,
+    TestSignalIndexZero,
+    TestSignalIndexOne,
+    TestSignalIndexZero,
+    TestSignalIndexOne,
+    TestSignalIndexOne,
+};
+static const uint8_t test_frame_huge[] = {TestSignalIndexSof, TestSignalIndexHuge};
+
+static const TestFrame test_frames[] = {
+    {test_frame_a, sizeof(test_frame_a)},
+    {test_frame_b, sizeof(test_frame_b)},
+    {test_frame_c, sizeof(test_frame_c)},
+};
+
+static DigitalSignal* test_signals[TestSignalIndexNum];
+static DigitalSequence* test_sequence;
+static TestCapture test_capture;
+static TestCapture test_reference[COUNT_OF(test_frames)];
+
+static void test_period_callback(bool level, uint32_t period, void* context) {
+    TestCapture* capture = context;
+
+    if(capture->count == 0) {
+        capture->start_level = level;
+        capture->is_alternating = true;
+    } else {
+        capture->is_alternating &= (level == (capture->start_level ^ (capture->count % 2)));
+    }
+
+    if(capture->count < TEST_PERIODS_MAX) capture->periods[capture->count] = period;
+    capture->count++;
+}
+
+static void test_capture_begin(void) {
+    memset(&test_capture, 0, sizeof(test_capture));
+}
+
+static bool test_capture_equal(const TestCapture* a, const TestCapture* b) {
+    if(a->count != b->count || a->start_level != b->start_level) return false;
+    if(!a->is_alternating || !b->is_alternating) return false;
+
+    const size_t count = MIN(a->count, TEST_PERIODS_MAX);
+    return memcmp(a->periods, b->periods, count * sizeof(uint32_t)) == 0;
+}
+
+static void test_sequence_load(const uint8_t* indices, size_t size) {
+    digital_sequence_clear(test_sequence);
+    for(size_t i = 0; i < size; i++) {
+        digital_sequence_add_signal(test_sequence, indices[i]);
+    }
+}
+
+static DigitalSignal*
+    test_signal_alloc(bool start_level, uint32_t first, uint32_t rest, size_t count) {
+    DigitalSignal* signal = digital_signal_alloc(count);
+    digital_signal_set_start_level(signal, start_level);
+    digital_signal_add_period(signal, first);
+    for(size_t i = 1; i < count; i++) {
+        digital_signal_add_period(signal, rest);
+    }
+    return signal;
+}
+
+static void test_setup(void) {
+    test_signals[TestSignalIndexSof] =
+        test_signal_alloc(true, TEST_PERIOD_LONG, TEST_PERIOD_SHORT, 3);
+    test_signals[TestSignalIndexZero] =
+        test_signal_alloc(false, TEST_PERIOD_SHORT, TEST_PERIOD_SHORT, 2);
+    test_signals[TestSignalIndexOne] =
+        test_signal_alloc(true, TEST_PERIOD_SHORT, TEST_PERIOD_LONG, 2);
+    test_signals[TestSignalIndexHuge] =
+        test_signal_alloc(false, TEST_PERIOD_HUGE, TEST_PERIOD_SHORT, 2);
+
+    test_sequence = digital_sequence_alloc(TEST_SEQUENCE_SIZE, TEST_GPIO);
+    for(size_t i = 0; i < TestSignalIndexNum; i++) {
+        digital_sequence_register_signal(test_sequence, i, test_signals[i]);
+    }
+    digital_sequence_set_period_callback(test_sequence, test_period_callback, &test_capture);
+
+    /* What the live encoder emits for every frame, everything else is compared to it */
+    for(size_t i = 0; i < COUNT_OF(test_frames); i++) {
+        test_sequence_load(test_frames[i].data, test_frames[i].size);
+        test_capture_begin();
+        digital_sequence_transmit(test_sequence);
+        test_reference[i] = test_capture;
+    }
+}
+
+static void test_teardown(void) {
+    digital_sequence_free(test_sequence);
+    for(size_t i = 0; i < TestSignalIndexNum; i++) {
+        digital_signal_free(test_signals[i]);
+    }
+    furi_hal_gpio_init_simple(TEST_GPIO, GpioModeAnalog);
+}
+
+/* Sends the frame through the cache the same way NFC listeners do */
+static TestCacheResult test_cache_send(DigitalSequenceCache* cache, size_t frame_index) {
+    const uint8_t key = frame_index;
+    const TestFrame* frame = &test_frames[frame_index];
+
+    test_capture_begin();
+    const bool is_cached = digital_sequence_cache_transmit(cache, test_sequence, &key, 1);
+    if(!is_cached) {
+        test_sequence_load(frame->data, frame->size);
+        digital_sequence_cache_transmit_add(cache, test_sequence, &key, 1);
+    }
+
+    if(!test_capture_equal(&test_capture, &test_reference[frame_index])) {
+        return TestCacheResultMismatch;
+    }
+
+    return is_cached ? TestCacheResultHit : TestCacheResultMiss;
+}
+
+/* Looks the frame up without adding anything */
+static TestCacheResult test_cache_lookup(DigitalSequenceCache* cache, size_t frame_index) {
+    const uint8_t key = frame_index;
+
+    test_capture_begin();
+    if(!digital_sequence_cache_transmit(cache, test_sequence, &key, 1)) {
+        return TestCacheResultMiss;
+    }
+
+    if(!test_capture_equal(&test_capture, &test_reference[frame_index])) {
+        return TestCacheResultMismatch;
+    }
+
+    return TestCacheResultHit;
+}
+
+MU_TEST(digital_sequence_live_test) {
+    /* SOF 3 + Zero 2 + One 2, Zero -> One merged, last period held */
+    mu_assert_int_eq(5, test_reference[0].count);
+    mu_check(test_reference[0].start_level);
+
+    for(size_t i = 0; i < COUNT_OF(test_frames); i++) {
+        mu_check(test_reference[i].is_alternating);
+        mu_check(test_reference[i].count <= TEST_PERIODS_MAX);
+    }
+}
+
+MU_TEST(digital_sequence_record_test) {
+    uint16_t periods[TEST_PERIODS_MAX];
+
+    for(size_t i = 0; i < COUNT_OF(test_frames); i++) {
+        const TestCapture* reference = &test_reference[i];
+        test_sequence_load(test_frames[i].data, test_frames[i].size);
+
+        /* Recording transmits exactly what the live encoder does */
+        bool start_level;
+        test_capture_begin();
+        const uint32_t count = digital_sequence_transmit_record(
+            test_sequence, &start_level, periods, TEST_PERIODS_MAX);
+        mu_check(test_capture_equal(&test_capture, reference));
+        mu_assert_int_eq(reference->count, count);
+        mu_assert_int_eq(reference->start_level, start_level);
+        for(size_t j = 0; j < count; j++) {
+            mu_assert_int_eq(reference->periods[j], periods[j]);
+        }
+
+        /* And sending the recording reproduces it */
+        test_capture_begin();
+        digital_sequence_transmit_rendered(test_sequence, start_level, periods, count);
+        mu_check(test_capture_equal(&test_capture, reference));
+
+        /* Short buffer still gets the full count */
+        memset(periods, 0, sizeof(periods));
+        mu_assert_int_eq(
+            reference->count,
+            digital_sequence_transmit_record(test_sequence, &start_level, periods, 2));
+        mu_assert_int_eq(reference->periods[1], periods[1]);
+        mu_assert_int_eq(0, periods[2]);
+    }
+
+    /* Periods longer than 16 bits are transmitted, but not recorded */
+    test_sequence_load(test_frame_huge, sizeof(test_frame_huge));
+    bool start_level;
+    test_capture_begin();
+    mu_assert_int_eq(
+        0,
+        digital_sequence_transmit_record(test_sequence, &start_level, periods, TEST_PERIODS_MAX));
+    mu_check(test_capture.count > 0);
+}
+
+MU_TEST(digital_sequence_cache_admission_test) {
+    DigitalSequenceCache* cache =
+        digital_sequence_cache_alloc(COUNT_OF(test_frames), TEST_PERIODS_MAX, TEST_KEY_SIZE_MAX);
+
+    /* Stored only when offered for the second time */
+    mu_assert_int_eq(TestCacheResultMiss, test_cache_send(cache, 0));
+    mu_assert_int_eq(TestCacheResultMiss, test_cache_lookup(cache, 0));
+    mu_assert_int_eq(TestCacheResultMiss, test_cache_send(cache, 0));
+    mu_assert_int_eq(TestCacheResultHit, test_cache_send(cache, 0));
+    mu_assert_int_eq(TestCacheResultHit, test_cache_send(cache, 0));
+
+    /* Keys longer than the limit are never stored */
+    const uint8_t long_key[TEST_KEY_SIZE_MAX + 1] = {0};
+    test_sequence_load(test_frame_a, sizeof(test_frame_a));
+    digital_sequence_cache_transmit_add(cache, test_sequence, long_key, sizeof(long_key));
+    digital_sequence_cache_transmit_add(cache, test_sequence, long_key, sizeof(long_key));
+    mu_check(!digital_sequence_cache_transmit(cache, test_sequence, long_key, sizeof(long_key)));
+
+    /* Frames with periods longer than 16 bits are never stored */
+    const uint8_t huge_key = 0xFF;
+    test_sequence_load(test_frame_huge, sizeof(test_frame_huge));
+    digital_sequence_cache_transmit_add(cache, test_sequence, &huge_key, 1);
+    digital_sequence_cache_transmit_add(cache, test_sequence, &huge_key, 1);
+    mu_check(!digital_sequence_cache_transmit(cache, test_sequence, &huge_key, 1));
+    mu_assert_int_eq(TestCacheResultHit, test_cache_lookup(cache, 0));
+
+    /* Reset forgets entries and admission history */
+    digital_sequence_cache_reset(cache);
+    mu_assert_int_eq(TestCacheResultMiss, test_cache_lookup(cache, 0));
+    mu_assert_int_eq(TestCacheResultMiss, test_cache_send(cache, 0));
+    mu_assert_int_eq(TestCacheResultMiss, test_cache_send(cache, 0));
+    mu_assert_int_eq(TestCacheResultHit, test_cache_lookup(cache, 0));
+
+    digital_sequence_cache_free(cache);
+}
+
+MU_TEST(digital_sequence_cache_lru_test) {
+    /* Two entries, plenty of periods: the third frame evicts by entry count */
+    DigitalSequenceCache* cache =
+        digital_sequence_cache_alloc(2, TEST_PERIODS_MAX, TEST_KEY_SIZE_MAX);
+
+    for(size_t i = 0; i < 2; i++) {
+        mu_assert_int_eq(TestCacheResultMiss, test_cache_send(cache, 0));
+        mu_assert_int_eq(TestCacheResultMiss, test_cache_send(cache, 1));
+    }
+    mu_assert_int_eq(TestCacheResultHit, test_cache_lookup(cache, 0));
+    mu_assert_int_eq(TestCacheResultHit, test_cache_lookup(cache, 1));
+
+    /* Frame 0 is the least recently used, it is stored first, so frame 1 moves down */
+    mu_assert_int_eq(TestCacheResultMiss, test_cache_send(cache, 2));
+    mu_assert_int_eq(TestCacheResultMiss, test_cache_send(cache, 2));
+
+    mu_assert_int_eq(TestCacheResultMiss, test_cache_lookup(cache, 0));
+    mu_assert_int_eq(TestCacheResultHit, test_cache_lookup(cache, 1));
+    mu_assert_int_eq(TestCacheResultHit, test_cache_lookup(cache, 2));
+
+    /* Now frame 1 is the least recently used */
+    mu_assert_int_eq(TestCacheResultHit, test_cache_lookup(cache, 2));
+    mu_assert_int_eq(TestCacheResultMiss, test_cache_send(cache, 0));
+    mu_assert_int_eq(TestCacheResultMiss, test_cache_send(cache, 0));
+
+    mu_assert_int_eq(TestCacheResultMiss, test_cache_lookup(cache, 1));
+    mu_assert_int_eq(TestCacheResultHit, test_cache_lookup(cache, 2));
+    mu_assert_int_eq(TestCacheResultHit, test_cache_lookup(cache, 0));
+
+    digital_sequence_cache_free(cache);
+}
+
+MU_TEST(digital_sequence_cache_overflow_test) {
+    const uint32_t count_a = test_reference[0].count;
+    const uint32_t count_b = test_reference[1].count;
+    const uint32_t count_c = test_reference[2].count;
+
+    /* Enough entries, but frame 2 is one period short of fitting next to frames 0 and 1 */
+    DigitalSequenceCache* cache = digital_sequence_cache_alloc(
+        COUNT_OF(test_frames), count_a + count_b + count_c - 1, TEST_KEY_SIZE_MAX);
+
+    for(size_t i = 0; i < 2; i++) {
+        mu_assert_int_eq(TestCacheResultMiss, test_cache_send(cache, 0));
+        mu_assert_int_eq(TestCacheResultMiss, test_cache_send(cache, 1));
+    }
+    mu_assert_int_eq(TestCacheResultHit, test_cache_lookup(cache, 1));
+
+    /* Did not fit: frame 0 is evicted to make room, frame 2 is stored next time */
+    mu_assert_int_eq(TestCacheResultMiss, test_cache_send(cache, 2));
+    mu_assert_int_eq(TestCacheResultMiss, test_cache_send(cache, 2));
+    mu_assert_int_eq(TestCacheResultMiss, test_cache_lookup(cache, 2));
+    mu_assert_int_eq(TestCacheResultMiss, test_cache_lookup(cache, 0));
+    mu_assert_int_eq(TestCacheResultHit, test_cache_lookup(cache, 1));
+
+    mu_assert_int_eq(TestCacheResultMiss, test_cache_send(cache, 2));
+    mu_assert_int_eq(TestCacheResultHit, test_cache_lookup(cache, 2));
+    mu_assert_int_eq(TestCacheResultHit, test_cache_lookup(cache, 1));
+
+    digital_sequence_cache_free(cache);
+
+    /* A frame longer than the whole cache is never stored and evicts nothing */
+    cache = digital_sequence_cache_alloc(COUNT_OF(test_frames), count_c - 1, TEST_KEY_SIZE_MAX);
+
+    mu_assert_int_eq(TestCacheResultMiss, test_cache_send(cache, 0));
+    mu_assert_int_eq(TestCacheResultMiss, test_cache_send(cache, 0));
+    for(size_t i = 0; i < 3; i++) {
+        mu_assert_int_eq(TestCacheResultMiss, test_cache_send(cache, 2));
+    }
+    mu_assert_int_eq(TestCacheResultHit, test_cache_lookup(cache, 0));
+
+    digital_sequence_cache_free(cache);
+}
+
+MU_TEST_SUITE(digital_signal_test) {
+    MU_SUITE_CONFIGURE(&test_setup, &test_teardown);
+
+    MU_RUN_TEST(digital_sequence_live_test);
+    MU_RUN_TEST(digital_sequence_record_test);
+    MU_RUN_TEST(digital_sequence_cache_admission_test);
+    MU_RUN_TEST(digital_sequence_cache_lru_test);
+    MU_RUN_TEST(digital_sequence_cache_overflow_test);
+}
+
+int run_minunit_test_digital_signal(void) {
+    MU_RUN_SUITE(digital_signal_test);
+    return MU_EXIT_CODE;
+}
+
+TEST_API_DEFINE(run_minunit_test_digital_signal)
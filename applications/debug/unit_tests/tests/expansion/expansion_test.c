@@ -29,6 +29,17 @@ MU_TEST(test_expansion_encoded_size) {
         frame.content.data.size = i;
         mu_assert_int_eq(i + 2, expansion_frame_get_encoded_size(&frame));
     }
+
+    frame.header.type = ExpansionFrameTypeBulkSetup;
+    mu_assert_int_eq(4, expansion_frame_get_encoded_size(&frame));
+
+    // Bulk data is sent separately from the frame
+    frame.header.type = ExpansionFrameTypeBulkData;
+    frame.content.bulk_data.size = EXPANSION_PROTOCOL_MAX_BULK_DATA_SIZE;
+    mu_assert_int_eq(4, expansion_frame_get_encoded_size(&frame));
+
+    frame.header.type = ExpansionFrameTypeBulkAck;
+    mu_assert_int_eq(2, expansion_frame_get_encoded_size(&frame));
 }
 
 MU_TEST(test_expansion_remaining_size) {
@@ -90,6 +101,27 @@ MU_TEST(test_expansion_remaining_size) {
     }
     mu_check(expansion_frame_get_remaining_size(&frame, 100, &remaining_size));
     mu_assert_int_eq(0, remaining_size);
+
+    frame.header.type = ExpansionFrameTypeBulkSetup;
+    mu_check(expansion_frame_get_remaining_size(&frame, 1, &remaining_size));
+    mu_assert_int_eq(3, remaining_size);
+    mu_check(expansion_frame_get_remaining_size(&frame, 4, &remaining_size));
+    mu_assert_int_eq(0, remaining_size);
+
+    frame.header.type = ExpansionFrameTypeBulkData;
+    frame.content.bulk_data.size = EXPANSION_PROTOCOL_MAX_BULK_DATA_SIZE;
+    mu_check(expansion_frame_get_remaining_size(&frame, 1, &remaining_size));
+    mu_assert_int_eq(3, remaining_size);
+    mu_check(expansion_frame_get_remaining_size(&frame, 3, &remaining_size));
+    mu_assert_int_eq(1, remaining_size);
+    mu_check(expansion_frame_get_remaining_size(&frame, 4, &remaining_size));
+    mu_assert_int_eq(0, remaining_size);
+
+    frame.header.type = ExpansionFrameTypeBulkAck;
+    mu_check(expansion_frame_get_remaining_size(&frame, 1, &remaining_size));
+    mu_assert_int_eq(1, remaining_size);
+    mu_check(expansion_frame_get_remaining_size(&frame, 2, &remaining_size));
+    mu_assert_int_eq(0, remaining_size);
 }
 
 typedef struct {
@@ -170,6 +202,82 @@ MU_TEST(test_expansion_encode_decode_frame) {
     mu_assert_mem_eq(&frame_in, &frame_out, encoded_size);
 }
 
+MU_TEST(test_expansion_encode_decode_bulk_frame) {
+    const ExpansionFrame frame_in = {
+        .header.type = ExpansionFrameTypeBulkData,
+        .content.bulk_data.seq = 0xA5,
+        .content.bulk_data.size = EXPANSION_PROTOCOL_MAX_BULK_DATA_SIZE,
+    };
+
+    uint8_t data_in[EXPANSION_PROTOCOL_MAX_BULK_DATA_SIZE];
+    furi_hal_random_fill_buf(data_in, sizeof(data_in));
+
+    uint8_t encoded_data
+        [sizeof(ExpansionFrame) + EXPANSION_PROTOCOL_MAX_BULK_DATA_SIZE +
+         sizeof(ExpansionFrameChecksum)];
+
+    TestExpansionSendStream send_stream = {
+        .data_out = &encoded_data,
+        .size_available = sizeof(encoded_data),
+        .size_sent = 0,
+    };
+
+    const size_t encoded_size = expansion_frame_get_encoded_size(&frame_in);
+    const size_t total_size = encoded_size + sizeof(data_in) + sizeof(ExpansionFrameChecksum);
+
+    mu_assert_int_eq(
+        expansion_protocol_encode_bulk(
+            &frame_in, data_in, test_expansion_send_callback, &send_stream),
+        ExpansionProtocolStatusOk);
+    mu_assert_int_eq(total_size, send_stream.size_sent);
+    mu_assert_mem_eq(&frame_in, &encoded_data, encoded_size);
+    mu_assert_mem_eq(data_in, &encoded_data[encoded_size], sizeof(data_in));
+
+    TestExpansionReceiveStream stream = {
+        .data_in = encoded_data,
+        .size_available = send_stream.size_sent,
+        .size_received = 0,
+    };
+
+    ExpansionFrame frame_out;
+    uint8_t data_out[EXPANSION_PROTOCOL_MAX_BULK_DATA_SIZE];
+
+    mu_assert_int_eq(
+        expansion_protocol_decode_bulk(
+            &frame_out, data_out, sizeof(data_out), test_expansion_receive_callback, &stream),
+        ExpansionProtocolStatusOk);
+    mu_assert_int_eq(total_size, stream.size_received);
+    mu_assert_mem_eq(&frame_in, &frame_out, encoded_size);
+    mu_assert_mem_eq(data_in, data_out, sizeof(data_in));
+
+    // Data that does not fit must not pass
+    stream.size_available = send_stream.size_sent;
+    stream.size_received = 0;
+
+    mu_assert_int_eq(
+        expansion_protocol_decode_bulk(
+            &frame_out, data_out, sizeof(data_out) - 1, test_expansion_receive_callback, &stream),
+        ExpansionProtocolStatusErrorFormat);
+
+    stream.size_available = send_stream.size_sent;
+    stream.size_received = 0;
+
+    mu_assert_int_eq(
+        expansion_protocol_decode(&frame_out, test_expansion_receive_callback, &stream),
+        ExpansionProtocolStatusErrorFormat);
+
+    // Corrupted data must not pass
+    encoded_data[encoded_size + sizeof(data_in) / 2] ^= 0x01;
+
+    stream.size_available = send_stream.size_sent;
+    stream.size_received = 0;
+
+    mu_assert_int_eq(
+        expansion_protocol_decode_bulk(
+            &frame_out, data_out, sizeof(data_out), test_expansion_receive_callback, &stream),
+        ExpansionProtocolStatusErrorChecksum);
+}
+
 MU_TEST(test_expansion_garbage_input) {
     uint8_t garbage_data[EXPANSION_TEST_GARBAGE_BUF_SIZE];
     for(uint32_t i = 0; i < EXPANSION_TEST_GARBAGE_ITERATIONS; ++i) {
@@ -191,6 +299,7 @@ MU_TEST_SUITE(test_expansion_suite) {
     MU_RUN_TEST(test_expansion_encoded_size);
     MU_RUN_TEST(test_expansion_remaining_size);
     MU_RUN_TEST(test_expansion_encode_decode_frame);
+    MU_RUN_TEST(test_expansion_encode_decode_bulk_frame);
     MU_RUN_TEST(test_expansion_garbage_input);
 }
 
@@ -327,9 +327,45 @@ MU_TEST(flipper_format_file_test) {
     furi_record_close(RECORD_STORAGE);
 }
 
+MU_TEST(flipper_format_string_reuse_test) {
+    FlipperFormat* flipper_format = flipper_format_string_alloc();
+    FuriString* key = furi_string_alloc();
+    uint32_t data[8];
+
+    // Keys and values don't fit small string storage: reads reuse grown strings
+    for(uint32_t i = 0; i < 16; i++) {
+        for(size_t j = 0; j < COUNT_OF(data); j++) {
+            data[j] = i * 1000000 + j;
+        }
+        furi_string_printf(key, "Key long enough to leave small string storage %lu", i);
+        mu_check(flipper_format_write_uint32(
+            flipper_format, furi_string_get_cstr(key), ARRAY_W_COUNT(data)));
+    }
+
+    for(uint32_t round = 0; round < 4; round++) {
+        for(uint32_t i = 16; i-- > 0;) {
+            furi_string_printf(key, "Key long enough to leave small string storage %lu", i);
+            const char* key_cstr = furi_string_get_cstr(key);
+            uint32_t count = 0;
+
+            mu_check(flipper_format_rewind(flipper_format));
+            mu_check(flipper_format_key_exist(flipper_format, key_cstr));
+            mu_check(flipper_format_get_value_count(flipper_format, key_cstr, &count));
+            mu_assert_int_eq(COUNT_OF(data), count);
+            mu_check(flipper_format_read_uint32(flipper_format, key_cstr, ARRAY_W_COUNT(data)));
+            mu_assert_int_eq(i * 1000000, data[0]);
+            mu_assert_int_eq(i * 1000000 + COUNT_OF(data) - 1, data[COUNT_OF(data) - 1]);
+        }
+    }
+
+    furi_string_free(key);
+    flipper_format_free(flipper_format);
+}
+
 MU_TEST_SUITE(flipper_format_string_suite) {
     MU_RUN_TEST(flipper_format_string_test);
     MU_RUN_TEST(flipper_format_file_test);
+    MU_RUN_TEST(flipper_format_string_reuse_test);
 }
 
 int run_minunit_test_flipper_format_string(void) {
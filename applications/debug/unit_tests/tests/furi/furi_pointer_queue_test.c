@@ -0,0 +1,130 @@
+#include <furi.h>
+#include "../test.h" // IWYU pragma: keep
+
+#define POINTER_QUEUE_SLOT_COUNT  (4u)
+#define POINTER_QUEUE_EVENT_COUNT (128u)
+
+typedef struct {
+    uint32_t counter;
+    uint8_t payload[61];
+} TestPointerQueueMessage;
+
+typedef struct {
+    FuriPointerQueue* pq;
+    FuriEventLoop* event_loop;
+    uint32_t consumer_counter;
+    bool payload_valid;
+} TestPointerQueueData;
+
+static bool test_furi_pointer_queue_consumer_callback(FuriEventLoopObject* object, void* context) {
+    TestPointerQueueData* data = context;
+    furi_check(data->pq == object);
+
+    TestPointerQueueMessage* message = furi_pointer_queue_get(data->pq, 0);
+    furi_check(message);
+
+    data->consumer_counter++;
+    if(message->counter != data->consumer_counter) data->payload_valid = false;
+    for(size_t i = 0; i < sizeof(message->payload); i++) {
+        if(message->payload[i] != (uint8_t)(message->counter + i)) data->payload_valid = false;
+    }
+
+    furi_pointer_queue_release(data->pq, message);
+
+    if(data->consumer_counter == POINTER_QUEUE_EVENT_COUNT) {
+        furi_event_loop_stop(data->event_loop);
+    }
+
+    return true;
+}
+
+static int32_t test_furi_pointer_queue_consumer(void* context) {
+    TestPointerQueueData* data = context;
+
+    data->event_loop = furi_event_loop_alloc();
+    furi_event_loop_subscribe_pointer_queue(
+        data->event_loop,
+        data->pq,
+        FuriEventLoopEventIn,
+        test_furi_pointer_queue_consumer_callback,
+        data);
+
+    furi_event_loop_run(data->event_loop);
+
+    furi_event_loop_unsubscribe(data->event_loop, data->pq);
+    furi_event_loop_free(data->event_loop);
+
+    return 0;
+}
+
+static void test_furi_pointer_queue_basic(void) {
+    FuriPointerQueue* pq =
+        furi_pointer_queue_alloc(POINTER_QUEUE_SLOT_COUNT, sizeof(TestPointerQueueMessage));
+
+    mu_assert_int_eq(POINTER_QUEUE_SLOT_COUNT, furi_pointer_queue_get_capacity(pq));
+    mu_assert_int_eq(sizeof(TestPointerQueueMessage), furi_pointer_queue_get_message_size(pq));
+    mu_assert_int_eq(POINTER_QUEUE_SLOT_COUNT, furi_pointer_queue_get_space(pq));
+    mu_assert_int_eq(0, furi_pointer_queue_get_count(pq));
+    mu_assert_pointers_eq(NULL, furi_pointer_queue_get(pq, 0));
+
+    // Exhaust the pool
+    TestPointerQueueMessage* slots[POINTER_QUEUE_SLOT_COUNT];
+    for(size_t i = 0; i < POINTER_QUEUE_SLOT_COUNT; i++) {
+        slots[i] = furi_pointer_queue_acquire(pq, 0);
+        mu_assert_pointers_not_eq(NULL, slots[i]);
+        mu_assert_int_eq(0, (uintptr_t)slots[i] % sizeof(uint64_t));
+        slots[i]->counter = i;
+    }
+    mu_assert_int_eq(0, furi_pointer_queue_get_space(pq));
+    mu_assert_pointers_eq(NULL, furi_pointer_queue_acquire(pq, 0));
+
+    // Slots are delivered in posting order, without copying
+    furi_pointer_queue_put(pq, slots[2]);
+    furi_pointer_queue_put(pq, slots[0]);
+    mu_assert_int_eq(2, furi_pointer_queue_get_count(pq));
+    mu_assert_pointers_eq(slots[2], furi_pointer_queue_get(pq, 0));
+    mu_assert_pointers_eq(slots[0], furi_pointer_queue_get(pq, 0));
+    mu_assert_int_eq(2, slots[2]->counter);
+
+    // Return everything, including never posted slots
+    for(size_t i = 0; i < POINTER_QUEUE_SLOT_COUNT; i++) {
+        furi_pointer_queue_release(pq, slots[i]);
+    }
+    mu_assert_int_eq(POINTER_QUEUE_SLOT_COUNT, furi_pointer_queue_get_space(pq));
+
+    furi_pointer_queue_free(pq);
+}
+
+static void test_furi_pointer_queue_event_loop(void) {
+    TestPointerQueueData data = {
+        .pq = furi_pointer_queue_alloc(POINTER_QUEUE_SLOT_COUNT, sizeof(TestPointerQueueMessage)),
+        .payload_valid = true,
+    };
+
+    FuriThread* consumer_thread = furi_thread_alloc_ex(
+        "PointerQueueConsumer", 1 * 1024, test_furi_pointer_queue_consumer, &data);
+    furi_thread_start(consumer_thread);
+
+    for(uint32_t counter = 1; counter <= POINTER_QUEUE_EVENT_COUNT; counter++) {
+        TestPointerQueueMessage* message = furi_pointer_queue_acquire(data.pq, 100);
+        furi_check(message);
+        message->counter = counter;
+        for(size_t i = 0; i < sizeof(message->payload); i++) {
+            message->payload[i] = (uint8_t)(counter + i);
+        }
+        furi_pointer_queue_put(data.pq, message);
+    }
+
+    furi_thread_join(consumer_thread);
+    furi_thread_free(consumer_thread);
+
+    mu_assert_int_eq(POINTER_QUEUE_EVENT_COUNT, data.consumer_counter);
+    mu_assert(data.payload_valid, "payload corrupted in transit");
+
+    furi_pointer_queue_free(data.pq);
+}
+
+void test_furi_pointer_queue(void) {
+    test_furi_pointer_queue_basic();
+    test_furi_pointer_queue_event_loop();
+}
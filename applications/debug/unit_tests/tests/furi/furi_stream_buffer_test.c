@@ -0,0 +1,179 @@
+#include <furi.h>
+#include "../test.h" // IWYU pragma: keep
+
+#define STREAM_BUFFER_SIZE          (128u)
+#define STREAM_BUFFER_TRIGGER_LEVEL (16u)
+#define STREAM_BUFFER_CHUNK_SIZE    (4u)
+#define STREAM_BUFFER_TOTAL_SIZE    (4096u)
+
+typedef struct {
+    FuriStreamBuffer* stream_buffer;
+    FuriEventLoop* event_loop;
+    size_t received;
+    size_t short_reads;
+    bool payload_valid;
+} TestStreamBufferData;
+
+static void test_furi_stream_buffer_write(FuriStreamBuffer* stream_buffer, size_t offset) {
+    uint8_t chunk[STREAM_BUFFER_CHUNK_SIZE];
+    for(size_t i = 0; i < STREAM_BUFFER_CHUNK_SIZE; i++) {
+        chunk[i] = (uint8_t)(offset + i);
+    }
+
+    const size_t written =
+        furi_stream_buffer_send(stream_buffer, chunk, sizeof(chunk), FuriWaitForever);
+    furi_check(written == sizeof(chunk));
+}
+
+static void test_furi_stream_buffer_batch(void) {
+    FuriStreamBuffer* stream_buffer =
+        furi_stream_buffer_alloc_ex(sizeof(int32_t) * 32, sizeof(int32_t), sizeof(int32_t));
+
+    int32_t items[40];
+    for(size_t i = 0; i < COUNT_OF(items); i++) {
+        items[i] = -(int32_t)i;
+    }
+
+    // Whole batch fits
+    mu_assert_int_eq(10, furi_stream_buffer_send_batch(stream_buffer, items, 10, 0));
+    mu_assert_int_eq(sizeof(int32_t) * 10, furi_stream_buffer_bytes_available(stream_buffer));
+
+    // Only items that fit are written when there is not enough space
+    mu_assert_int_eq(22, furi_stream_buffer_send_batch(stream_buffer, &items[10], 30, 0));
+    mu_assert(furi_stream_buffer_is_full(stream_buffer), "stream buffer must be full");
+
+    // Timeout on a full buffer writes nothing
+    mu_assert_int_eq(0, furi_stream_buffer_send_batch(stream_buffer, &items[32], 1, 10));
+    mu_assert_int_eq(sizeof(int32_t) * 32, furi_stream_buffer_bytes_available(stream_buffer));
+
+    int32_t received[32];
+    const size_t received_size =
+        furi_stream_buffer_receive(stream_buffer, received, sizeof(received), 0);
+    mu_assert_int_eq(sizeof(received), received_size);
+    mu_assert_mem_eq(items, received, sizeof(received));
+
+    furi_stream_buffer_free(stream_buffer);
+}
+
+typedef struct {
+    FuriStreamBuffer* stream_buffer;
+    int32_t items[40];
+    size_t received;
+} TestStreamBufferBatchData;
+
+static int32_t test_furi_stream_buffer_batch_consumer(void* context) {
+    TestStreamBufferBatchData* data = context;
+
+    // Take less than the buffer holds, so the sender has to block on every round
+    while(data->received < sizeof(data->items)) {
+        const size_t received = furi_stream_buffer_receive(
+            data->stream_buffer,
+            (uint8_t*)data->items + data->received,
+            MIN(sizeof(int32_t) * 3, sizeof(data->items) - data->received),
+            1000);
+        if(received == 0) break;
+        data->received += received;
+    }
+
+    return 0;
+}
+
+static void test_furi_stream_buffer_batch_blocking(void) {
+    TestStreamBufferBatchData data = {
+        .stream_buffer =
+            furi_stream_buffer_alloc_ex(sizeof(int32_t) * 8, sizeof(int32_t), sizeof(int32_t)),
+    };
+
+    int32_t items[COUNT_OF(data.items)];
+    for(size_t i = 0; i < COUNT_OF(items); i++) {
+        items[i] = (int32_t)(i * 1000);
+    }
+
+    FuriThread* consumer = furi_thread_alloc_ex(
+        "StreamBufferBatch", 1024, test_furi_stream_buffer_batch_consumer, &data);
+    furi_thread_start(consumer);
+
+    // Sender blocks until receiver frees a whole item, nothing is lost or split
+    mu_assert_int_eq(
+        COUNT_OF(items),
+        furi_stream_buffer_send_batch(data.stream_buffer, items, COUNT_OF(items), 1000));
+
+    furi_thread_join(consumer);
+    furi_thread_free(consumer);
+
+    mu_assert_int_eq(sizeof(items), data.received);
+    mu_assert_mem_eq(items, data.items, sizeof(items));
+
+    furi_stream_buffer_free(data.stream_buffer);
+}
+
+static bool test_furi_stream_buffer_consumer_callback(FuriEventLoopObject* object, void* context) {
+    TestStreamBufferData* data = context;
+    furi_check(data->stream_buffer == object);
+
+    uint8_t chunk[STREAM_BUFFER_TRIGGER_LEVEL];
+    const size_t received =
+        furi_stream_buffer_receive(data->stream_buffer, chunk, sizeof(chunk), 0);
+    if(received < sizeof(chunk)) data->short_reads++;
+
+    for(size_t i = 0; i < received; i++) {
+        if(chunk[i] != (uint8_t)(data->received + i)) data->payload_valid = false;
+    }
+    data->received += received;
+
+    if(data->received >= STREAM_BUFFER_TOTAL_SIZE) {
+        furi_event_loop_stop(data->event_loop);
+    }
+
+    return true;
+}
+
+static int32_t test_furi_stream_buffer_consumer(void* context) {
+    TestStreamBufferData* data = context;
+
+    data->event_loop = furi_event_loop_alloc();
+    furi_event_loop_subscribe_stream_buffer(
+        data->event_loop,
+        data->stream_buffer,
+        FuriEventLoopEventIn,
+        test_furi_stream_buffer_consumer_callback,
+        data);
+
+    furi_event_loop_run(data->event_loop);
+
+    furi_event_loop_unsubscribe(data->event_loop, data->stream_buffer);
+    furi_event_loop_free(data->event_loop);
+
+    return 0;
+}
+
+static void test_furi_stream_buffer_event_loop_watermark(void) {
+    TestStreamBufferData data = {
+        .stream_buffer = furi_stream_buffer_alloc(STREAM_BUFFER_SIZE, STREAM_BUFFER_TRIGGER_LEVEL),
+        .payload_valid = true,
+    };
+
+    FuriThread* consumer_thread = furi_thread_alloc_ex(
+        "StreamBufferConsumer", 1 * 1024, test_furi_stream_buffer_consumer, &data);
+    furi_thread_start(consumer_thread);
+
+    // Small writes must not wake consumer until trigger level is reached
+    for(size_t offset = 0; offset < STREAM_BUFFER_TOTAL_SIZE; offset += STREAM_BUFFER_CHUNK_SIZE) {
+        test_furi_stream_buffer_write(data.stream_buffer, offset);
+    }
+
+    furi_thread_join(consumer_thread);
+    furi_thread_free(consumer_thread);
+
+    mu_assert_int_eq(STREAM_BUFFER_TOTAL_SIZE, data.received);
+    mu_assert_int_eq(0, data.short_reads);
+    mu_assert(data.payload_valid, "payload corrupted in transit");
+
+    furi_stream_buffer_free(data.stream_buffer);
+}
+
+void test_furi_stream_buffer(void) {
+    test_furi_stream_buffer_batch();
+    test_furi_stream_buffer_batch_blocking();
+    test_furi_stream_buffer_event_loop_watermark();
+}
@@ -4,10 +4,13 @@
 
 // v2 tests
 void test_furi_create_open(void);
+void test_furi_record_handle(void);
 void test_furi_concurrent_access(void);
 void test_furi_pubsub(void);
 void test_furi_memmgr(void);
 void test_furi_event_loop(void);
+void test_furi_pointer_queue(void);
+void test_furi_stream_buffer(void);
 void test_errno_saving(void);
 
 static int foo = 0;
@@ -29,6 +32,10 @@ MU_TEST(mu_test_furi_create_open) {
     test_furi_create_open();
 }
 
+MU_TEST(mu_test_furi_record_handle) {
+    test_furi_record_handle();
+}
+
 MU_TEST(mu_test_furi_pubsub) {
     test_furi_pubsub();
 }
@@ -43,6 +50,14 @@ MU_TEST(mu_test_furi_event_loop) {
     test_furi_event_loop();
 }
 
+MU_TEST(mu_test_furi_pointer_queue) {
+    test_furi_pointer_queue();
+}
+
+MU_TEST(mu_test_furi_stream_buffer) {
+    test_furi_stream_buffer();
+}
+
 MU_TEST(mu_test_errno_saving) {
     test_errno_saving();
 }
@@ -53,9 +68,12 @@ MU_TEST_SUITE(test_suite) {
 
     // v2 tests
     MU_RUN_TEST(mu_test_furi_create_open);
+    MU_RUN_TEST(mu_test_furi_record_handle);
     MU_RUN_TEST(mu_test_furi_pubsub);
     MU_RUN_TEST(mu_test_furi_memmgr);
     MU_RUN_TEST(mu_test_furi_event_loop);
+    MU_RUN_TEST(mu_test_furi_pointer_queue);
+    MU_RUN_TEST(mu_test_furi_stream_buffer);
     MU_RUN_TEST(mu_test_errno_saving);
 }
 
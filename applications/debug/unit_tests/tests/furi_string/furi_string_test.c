@@ -106,6 +106,44 @@ MU_TEST(mu_test_furi_string_mem) {
     furi_string_free(string);
 }
 
+MU_TEST(mu_test_furi_string_arena) {
+    FuriStringArena* arena = furi_string_arena_alloc(2);
+
+    FuriString* string_1 = furi_string_alloc_in(arena);
+    mu_check(furi_string_empty(string_1));
+    furi_string_set(string_1, "long enough to leave small string storage");
+    const char* buffer = furi_string_get_cstr(string_1);
+    furi_string_free(string_1);
+
+    // Released arena string is handed out again, empty but with its buffer kept
+    string_1 = furi_string_alloc_in(arena);
+    mu_check(furi_string_empty(string_1));
+    furi_string_set(string_1, "short");
+    mu_check(furi_string_get_cstr(string_1) == buffer);
+
+    // Exhausted arena falls back to the heap
+    FuriString* string_2 = furi_string_alloc_in(arena);
+    FuriString* string_3 = furi_string_alloc_in(arena);
+    furi_string_set(string_3, "heap");
+    furi_string_swap(string_2, string_3);
+    mu_check(furi_string_cmp(string_2, "heap") == 0);
+    furi_string_free(string_3);
+
+    // Arena strings can be moved out
+    FuriString* string_4 = furi_string_alloc_move(string_2);
+    mu_check(furi_string_cmp(string_4, "heap") == 0);
+    furi_string_move(string_4, string_1);
+    mu_check(furi_string_cmp(string_4, "short") == 0);
+    furi_string_free(string_4);
+
+    // Without an arena strings come from the heap
+    FuriString* string_5 = furi_string_alloc_in(NULL);
+    mu_check(furi_string_empty(string_5));
+    furi_string_free(string_5);
+
+    furi_string_arena_free(arena);
+}
+
 MU_TEST(mu_test_furi_string_getters) {
     FuriString* string = furi_string_alloc_set("test");
 
@@ -450,6 +488,7 @@ MU_TEST_SUITE(test_suite) {
 
     MU_RUN_TEST(mu_test_furi_string_alloc_free);
     MU_RUN_TEST(mu_test_furi_string_mem);
+    MU_RUN_TEST(mu_test_furi_string_arena);
     MU_RUN_TEST(mu_test_furi_string_getters);
     MU_RUN_TEST(mu_test_furi_string_setters);
     MU_RUN_TEST(mu_test_furi_string_appends);
@@ -0,0 +1,104 @@
+#include "../test.h" // IWYU pragma: keep
+
+#include <furi.h>
+#include <gui/gui.h>
+
+typedef struct {
+    size_t tiles_calls;
+    size_t frame_calls;
+    CanvasDirtyTiles tiles;
+    uint8_t frame[CANVAS_TILE_ROWS * CANVAS_TILE_COLUMNS * CANVAS_TILE_SIZE];
+} GuiTestFramebuffer;
+
+static void gui_test_tiles_callback(
+    const uint8_t* data,
+    size_t size,
+    const CanvasDirtyTiles* tiles,
+    CanvasOrientation orientation,
+    void* context) {
+    UNUSED(orientation);
+    GuiTestFramebuffer* framebuffer = context;
+    furi_check(size == sizeof(framebuffer->frame));
+
+    // Apply only reported tiles, result must match full framebuffer
+    for(size_t row = 0; row < CANVAS_TILE_ROWS; row++) {
+        for(size_t column = 0; column < CANVAS_TILE_COLUMNS; column++) {
+            if(tiles->rows[row] & (1U << column)) {
+                const size_t offset = (row * CANVAS_TILE_COLUMNS + column) * CANVAS_TILE_SIZE;
+                memcpy(&framebuffer->frame[offset], &data[offset], CANVAS_TILE_SIZE);
+            }
+        }
+    }
+    furi_check(memcmp(framebuffer->frame, data, size) == 0);
+
+    framebuffer->tiles = *tiles;
+    framebuffer->tiles_calls++;
+}
+
+static void gui_test_frame_callback(
+    uint8_t* data,
+    size_t size,
+    CanvasOrientation orientation,
+    void* context) {
+    UNUSED(data);
+    UNUSED(size);
+    UNUSED(orientation);
+    GuiTestFramebuffer* framebuffer = context;
+    framebuffer->frame_calls++;
+}
+
+MU_TEST(gui_test_framebuffer_dirty_tiles) {
+    Gui* gui = furi_record_open(RECORD_GUI);
+    GuiTestFramebuffer* framebuffer = malloc(sizeof(GuiTestFramebuffer));
+
+    Canvas* canvas = gui_direct_draw_acquire(gui);
+    gui_add_framebuffer_tiles_callback(gui, gui_test_tiles_callback, framebuffer);
+    gui_add_framebuffer_callback(gui, gui_test_frame_callback, framebuffer);
+
+    // New subscriber receives whole frame
+    canvas_commit(canvas);
+    mu_assert_int_eq(1, framebuffer->tiles_calls);
+    mu_assert_int_eq(1, framebuffer->frame_calls);
+    for(size_t row = 0; row < CANVAS_TILE_ROWS; row++) {
+        mu_assert_int_eq(0xFFFF, framebuffer->tiles.rows[row]);
+    }
+
+    // Box spanning two tile rows in tile column 2
+    canvas_draw_box(canvas, 20, 30, 4, 4);
+    canvas_commit(canvas);
+    mu_assert_int_eq(2, framebuffer->tiles_calls);
+    for(size_t row = 0; row < CANVAS_TILE_ROWS; row++) {
+        const uint16_t expected = (row == 3 || row == 4) ? (1U << 2) : 0;
+        mu_assert_int_eq(expected, framebuffer->tiles.rows[row]);
+    }
+
+    // Unchanged frame is not delivered
+    canvas_commit(canvas);
+    mu_assert_int_eq(2, framebuffer->tiles_calls);
+    mu_assert_int_eq(2, framebuffer->frame_calls);
+
+    // Erasing reports the same tiles
+    canvas_clear(canvas);
+    canvas_commit(canvas);
+    mu_assert_int_eq(3, framebuffer->tiles_calls);
+    mu_assert_int_eq((1U << 2), framebuffer->tiles.rows[3]);
+    mu_assert_int_eq((1U << 2), framebuffer->tiles.rows[4]);
+
+    gui_remove_framebuffer_callback(gui, gui_test_frame_callback, framebuffer);
+    gui_remove_framebuffer_tiles_callback(gui, gui_test_tiles_callback, framebuffer);
+    gui_direct_draw_release(gui);
+
+    free(framebuffer);
+    furi_record_close(RECORD_GUI);
+}
+
+MU_TEST_SUITE(test_gui_suite) {
+    MU_RUN_TEST(gui_test_framebuffer_dirty_tiles);
+}
+
+int run_minunit_test_gui(void) {
+    MU_RUN_SUITE(test_gui_suite);
+    return MU_EXIT_CODE;
+}
+
+TEST_API_DEFINE(run_minunit_test_gui)
@@ -6,10 +6,39 @@
 
 #include <storage/storage.h>
 #include <applications/system/js_app/js_thread.h>
+#include <mjs_core_public.h>
+#include <mjs_exec_public.h>
+#include <mjs_gc_public.h>
+#include <mjs_primitive_public.h>
 
 #include <stdint.h>
 
 #define JS_SCRIPT_PATH(name) EXT_PATH("unit_tests/js/" name ".js")
+#define JS_BCODE_CACHE_PATH  EXT_PATH(".cache/js")
+#define JS_BCODE_TEST_SOURCE "let answer = 6; answer * 7;"
+
+// Subtrees are moved between objects and dropped while collection is in progress
+#define JS_GC_TEST_SOURCE                                                                  \
+    "let roots = [];"                                                                       \
+    "for (let i = 0; i < 16; i++) { roots.push({ id: i, child: null }); }"                  \
+    "let stash = [];"                                                                       \
+    "let sum = 0;"                                                                          \
+    "for (let i = 0; i < 1000; i++) {"                                                      \
+    "    let from = roots[i % 16];"                                                         \
+    "    let to = roots[(i * 7 + 3) % 16];"                                                 \
+    "    let node = { id: i, child: from.child, name: 'node' + chr(65 + i % 26) };"         \
+    "    from.child = null;"                                                                \
+    "    to.child = node;"                                                                  \
+    "    stash.push(node.child);"                                                           \
+    "    if (stash.length > 8) { let spliced = stash.splice(0, 1); node.child = spliced[0]; }" \
+    "    let n = node;"                                                                     \
+    "    for (let d = 0; d < 8 && n.child !== null && n.child !== undefined; d++) {"        \
+    "        n = n.child;"                                                                  \
+    "        sum = sum + n.id;"                                                             \
+    "    }"                                                                                 \
+    "    n.child = null;"                                                                   \
+    "}"                                                                                     \
+    "sum;"
 
 typedef enum {
     JsTestsFinished = 1,
@@ -72,12 +101,103 @@ MU_TEST(js_test_event_loop) {
 MU_TEST(js_test_storage) {
     js_test_run(JS_SCRIPT_PATH("storage"));
 }
+MU_TEST(js_test_bcode) {
+    struct mjs* mjs = mjs_create(NULL);
+    char* bcode;
+    size_t bcode_size;
+    mjs_val_t res;
+
+    // Compiled bytecode runs like the source it came from
+    mu_assert_int_eq(
+        MJS_OK, mjs_compile(mjs, "test.js", JS_BCODE_TEST_SOURCE, &bcode, &bcode_size));
+    mu_check(bcode_size > 0);
+    mu_assert_int_eq(MJS_OK, mjs_exec_bcode(mjs, bcode, bcode_size, &res));
+    mu_assert_int_eq(42, mjs_get_int(mjs, res));
+
+    mu_assert_int_eq(
+        MJS_SYNTAX_ERROR, mjs_compile(mjs, "test.js", "let = ;", &bcode, &bcode_size));
+    mu_check(bcode == NULL);
+    mu_assert_int_eq(0, bcode_size);
+
+    // Hash can be computed in chunks, header only matches the same source
+    const size_t source_size = strlen(JS_BCODE_TEST_SOURCE);
+    const uint32_t source_hash =
+        mjs_source_hash(MJS_SOURCE_HASH_INIT, JS_BCODE_TEST_SOURCE, source_size);
+    uint32_t chunked_hash = mjs_source_hash(MJS_SOURCE_HASH_INIT, JS_BCODE_TEST_SOURCE, 5);
+    chunked_hash = mjs_source_hash(chunked_hash, JS_BCODE_TEST_SOURCE + 5, source_size - 5);
+    mu_assert_int_eq(source_hash, chunked_hash);
+
+    mu_assert_int_eq(
+        MJS_OK, mjs_compile(mjs, "test.js", JS_BCODE_TEST_SOURCE, &bcode, &bcode_size));
+
+    struct mjs_bcode_file_header header;
+    mjs_bcode_file_header_init(&header, source_hash, bcode, bcode_size);
+    mu_check(mjs_bcode_file_header_check(&header, source_hash));
+    mu_check(!mjs_bcode_file_header_check(&header, source_hash ^ 1));
+
+    // Bytecode CRC catches a single flipped bit
+    mu_check(mjs_bcode_file_bcode_check(&header, bcode));
+    bcode[bcode_size / 2] ^= 0x01;
+    mu_check(!mjs_bcode_file_bcode_check(&header, bcode));
+    bcode[bcode_size / 2] ^= 0x01;
+
+    header.magic ^= 1;
+    mu_check(!mjs_bcode_file_header_check(&header, source_hash));
+
+    // Truncated bytecode is rejected and freed
+    mu_assert_int_eq(MJS_BAD_ARGS_ERROR, mjs_exec_bcode(mjs, bcode, bcode_size - 1, &res));
+
+    mjs_destroy(mjs);
+}
+MU_TEST(js_test_bcode_cache) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    storage_simply_remove_recursive(storage, JS_BCODE_CACHE_PATH);
+    furi_record_close(RECORD_STORAGE);
+
+    // First run compiles script into cache, second one executes cached bytecode
+    js_test_run(JS_SCRIPT_PATH("basic"));
+    storage = furi_record_open(RECORD_STORAGE);
+    mu_assert(storage_dir_exists(storage, JS_BCODE_CACHE_PATH), "bytecode cache not created");
+    furi_record_close(RECORD_STORAGE);
+    js_test_run(JS_SCRIPT_PATH("basic"));
+}
+
+MU_TEST(js_test_gc_step_sizes) {
+    // 0 is the stop-the-world collector, the rest are incremental
+    const size_t step_sizes[] = {0, 16, 64, 256};
+    int reference = 0;
+
+    for(size_t i = 0; i < COUNT_OF(step_sizes); i++) {
+        const size_t heap_before = memmgr_get_free_heap();
+
+        struct mjs* mjs = mjs_create(NULL);
+        mjs_set_gc_step_size(mjs, step_sizes[i]);
+        mjs_val_t res;
+        mu_assert_int_eq(MJS_OK, mjs_exec(mjs, JS_GC_TEST_SOURCE, &res));
+        const int result = mjs_get_int(mjs, res);
+
+        struct mjs_gc_stats stats;
+        mjs_get_gc_stats(mjs, &stats);
+        mu_check(stats.cycles > 0);
+        mjs_destroy(mjs);
+
+        if(i == 0) {
+            reference = result;
+        } else {
+            mu_assert_int_eq(reference, result);
+        }
+        mu_assert_int_eq(heap_before, memmgr_get_free_heap());
+    }
+}
 
 MU_TEST_SUITE(test_js) {
     MU_RUN_TEST(js_test_basic);
     MU_RUN_TEST(js_test_math);
     MU_RUN_TEST(js_test_event_loop);
     MU_RUN_TEST(js_test_storage);
+    MU_RUN_TEST(js_test_bcode);
+    MU_RUN_TEST(js_test_bcode_cache);
+    MU_RUN_TEST(js_test_gc_step_sizes);
 }
 
 int run_minunit_test_js(void) {
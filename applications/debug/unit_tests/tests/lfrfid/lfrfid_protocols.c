@@ -3,6 +3,8 @@
 #include <toolbox/protocols/protocol_dict.h>
 #include <lfrfid/protocols/lfrfid_protocols.h>
 #include <toolbox/pulse_protocols/pulse_glue.h>
+#include <lfrfid/tools/lfrfid_demod.h>
+#include <lfrfid/tools/lfrfid_raw_codec.h>
 
 #define LF_RFID_READ_TIMING_MULTIPLIER 8
 
@@ -526,6 +528,259 @@ MU_TEST(test_lfrfid_protocol_fdxb_read_simple) {
     protocol_dict_free(dict);
 }
 
+static ProtocolId lfrfid_protocol_demod_read(
+    ProtocolDict* dict,
+    const int8_t* timings,
+    size_t timings_count) {
+    ProtocolId protocol = PROTOCOL_NO;
+    PulseGlue* pulse_glue = pulse_glue_alloc();
+    LFRFIDDemod* demod = lfrfid_demod_alloc();
+
+    protocol_dict_decoders_start(dict);
+
+    for(size_t i = 0; i < timings_count * 10; i++) {
+        bool pulse_pop = pulse_glue_push(
+            pulse_glue,
+            timings[i % timings_count] >= 0,
+            abs(timings[i % timings_count]) * LF_RFID_READ_TIMING_MULTIPLIER);
+
+        if(pulse_pop) {
+            uint32_t length, period;
+            pulse_glue_pop(pulse_glue, &length, &period);
+
+            const LFRFIDSymbol* symbol = lfrfid_demod_feed(demod, true, period);
+            protocol = protocol_dict_decoders_feed_symbol(dict, true, period, symbol);
+            if(protocol != PROTOCOL_NO) break;
+
+            symbol = lfrfid_demod_feed(demod, false, length - period);
+            protocol = protocol_dict_decoders_feed_symbol(dict, false, length - period, symbol);
+            if(protocol != PROTOCOL_NO) break;
+        }
+    }
+
+    lfrfid_demod_free(demod);
+    pulse_glue_free(pulse_glue);
+
+    return protocol;
+}
+
+MU_TEST(test_lfrfid_protocol_demod_read_simple) {
+    ProtocolDict* dict = protocol_dict_alloc(lfrfid_protocols, LFRFIDProtocolMax);
+
+    // ASK, Manchester
+    const uint8_t em_data[EM_TEST_DATA_SIZE] = EM_TEST_DATA;
+    uint8_t em_received_data[EM_TEST_DATA_SIZE] = {0};
+    ProtocolId protocol =
+        lfrfid_protocol_demod_read(dict, em_test_timings, EM_TEST_EMULATION_TIMINGS_COUNT);
+    mu_assert_int_eq(LFRFIDProtocolEM4100, protocol);
+    protocol_dict_get_data(dict, protocol, em_received_data, EM_TEST_DATA_SIZE);
+    mu_assert_mem_eq(em_data, em_received_data, EM_TEST_DATA_SIZE);
+
+    // FSK
+    const uint8_t hid_data[HID10301_TEST_DATA_SIZE] = HID10301_TEST_DATA;
+    uint8_t hid_received_data[HID10301_TEST_DATA_SIZE] = {0};
+    protocol = lfrfid_protocol_demod_read(
+        dict, hid10301_test_timings, HID10301_TEST_EMULATION_TIMINGS_COUNT);
+    mu_assert_int_eq(LFRFIDProtocolH10301, protocol);
+    protocol_dict_get_data(dict, protocol, hid_received_data, HID10301_TEST_DATA_SIZE);
+    mu_assert_mem_eq(hid_data, hid_received_data, HID10301_TEST_DATA_SIZE);
+
+    protocol_dict_free(dict);
+}
+
+#define LF_RFID_ROUND_TRIP_YIELDS_MAX    (40000)
+#define LF_RFID_ROUND_TRIP_DATA_SIZE_MAX (12)
+
+typedef struct {
+    LFRFIDProtocol protocol;
+    uint8_t data[LF_RFID_ROUND_TRIP_DATA_SIZE_MAX];
+} LFRFIDRoundTripCase;
+
+// Every protocol with a front end decoder, with data that survives encode/decode as is
+static const LFRFIDRoundTripCase lfrfid_round_trip_cases[] = {
+    {LFRFIDProtocolEM4100, EM_TEST_DATA},
+    {LFRFIDProtocolEM410032, EM_TEST_DATA},
+    {LFRFIDProtocolEM410016, EM_TEST_DATA},
+    {LFRFIDProtocolElectra, {0x58, 0x00, 0x85, 0x64, 0x02, 0x11, 0x22, 0x33}},
+    {LFRFIDProtocolH10301, HID10301_TEST_DATA},
+    {LFRFIDProtocolIdteck, {0x49, 0x44, 0x54, 0x4B, 0x05, 0x06, 0x07, 0x08}},
+    {LFRFIDProtocolIndala26, INDALA26_TEST_DATA},
+    {LFRFIDProtocolIOProxXSF, IOPROX_XSF_TEST_DATA},
+    {LFRFIDProtocolAwid, {0x1A, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x00}},
+    {LFRFIDProtocolFDXA, {0x01, 0x02, 0x04, 0x07, 0x08}},
+    {LFRFIDProtocolHidGeneric, {0x01, 0x02, 0x03, 0x04, 0x05, 0x00}},
+    {LFRFIDProtocolHidExGeneric,
+     {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0A, 0x0B, 0x00}},
+    {LFRFIDProtocolPyramid, {0x1A, 0x02, 0x03, 0x04}},
+    {LFRFIDProtocolViking, {0x01, 0x02, 0x03, 0x04}},
+    {LFRFIDProtocolParadox, {0x01, 0x02, 0x03, 0x04, 0x05, 0x00}},
+    {LFRFIDProtocolKeri, {0x81, 0x02, 0x03, 0x04}},
+    {LFRFIDProtocolGallagher, {0x01, 0x00, 0x03, 0x04, 0x00, 0x06, 0x07, 0x08}},
+    {LFRFIDProtocolNexwatch, {0x00, 0x21, 0x3C, 0x9F, 0x8F, 0x15, 0x0C, 0x00}},
+};
+
+static bool lfrfid_protocol_is_psk(ProtocolDict* dict, ProtocolId protocol) {
+    uint32_t features = protocol_dict_get_features(dict, protocol);
+    return (features & LFRFIDFeaturePSK) && !(features & LFRFIDFeatureASK);
+}
+
+/**
+ * Emulate the protocol and read it back the way the worker does: by one feature,
+ * through the whole dictionary, either from raw edges or through the front end.
+ * PSK is captured as the reader sees it: carrier compared against the reference clock,
+ * so every phase flip becomes an edge.
+ */
+static ProtocolId lfrfid_protocol_round_trip_read(
+    ProtocolDict* encoder_dict,
+    ProtocolId encoder_protocol,
+    bool use_demod,
+    uint8_t* data,
+    size_t data_size) {
+    ProtocolDict* dict = protocol_dict_alloc(lfrfid_protocols, LFRFIDProtocolMax);
+    PulseGlue* pulse_glue = pulse_glue_alloc();
+    LFRFIDDemod* demod = lfrfid_demod_alloc();
+
+    const bool psk = lfrfid_protocol_is_psk(encoder_dict, encoder_protocol);
+    const uint32_t feature = psk ? LFRFIDFeaturePSK : LFRFIDFeatureASK;
+    ProtocolId protocol = PROTOCOL_NO;
+    size_t carrier_index = 0;
+
+    protocol_dict_encoder_start(encoder_dict, encoder_protocol);
+    protocol_dict_decoders_start(dict);
+
+    for(size_t i = 0; i < LF_RFID_ROUND_TRIP_YIELDS_MAX && protocol == PROTOCOL_NO; i++) {
+        LevelDuration level_duration = protocol_dict_encoder_yield(encoder_dict, encoder_protocol);
+        bool level = level_duration_get_level(level_duration);
+        uint32_t duration = level_duration_get_duration(level_duration);
+        uint32_t step = psk ? duration : 1;
+
+        for(size_t j = 0; j < step && protocol == PROTOCOL_NO; j++) {
+            bool pulse_pop;
+            if(psk) {
+                bool phase = level ^ (carrier_index++ & 1);
+                pulse_pop = pulse_glue_push(pulse_glue, phase, LF_RFID_READ_TIMING_MULTIPLIER);
+            } else {
+                pulse_pop = pulse_glue_push(
+                    pulse_glue, level, duration * LF_RFID_READ_TIMING_MULTIPLIER);
+            }
+
+            if(!pulse_pop) continue;
+
+            uint32_t length, period;
+            pulse_glue_pop(pulse_glue, &length, &period);
+
+            if(use_demod) {
+                const LFRFIDSymbol* symbol = lfrfid_demod_feed(demod, true, period);
+                protocol = protocol_dict_decoders_feed_symbol_by_feature(
+                    dict, feature, true, period, symbol);
+                if(protocol != PROTOCOL_NO) break;
+
+                symbol = lfrfid_demod_feed(demod, false, length - period);
+                protocol = protocol_dict_decoders_feed_symbol_by_feature(
+                    dict, feature, false, length - period, symbol);
+            } else {
+                protocol = protocol_dict_decoders_feed_by_feature(dict, feature, true, period);
+                if(protocol != PROTOCOL_NO) break;
+
+                protocol = protocol_dict_decoders_feed_by_feature(
+                    dict, feature, false, length - period);
+            }
+        }
+    }
+
+    if(protocol != PROTOCOL_NO && protocol_dict_get_data_size(dict, protocol) == data_size) {
+        protocol_dict_get_data(dict, protocol, data, data_size);
+    }
+
+    lfrfid_demod_free(demod);
+    pulse_glue_free(pulse_glue);
+    protocol_dict_free(dict);
+
+    return protocol;
+}
+
+MU_TEST(test_lfrfid_protocol_demod_round_trip) {
+    ProtocolDict* dict = protocol_dict_alloc(lfrfid_protocols, LFRFIDProtocolMax);
+
+    for(size_t i = 0; i < COUNT_OF(lfrfid_round_trip_cases); i++) {
+        const LFRFIDRoundTripCase* test_case = &lfrfid_round_trip_cases[i];
+        const size_t data_size = protocol_dict_get_data_size(dict, test_case->protocol);
+        mu_assert(data_size <= LF_RFID_ROUND_TRIP_DATA_SIZE_MAX, "test data too small");
+
+        protocol_dict_set_data(dict, test_case->protocol, test_case->data, data_size);
+
+        // Legacy raw edge decoders and front end must detect the same protocol,
+        // no other protocol of the same feature may claim the capture first
+        uint8_t legacy_data[LF_RFID_ROUND_TRIP_DATA_SIZE_MAX] = {0};
+        ProtocolId protocol = lfrfid_protocol_round_trip_read(
+            dict, test_case->protocol, false, legacy_data, data_size);
+        mu_assert_int_eq(test_case->protocol, protocol);
+        mu_assert_mem_eq(test_case->data, legacy_data, data_size);
+
+        uint8_t demod_data[LF_RFID_ROUND_TRIP_DATA_SIZE_MAX] = {0};
+        protocol = lfrfid_protocol_round_trip_read(
+            dict, test_case->protocol, true, demod_data, data_size);
+        mu_assert_int_eq(test_case->protocol, protocol);
+        mu_assert_mem_eq(test_case->data, demod_data, data_size);
+    }
+
+    protocol_dict_free(dict);
+}
+
+#define LF_RFID_RAW_CODEC_DECODE_STEP 7
+
+MU_TEST(test_lfrfid_raw_codec_round_trip) {
+    LFRFIDRawPair* pairs_in = malloc(sizeof(LFRFIDRawPair) * LFRFID_RAW_CODEC_BLOCK_PAIRS);
+    LFRFIDRawPair* pairs_out = malloc(sizeof(LFRFIDRawPair) * LFRFID_RAW_CODEC_BLOCK_PAIRS);
+    uint8_t* block = malloc(LFRFID_RAW_CODEC_MAX_SIZE(LFRFID_RAW_CODEC_BLOCK_PAIRS));
+
+    // Jittered half and full bit periods, as captured from an ASK card
+    for(size_t i = 0; i < LFRFID_RAW_CODEC_BLOCK_PAIRS; i++) {
+        const uint32_t period = (i % 3) ? 256 : 512;
+        pairs_in[i].duration = period + (i * 7) % 13;
+        pairs_in[i].pulse = period / 2 - (i * 5) % 11;
+    }
+
+    // Values far from the previous ones are escaped
+    pairs_in[100].pulse = 0;
+    pairs_in[100].duration = UINT32_MAX;
+    pairs_in[101].pulse = UINT32_MAX;
+    pairs_in[101].duration = 0;
+
+    const size_t block_size =
+        lfrfid_raw_codec_encode(pairs_in, LFRFID_RAW_CODEC_BLOCK_PAIRS, block);
+    mu_check(block_size > LFRFID_RAW_CODEC_HEADER_SIZE);
+    mu_check(block_size < sizeof(LFRFIDRawPair) * LFRFID_RAW_CODEC_BLOCK_PAIRS / 2);
+
+    LFRFIDRawDecoder decoder;
+    mu_check(lfrfid_raw_codec_decoder_init(&decoder, block, block_size));
+    mu_assert_int_eq(LFRFID_RAW_CODEC_BLOCK_PAIRS, lfrfid_raw_codec_get_pairs_left(&decoder));
+
+    size_t decoded = 0;
+    while(decoded < LFRFID_RAW_CODEC_BLOCK_PAIRS) {
+        const size_t count = lfrfid_raw_codec_decode(
+            &decoder, &pairs_out[decoded], LF_RFID_RAW_CODEC_DECODE_STEP);
+        if(count == 0) break;
+        decoded += count;
+    }
+
+    mu_assert_int_eq(LFRFID_RAW_CODEC_BLOCK_PAIRS, decoded);
+    mu_assert_int_eq(0, lfrfid_raw_codec_get_pairs_left(&decoder));
+    mu_assert_mem_eq(pairs_in, pairs_out, sizeof(LFRFIDRawPair) * LFRFID_RAW_CODEC_BLOCK_PAIRS);
+
+    // Truncated block must stop decoding instead of reading past its end
+    mu_check(lfrfid_raw_codec_decoder_init(&decoder, block, block_size / 2));
+    decoded = lfrfid_raw_codec_decode(&decoder, pairs_out, LFRFID_RAW_CODEC_BLOCK_PAIRS);
+    mu_check(decoded < LFRFID_RAW_CODEC_BLOCK_PAIRS);
+    mu_assert_int_eq(0, lfrfid_raw_codec_get_pairs_left(&decoder));
+
+    mu_check(!lfrfid_raw_codec_decoder_init(&decoder, block, LFRFID_RAW_CODEC_HEADER_SIZE - 1));
+
+    free(block);
+    free(pairs_out);
+    free(pairs_in);
+}
+
 MU_TEST_SUITE(test_lfrfid_protocols_suite) {
     MU_RUN_TEST(test_lfrfid_protocol_em_read_simple);
     MU_RUN_TEST(test_lfrfid_protocol_em_emulate_simple);
@@ -540,6 +795,10 @@ MU_TEST_SUITE(test_lfrfid_protocols_suite) {
 
     MU_RUN_TEST(test_lfrfid_protocol_fdxb_read_simple);
     MU_RUN_TEST(test_lfrfid_protocol_fdxb_emulate_simple);
+
+    MU_RUN_TEST(test_lfrfid_protocol_demod_read_simple);
+    MU_RUN_TEST(test_lfrfid_protocol_demod_round_trip);
+    MU_RUN_TEST(test_lfrfid_raw_codec_round_trip);
 }
 
 int run_minunit_test_lfrfid_protocols(void) {
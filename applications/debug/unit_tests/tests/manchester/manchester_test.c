@@ -0,0 +1,293 @@
+#include <furi.h>
+#include "../test.h" // IWYU pragma: keep
+#include <toolbox/manchester_block_decoder.h>
+
+#define EXHAUSTIVE_LENGTH (7)
+#define EXHAUSTIVE_EVENTS (5)
+#define RANDOM_BIT_COUNT  (512)
+#define CLOCK_HALF_PERIOD (100)
+#define CLOCK_DRIFT       (30)
+#define CLOCK_JITTER      (5)
+#define TEST_BUFFER_SIZE  (128)
+
+static const ManchesterEvent test_events[EXHAUSTIVE_EVENTS] = {
+    ManchesterEventShortLow,
+    ManchesterEventShortHigh,
+    ManchesterEventLongLow,
+    ManchesterEventLongHigh,
+    ManchesterEventReset,
+};
+
+// Prefixes that bring manchester_advance() from reset to every state
+static const ManchesterEvent test_prefixes[][2] = {
+    {ManchesterEventReset, ManchesterEventReset}, // Mid1
+    {ManchesterEventReset, ManchesterEventShortHigh}, // Start1
+    {ManchesterEventReset, ManchesterEventLongHigh}, // Mid0
+    {ManchesterEventLongHigh, ManchesterEventShortLow}, // Start0
+};
+
+static void test_manchester_advance(const ManchesterEvent* events, size_t count, BitBuffer* bits) {
+    ManchesterState state;
+    manchester_advance(ManchesterStateMid1, ManchesterEventReset, &state, NULL);
+
+    for(size_t i = 0; i < count; i++) {
+        bool data;
+        if(manchester_advance(state, events[i], &state, &data)) {
+            bit_buffer_append_bit(bits, data);
+        }
+    }
+}
+
+static bool test_get_bit(const BitBuffer* bits, size_t index) {
+    return (bit_buffer_get_byte(bits, index / 8) >> (index % 8)) & 1;
+}
+
+static void test_bits_eq(const BitBuffer* expected, const BitBuffer* actual) {
+    mu_assert_int_eq(bit_buffer_get_size(expected), bit_buffer_get_size(actual));
+    for(size_t i = 0; i < bit_buffer_get_size_bytes(expected); i++) {
+        mu_assert_int_eq(bit_buffer_get_byte(expected, i), bit_buffer_get_byte(actual, i));
+    }
+}
+
+MU_TEST(test_manchester_block_exhaustive) {
+    ManchesterBlockDecoder* decoder =
+        manchester_block_decoder_alloc(ManchesterBlockCodingManchester);
+    BitBuffer* expected = bit_buffer_alloc(TEST_BUFFER_SIZE);
+    BitBuffer* actual = bit_buffer_alloc(TEST_BUFFER_SIZE);
+    ManchesterEvent events[COUNT_OF(test_prefixes[0]) + EXHAUSTIVE_LENGTH];
+
+    // Every event sequence up to EXHAUSTIVE_LENGTH long, from every state
+    for(size_t length = 1; length <= EXHAUSTIVE_LENGTH; length++) {
+        size_t combinations = 1;
+        for(size_t i = 0; i < length; i++) {
+            combinations *= EXHAUSTIVE_EVENTS;
+        }
+
+        for(size_t prefix = 0; prefix < COUNT_OF(test_prefixes); prefix++) {
+            memcpy(events, test_prefixes[prefix], sizeof(test_prefixes[prefix]));
+            const size_t count = COUNT_OF(test_prefixes[prefix]) + length;
+
+            for(size_t combination = 0; combination < combinations; combination++) {
+                size_t index = combination;
+                for(size_t i = COUNT_OF(test_prefixes[prefix]); i < count; i++) {
+                    events[i] = test_events[index % EXHAUSTIVE_EVENTS];
+                    index /= EXHAUSTIVE_EVENTS;
+                }
+
+                bit_buffer_reset(expected);
+                test_manchester_advance(events, count, expected);
+
+                // Whole block at once
+                bit_buffer_reset(actual);
+                manchester_block_decoder_reset(decoder);
+                mu_assert_int_eq(
+                    count, manchester_block_decoder_decode(decoder, events, count, actual));
+                test_bits_eq(expected, actual);
+
+                // Event by event, state is carried between calls
+                bit_buffer_reset(actual);
+                manchester_block_decoder_reset(decoder);
+                for(size_t i = 0; i < count; i++) {
+                    mu_assert_int_eq(
+                        1, manchester_block_decoder_decode(decoder, &events[i], 1, actual));
+                }
+                test_bits_eq(expected, actual);
+            }
+        }
+    }
+
+    bit_buffer_free(actual);
+    bit_buffer_free(expected);
+    manchester_block_decoder_free(decoder);
+}
+
+// Alternating levels, one bit value is long and the other one is two shorts
+static size_t test_differential_encode(
+    const BitBuffer* bits,
+    bool is_zero_long,
+    ManchesterEvent* events) {
+    size_t count = 0;
+    for(size_t i = 0; i < bit_buffer_get_size(bits); i++) {
+        const bool bit = test_get_bit(bits, i);
+        if(bit != is_zero_long) {
+            events[count] = count % 2 ? ManchesterEventLongHigh : ManchesterEventLongLow;
+            count++;
+        } else {
+            for(size_t j = 0; j < 2; j++) {
+                events[count] = count % 2 ? ManchesterEventShortHigh : ManchesterEventShortLow;
+                count++;
+            }
+        }
+    }
+    return count;
+}
+
+static void test_differential_coding(ManchesterBlockCoding coding, bool is_zero_long) {
+    ManchesterBlockDecoder* decoder = manchester_block_decoder_alloc(coding);
+    BitBuffer* expected = bit_buffer_alloc(RANDOM_BIT_COUNT / 8);
+    BitBuffer* actual = bit_buffer_alloc(RANDOM_BIT_COUNT / 8);
+    ManchesterEvent* events = malloc(sizeof(ManchesterEvent) * RANDOM_BIT_COUNT * 2);
+
+    for(size_t i = 0; i < RANDOM_BIT_COUNT; i++) {
+        bit_buffer_append_bit(expected, rand() & 1);
+    }
+
+    const size_t count = test_differential_encode(expected, is_zero_long, events);
+
+    // Odd chunk sizes move the pair boundary across the stream
+    for(size_t chunk = 1; chunk <= 7; chunk += 2) {
+        bit_buffer_reset(actual);
+        manchester_block_decoder_reset(decoder);
+        for(size_t i = 0; i < count; i += chunk) {
+            const size_t size = MIN(chunk, count - i);
+            mu_assert_int_eq(
+                size, manchester_block_decoder_decode(decoder, &events[i], size, actual));
+        }
+        test_bits_eq(expected, actual);
+    }
+
+    // Long after short is missing a transition, decoder goes back to reset state by itself
+    const ManchesterEvent broken[] = {ManchesterEventShortLow, ManchesterEventLongHigh};
+    manchester_block_decoder_reset(decoder);
+    manchester_block_decoder_decode(decoder, broken, COUNT_OF(broken), actual);
+
+    bit_buffer_reset(actual);
+    mu_assert_int_eq(count, manchester_block_decoder_decode(decoder, events, count, actual));
+    test_bits_eq(expected, actual);
+
+    free(events);
+    bit_buffer_free(actual);
+    bit_buffer_free(expected);
+    manchester_block_decoder_free(decoder);
+}
+
+MU_TEST(test_manchester_block_differential) {
+    // Decoder starts after mid-bit transition: no transition at bit start is 1
+    test_differential_coding(ManchesterBlockCodingDifferential, false);
+}
+
+MU_TEST(test_manchester_block_biphase) {
+    // Decoder starts after bit start transition: no transition at mid-bit is 0
+    test_differential_coding(ManchesterBlockCodingBiphase, true);
+}
+
+MU_TEST(test_manchester_block_buffer) {
+    ManchesterBlockDecoder* decoder = manchester_block_decoder_alloc(ManchesterBlockCodingBiphase);
+    BitBuffer* bits = bit_buffer_alloc(2);
+    ManchesterEvent events[32];
+
+    for(size_t i = 0; i < COUNT_OF(events); i++) {
+        events[i] = i % 2 ? ManchesterEventLongHigh : ManchesterEventLongLow;
+    }
+
+    // Unaligned start, then decoding stops when the buffer is full
+    bit_buffer_append_bit(bits, true);
+    bit_buffer_append_bit(bits, false);
+    bit_buffer_append_bit(bits, true);
+
+    mu_assert_int_eq(13, manchester_block_decoder_decode(decoder, events, COUNT_OF(events), bits));
+    mu_assert_int_eq(16, bit_buffer_get_size(bits));
+    mu_assert_int_eq(0x05, bit_buffer_get_byte(bits, 0));
+    mu_assert_int_eq(0x00, bit_buffer_get_byte(bits, 1));
+
+    mu_assert_int_eq(0, manchester_block_decoder_decode(decoder, events, COUNT_OF(events), bits));
+
+    bit_buffer_free(bits);
+    manchester_block_decoder_free(decoder);
+}
+
+// Manchester durations with the clock drifting by CLOCK_DRIFT percent, starting at mid-bit of 1
+static size_t test_clock_encode(const BitBuffer* bits, LevelDuration* durations) {
+    const size_t bit_count = bit_buffer_get_size(bits);
+    const size_t half_count = bit_count * 2 - 1;
+    size_t count = 0;
+    bool run_level = false;
+    uint32_t run_duration = 0;
+
+    for(size_t i = 1; i <= half_count; i++) {
+        const bool bit = test_get_bit(bits, i / 2);
+        const bool level = (i % 2) ? !bit : bit;
+        const uint32_t half_period = CLOCK_HALF_PERIOD + CLOCK_DRIFT * i / half_count;
+        const uint32_t jitter = rand() % (2 * CLOCK_JITTER + 1);
+
+        if(run_duration && level != run_level) {
+            durations[count++] = level_duration_make(run_level, run_duration);
+            run_duration = 0;
+        }
+
+        run_level = level;
+        run_duration += half_period + jitter - CLOCK_JITTER;
+    }
+
+    durations[count++] = level_duration_make(run_level, run_duration);
+    return count;
+}
+
+static void test_clock_decode(
+    const LevelDuration* durations,
+    size_t count,
+    bool recovery,
+    BitBuffer* bits) {
+    ManchesterBlockDecoder* decoder =
+        manchester_block_decoder_alloc(ManchesterBlockCodingManchester);
+    ManchesterEvent* events = malloc(sizeof(ManchesterEvent) * count);
+
+    manchester_block_decoder_set_clock(decoder, CLOCK_HALF_PERIOD, recovery);
+    manchester_block_decoder_classify(decoder, durations, count, events);
+    manchester_block_decoder_decode(decoder, events, count, bits);
+
+    if(recovery) {
+        // Clock has followed the drift
+        uint32_t clock = manchester_block_decoder_get_clock(decoder);
+        mu_check(clock > CLOCK_HALF_PERIOD + CLOCK_DRIFT - CLOCK_DRIFT / 3);
+        mu_check(clock < CLOCK_HALF_PERIOD + CLOCK_DRIFT + CLOCK_DRIFT / 3);
+    }
+
+    free(events);
+    manchester_block_decoder_free(decoder);
+}
+
+MU_TEST(test_manchester_block_clock_recovery) {
+    BitBuffer* bits = bit_buffer_alloc(RANDOM_BIT_COUNT / 8);
+    BitBuffer* expected = bit_buffer_alloc(RANDOM_BIT_COUNT / 8);
+    BitBuffer* actual = bit_buffer_alloc(RANDOM_BIT_COUNT / 8);
+    LevelDuration* durations = malloc(sizeof(LevelDuration) * RANDOM_BIT_COUNT * 2);
+
+    bit_buffer_append_bit(bits, true);
+    for(size_t i = 1; i < RANDOM_BIT_COUNT; i++) {
+        const bool bit = rand() & 1;
+        bit_buffer_append_bit(bits, bit);
+        bit_buffer_append_bit(expected, bit);
+    }
+
+    const size_t count = test_clock_encode(bits, durations);
+
+    // Every bit after the first one is decoded with recovery
+    test_clock_decode(durations, count, true, actual);
+    test_bits_eq(expected, actual);
+
+    // Drifted clock is lost without it
+    bit_buffer_reset(actual);
+    test_clock_decode(durations, count, false, actual);
+    mu_check(bit_buffer_get_size(actual) < bit_buffer_get_size(expected));
+
+    free(durations);
+    bit_buffer_free(actual);
+    bit_buffer_free(expected);
+    bit_buffer_free(bits);
+}
+
+MU_TEST_SUITE(test_manchester_suite) {
+    MU_RUN_TEST(test_manchester_block_exhaustive);
+    MU_RUN_TEST(test_manchester_block_differential);
+    MU_RUN_TEST(test_manchester_block_biphase);
+    MU_RUN_TEST(test_manchester_block_buffer);
+    MU_RUN_TEST(test_manchester_block_clock_recovery);
+}
+
+int run_minunit_test_manchester(void) {
+    MU_RUN_SUITE(test_manchester_suite);
+    return MU_EXIT_CODE;
+}
+
+TEST_API_DEFINE(run_minunit_test_manchester)
@@ -0,0 +1,302 @@
+#include <furi.h>
+#include <furi_hal.h>
+#include "../test.h" // IWYU pragma: keep
+
+#include <signal_reader/parsers/iso15693/iso15693_parser_i.h>
+
+#define ISO15693_PARSER_TEST_GPIO                (&gpio_ext_pa7)
+#define ISO15693_PARSER_TEST_FRAME_SIZE_MAX      (32U)
+#define ISO15693_PARSER_TEST_FRAME_CAPACITY      (256U)
+#define ISO15693_PARSER_TEST_CAPTURE_COUNT       (400U)
+#define ISO15693_PARSER_TEST_BITSTREAM_BUFF_SIZE (32U)
+#define ISO15693_PARSER_TEST_CAPTURE_SIZE_MAX \
+    (2U + ISO15693_PARSER_TEST_FRAME_SIZE_MAX * 64U + ISO15693_PARSER_TEST_BITSTREAM_BUFF_SIZE)
+
+#define ISO15693_PARSER_TEST_SOF_1_OUT_OF_4   (0x21U)
+#define ISO15693_PARSER_TEST_SOF_1_OUT_OF_256 (0x81U)
+#define ISO15693_PARSER_TEST_EOF_SINGLE       (0x01U)
+#define ISO15693_PARSER_TEST_EOF              (0x04U)
+
+typedef struct {
+    uint8_t data[ISO15693_PARSER_TEST_CAPTURE_SIZE_MAX];
+    size_t size;
+} Iso15693ParserTestCapture;
+
+typedef struct {
+    bool parsed;
+    uint8_t data[ISO15693_PARSER_TEST_FRAME_CAPACITY];
+    size_t bits;
+} Iso15693ParserTestResult;
+
+static Iso15693ParserTestCapture iso15693_parser_test_capture;
+static Iso15693ParserTestResult iso15693_parser_test_result;
+static Iso15693ParserTestResult iso15693_parser_test_expected;
+static uint32_t iso15693_parser_test_random_state;
+
+static uint32_t iso15693_parser_test_random(void) {
+    iso15693_parser_test_random_state ^= iso15693_parser_test_random_state << 13;
+    iso15693_parser_test_random_state ^= iso15693_parser_test_random_state >> 17;
+    iso15693_parser_test_random_state ^= iso15693_parser_test_random_state << 5;
+    return iso15693_parser_test_random_state;
+}
+
+// Same bitstream as the signal reader produces for a reader command, two samples per slot
+static void iso15693_parser_test_encode(
+    Iso15693ParserTestCapture* capture,
+    bool is_1_out_of_256,
+    const uint8_t* data,
+    size_t data_size) {
+    size_t size = 0;
+
+    if(is_1_out_of_256) {
+        capture->data[size++] = ISO15693_PARSER_TEST_SOF_1_OUT_OF_256;
+        for(size_t i = 0; i < data_size; i++) {
+            memset(&capture->data[size], 0x00, 64);
+            capture->data[size + data[i] / 4] = 0x02 << ((data[i] % 4) * 2);
+            size += 64;
+        }
+    } else {
+        capture->data[size++] = ISO15693_PARSER_TEST_SOF_1_OUT_OF_4;
+        for(size_t i = 0; i < data_size; i++) {
+            for(size_t j = 0; j < 4; j++) {
+                capture->data[size++] = 0x02 << (((data[i] >> (j * 2)) & 0x03) * 2);
+            }
+        }
+    }
+    capture->data[size++] = ISO15693_PARSER_TEST_EOF;
+
+    // Signal reader keeps sampling the idle field until the parser is stopped
+    memset(&capture->data[size], 0x00, ISO15693_PARSER_TEST_BITSTREAM_BUFF_SIZE);
+    size += ISO15693_PARSER_TEST_BITSTREAM_BUFF_SIZE;
+
+    capture->size = size;
+}
+
+static void iso15693_parser_test_generate(Iso15693ParserTestCapture* capture, size_t index) {
+    uint8_t data[ISO15693_PARSER_TEST_FRAME_SIZE_MAX];
+    const size_t data_size = 1 + iso15693_parser_test_random() % COUNT_OF(data);
+    for(size_t i = 0; i < data_size; i++) {
+        data[i] = iso15693_parser_test_random();
+    }
+
+    iso15693_parser_test_encode(capture, index % 2, data, data_size);
+
+    // Every fourth capture is damaged: noise, doubled pulses or a cut off frame
+    if(index % 4 == 3) {
+        const size_t pos = iso15693_parser_test_random() % capture->size;
+        switch(iso15693_parser_test_random() % 3) {
+        case 0:
+            capture->data[pos] = iso15693_parser_test_random();
+            break;
+        case 1:
+            capture->data[pos] |= capture->data[pos] >> 1;
+            break;
+        default:
+            capture->size = pos;
+            break;
+        }
+    }
+}
+
+/*********************** REFERENCE ***********************/
+
+static void iso15693_parser_test_append(Iso15693ParserTestResult* result, uint8_t byte) {
+    furi_check(result->bits / 8 < ISO15693_PARSER_TEST_FRAME_CAPACITY);
+    result->data[result->bits / 8] = byte;
+    result->bits += 8;
+}
+
+// Slot by slot, the parser decodes what it has collected on EOF or once its buffer is full
+static bool iso15693_parser_test_reference_1_out_of_4(
+    const Iso15693ParserTestCapture* capture,
+    size_t* pos,
+    Iso15693ParserTestResult* result) {
+    uint8_t buff[ISO15693_PARSER_TEST_BITSTREAM_BUFF_SIZE];
+    size_t buff_size = 0;
+    bool eof_received = false;
+    uint8_t byte = 0;
+    size_t byte_part = 0;
+
+    while(*pos < capture->size) {
+        const uint8_t sample = capture->data[(*pos)++];
+        if(sample == ISO15693_PARSER_TEST_EOF) {
+            eof_received = true;
+        } else {
+            buff[buff_size++] = sample;
+            if(buff_size < COUNT_OF(buff)) continue;
+        }
+
+        // Nothing is decoded when the buffer has just been emptied
+        if(buff_size == 0) continue;
+
+        for(size_t i = 0; i < buff_size; i++) {
+            size_t symbol = 0;
+            while(symbol < 4 && buff[i] != (0x02 << (symbol * 2))) {
+                symbol++;
+            }
+            if(symbol == 4) return false;
+
+            byte |= symbol << (byte_part * 2);
+            if(++byte_part == 4) {
+                iso15693_parser_test_append(result, byte);
+                byte = 0;
+                byte_part = 0;
+            }
+        }
+        buff_size = 0;
+
+        if(eof_received) return true;
+    }
+
+    return false;
+}
+
+static bool iso15693_parser_test_reference_1_out_of_256(
+    const Iso15693ParserTestCapture* capture,
+    size_t* pos,
+    Iso15693ParserTestResult* result) {
+    uint8_t buff[ISO15693_PARSER_TEST_BITSTREAM_BUFF_SIZE];
+    size_t buff_size = 0;
+    size_t byte_part = 0;
+
+    while(*pos < capture->size) {
+        buff[buff_size++] = capture->data[(*pos)++];
+        if(buff_size < COUNT_OF(buff)) continue;
+
+        for(size_t i = 0; i < buff_size; i++) {
+            if(byte_part == 0 && buff[i] == ISO15693_PARSER_TEST_EOF) return true;
+
+            for(size_t bit = 0; bit < 8; bit++) {
+                if(buff[i] & (1U << bit)) {
+                    iso15693_parser_test_append(result, byte_part * 4 + bit / 2);
+                }
+            }
+            byte_part = (byte_part + 1) % 64;
+        }
+        buff_size = 0;
+    }
+
+    return false;
+}
+
+static void iso15693_parser_test_reference(
+    const Iso15693ParserTestCapture* capture,
+    Iso15693ParserTestResult* result) {
+    memset(result, 0, sizeof(Iso15693ParserTestResult));
+
+    size_t pos = 0;
+    while(pos < capture->size && !result->parsed) {
+        const uint8_t sof = capture->data[pos++];
+        memset(result, 0, sizeof(Iso15693ParserTestResult));
+
+        if(sof == ISO15693_PARSER_TEST_EOF_SINGLE) {
+            result->parsed = true;
+        } else if(sof == ISO15693_PARSER_TEST_SOF_1_OUT_OF_4) {
+            result->parsed = iso15693_parser_test_reference_1_out_of_4(capture, &pos, result);
+        } else if(sof == ISO15693_PARSER_TEST_SOF_1_OUT_OF_256) {
+            result->parsed = iso15693_parser_test_reference_1_out_of_256(capture, &pos, result);
+        }
+        // Anything else makes the parser start over from the next sample
+    }
+
+    if(!result->parsed) {
+        memset(result, 0, sizeof(Iso15693ParserTestResult));
+    }
+}
+
+/*********************** PARSER ***********************/
+
+static void iso15693_parser_test_callback(Iso15693ParserEvent event, void* context) {
+    UNUSED(event);
+    bool* data_received = context;
+    *data_received = true;
+}
+
+// Feed the capture the same way the signal reader does, parse as the listener does
+static void iso15693_parser_test_parse(
+    Iso15693Parser* parser,
+    const Iso15693ParserTestCapture* capture,
+    Iso15693ParserTestResult* result) {
+    memset(result, 0, sizeof(Iso15693ParserTestResult));
+
+    bool data_received = false;
+    iso15693_parser_start(parser, iso15693_parser_test_callback, &data_received);
+
+    for(size_t i = 0; i < capture->size && !result->parsed; i++) {
+        iso15693_parser_feed(parser, capture->data[i]);
+        if(data_received) {
+            data_received = false;
+            result->parsed = iso15693_parser_run(parser);
+        }
+    }
+
+    if(result->parsed) {
+        iso15693_parser_get_data(parser, result->data, sizeof(result->data), &result->bits);
+    }
+
+    iso15693_parser_stop(parser);
+}
+
+static bool iso15693_parser_test_result_equal(
+    const Iso15693ParserTestResult* a,
+    const Iso15693ParserTestResult* b) {
+    return a->parsed == b->parsed && a->bits == b->bits &&
+           memcmp(a->data, b->data, sizeof(a->data)) == 0;
+}
+
+void test_iso15693_parser_roundtrip(void) {
+    const uint8_t data[] = {0x26, 0x01, 0x00, 0xF6, 0x0A, 0xFF};
+    Iso15693ParserTestCapture* capture = &iso15693_parser_test_capture;
+    Iso15693ParserTestResult* result = &iso15693_parser_test_result;
+
+    Iso15693Parser* parser =
+        iso15693_parser_alloc(ISO15693_PARSER_TEST_GPIO, ISO15693_PARSER_TEST_FRAME_CAPACITY);
+
+    for(size_t mode = 0; mode < 2; mode++) {
+        iso15693_parser_test_encode(capture, mode, data, sizeof(data));
+
+        iso15693_parser_test_parse(parser, capture, result);
+        mu_check(result->parsed);
+        mu_assert_int_eq(sizeof(data) * 8, result->bits);
+        mu_assert_mem_eq(data, result->data, sizeof(data));
+
+        iso15693_parser_test_reference(capture, &iso15693_parser_test_expected);
+        mu_check(iso15693_parser_test_result_equal(result, &iso15693_parser_test_expected));
+    }
+
+    // Lone EOF is a valid frame without data
+    capture->data[0] = ISO15693_PARSER_TEST_EOF_SINGLE;
+    capture->size = 1;
+    iso15693_parser_test_parse(parser, capture, result);
+    mu_check(result->parsed);
+    mu_assert_int_eq(0, result->bits);
+
+    iso15693_parser_free(parser);
+    furi_hal_gpio_init_simple(ISO15693_PARSER_TEST_GPIO, GpioModeAnalog);
+}
+
+void test_iso15693_parser_reference(void) {
+    Iso15693ParserTestCapture* capture = &iso15693_parser_test_capture;
+    size_t parsed = 0;
+
+    Iso15693Parser* parser =
+        iso15693_parser_alloc(ISO15693_PARSER_TEST_GPIO, ISO15693_PARSER_TEST_FRAME_CAPACITY);
+    iso15693_parser_test_random_state = 0x15693;
+
+    for(size_t i = 0; i < ISO15693_PARSER_TEST_CAPTURE_COUNT; i++) {
+        iso15693_parser_test_generate(capture, i);
+
+        iso15693_parser_test_reference(capture, &iso15693_parser_test_expected);
+        iso15693_parser_test_parse(parser, capture, &iso15693_parser_test_result);
+
+        mu_check(iso15693_parser_test_result_equal(
+            &iso15693_parser_test_result, &iso15693_parser_test_expected));
+        parsed += iso15693_parser_test_expected.parsed;
+    }
+
+    // Damaged captures must not make everything fail
+    mu_check(parsed > ISO15693_PARSER_TEST_CAPTURE_COUNT / 2);
+
+    iso15693_parser_free(parser);
+    furi_hal_gpio_init_simple(ISO15693_PARSER_TEST_GPIO, GpioModeAnalog);
+}
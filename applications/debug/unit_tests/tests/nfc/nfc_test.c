@@ -30,6 +30,9 @@
 
 #define TAG "NfcTest"
 
+void test_iso15693_parser_roundtrip(void);
+void test_iso15693_parser_reference(void);
+
 #define NFC_TEST_NFC_DEV_PATH                  EXT_PATH("unit_tests/nfc/nfc_device_test.nfc")
 #define NFC_APP_MF_CLASSIC_DICT_UNIT_TEST_PATH EXT_PATH("unit_tests/mf_dict.nfc")
 
@@ -823,6 +826,14 @@ MU_TEST(slix_set_password_access_all_passwords_cap) {
         EXT_PATH("unit_tests/nfc/Slix_cap_accept_all_pass.nfc"), 0x12341234, false);
 }
 
+MU_TEST(iso15693_parser_roundtrip) {
+    test_iso15693_parser_roundtrip();
+}
+
+MU_TEST(iso15693_parser_reference) {
+    test_iso15693_parser_reference();
+}
+
 MU_TEST_SUITE(nfc) {
     nfc_test_alloc();
 
@@ -872,6 +883,9 @@ MU_TEST_SUITE(nfc) {
     MU_RUN_TEST(slix_set_password_default_cap_incorrect_pass);
     MU_RUN_TEST(slix_set_password_access_all_passwords_cap);
 
+    MU_RUN_TEST(iso15693_parser_roundtrip);
+    MU_RUN_TEST(iso15693_parser_reference);
+
     nfc_test_free();
 }
 
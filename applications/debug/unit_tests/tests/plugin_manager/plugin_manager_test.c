@@ -0,0 +1,116 @@
+#include <furi.h>
+#include <flipper_application/plugins/plugin_manager.h>
+#include <loader/firmware_api/firmware_api.h>
+#include "../test.h" // IWYU pragma: keep
+
+// Any unit test plugin will do, it is only loaded and never run
+#define PLUGIN_MANAGER_TEST_PLUGIN EXT_PATH("apps_data/unit_tests/plugins/test_varint.fal")
+
+static PluginManager* plugin_manager_test_alloc(bool shared) {
+    PluginManager* manager = plugin_manager_alloc(APPID, API_VERSION, firmware_api_interface);
+    plugin_manager_set_shared(manager, shared);
+    return manager;
+}
+
+static const void* plugin_manager_test_load(PluginManager* manager) {
+    if(plugin_manager_load_single(manager, PLUGIN_MANAGER_TEST_PLUGIN) != PluginManagerErrorNone) {
+        return NULL;
+    }
+
+    return plugin_manager_get_ep(manager, plugin_manager_get_count(manager) - 1);
+}
+
+static void plugin_manager_test_teardown(void) {
+    plugin_manager_flush_cache();
+}
+
+MU_TEST(plugin_manager_test_shared) {
+    PluginManager* manager_1 = plugin_manager_test_alloc(true);
+    const void* plugin_1 = plugin_manager_test_load(manager_1);
+    mu_check(plugin_1);
+    plugin_manager_free(manager_1);
+
+    // Plugin outlives its manager and is reused by the next one
+    PluginManager* manager_2 = plugin_manager_test_alloc(true);
+    const void* plugin_2 = plugin_manager_test_load(manager_2);
+    mu_check(plugin_2 == plugin_1);
+
+    // Live managers never share a plugin
+    PluginManager* manager_3 = plugin_manager_test_alloc(true);
+    const void* plugin_3 = plugin_manager_test_load(manager_3);
+    mu_check(plugin_3);
+    mu_check(plugin_3 != plugin_2);
+
+    plugin_manager_free(manager_3);
+    plugin_manager_free(manager_2);
+
+    // Managers that didn't opt in get a private copy even if there is an idle one
+    PluginManager* manager_4 = plugin_manager_test_alloc(false);
+    const void* plugin_4 = plugin_manager_test_load(manager_4);
+    mu_check(plugin_4);
+    mu_check(plugin_4 != plugin_2);
+    mu_check(plugin_4 != plugin_3);
+    plugin_manager_free(manager_4);
+
+    // Both copies are idle now, any of them is reused
+    PluginManager* manager_5 = plugin_manager_test_alloc(true);
+    const void* plugin_5 = plugin_manager_test_load(manager_5);
+    mu_check(plugin_5 == plugin_2 || plugin_5 == plugin_3);
+    plugin_manager_free(manager_5);
+}
+
+MU_TEST(plugin_manager_test_private) {
+    PluginManager* manager_1 = plugin_manager_test_alloc(false);
+    const void* plugin_1 = plugin_manager_test_load(manager_1);
+    mu_check(plugin_1);
+
+    PluginManager* manager_2 = plugin_manager_test_alloc(false);
+    const void* plugin_2 = plugin_manager_test_load(manager_2);
+    mu_check(plugin_2);
+    mu_check(plugin_2 != plugin_1);
+
+    plugin_manager_free(manager_2);
+    plugin_manager_free(manager_1);
+
+    // Private plugins are freed with their manager and never handed out again
+    PluginManager* manager_3 = plugin_manager_test_alloc(true);
+    mu_check(plugin_manager_test_load(manager_3));
+    plugin_manager_free(manager_3);
+
+    PluginManager* manager_4 = plugin_manager_test_alloc(true);
+    const void* plugin_4 = plugin_manager_test_load(manager_4);
+    mu_check(plugin_4);
+    plugin_manager_flush_cache();
+
+    // Flush leaves plugins in use alone
+    mu_check(plugin_manager_get_ep(manager_4, 0) == plugin_4);
+    plugin_manager_free(manager_4);
+}
+
+MU_TEST(plugin_manager_test_mismatch) {
+    PluginManager* manager =
+        plugin_manager_alloc("Not a unit test", API_VERSION, firmware_api_interface);
+    plugin_manager_set_shared(manager, true);
+
+    mu_assert_int_eq(
+        PluginManagerErrorApplicationIdMismatch,
+        plugin_manager_load_single(manager, PLUGIN_MANAGER_TEST_PLUGIN));
+    mu_assert_int_eq(0, plugin_manager_get_count(manager));
+
+    plugin_manager_free(manager);
+}
+
+MU_TEST_SUITE(plugin_manager_test_suite) {
+    MU_SUITE_CONFIGURE(NULL, &plugin_manager_test_teardown);
+
+    MU_RUN_TEST(plugin_manager_test_shared);
+    MU_RUN_TEST(plugin_manager_test_private);
+    MU_RUN_TEST(plugin_manager_test_mismatch);
+}
+
+int run_minunit_test_plugin_manager(void) {
+    MU_RUN_SUITE(plugin_manager_test_suite);
+    return MU_EXIT_CODE;
+}
+
+TEST_API_DEFINE(run_minunit_test_plugin_manager)
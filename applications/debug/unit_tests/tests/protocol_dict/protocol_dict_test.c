@@ -17,6 +17,7 @@ typedef struct {
 } Protocol0Data;
 
 static const uint32_t protocol_0_decoder_result = 0xDEADBEEF;
+static size_t protocol_0_decoder_counter = 0;
 
 static void* protocol_0_alloc(void) {
     void* data = malloc(sizeof(Protocol0Data));
@@ -33,9 +34,11 @@ static uint8_t* protocol_0_get_data(Protocol0Data* data) {
 
 static void protocol_0_decoder_start(Protocol0Data* data) {
     data->data = 0;
+    protocol_0_decoder_counter = 0;
 }
 
 static bool protocol_0_decoder_feed(Protocol0Data* data, bool level, uint32_t duration) {
+    protocol_0_decoder_counter++;
     if(level && duration == 666) {
         data->data = protocol_0_decoder_result;
         return true;
@@ -89,6 +92,17 @@ static bool protocol_1_decoder_feed(Protocol1Data* data, bool level, uint32_t du
     }
 }
 
+static size_t
+    protocol_1_decoder_feed_batch(Protocol1Data* data, const LevelDuration* levels, size_t count) {
+    for(size_t i = 0; i < count; i++) {
+        bool level = level_duration_get_level(levels[i]);
+        if(protocol_1_decoder_feed(data, level, level_duration_get_duration(levels[i]))) {
+            return i + 1;
+        }
+    }
+    return 0;
+}
+
 static bool protocol_1_encoder_start(Protocol1Data* data) {
     data->encoder_counter = 0;
     return true;
@@ -130,6 +144,7 @@ static const ProtocolBase protocol_1 = {
         {
             .start = (ProtocolDecoderStart)protocol_1_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_1_decoder_feed,
+            .feed_batch = (ProtocolDecoderFeedBatch)protocol_1_decoder_feed_batch,
         },
     .encoder =
         {
@@ -212,8 +227,59 @@ MU_TEST(test_protocol_dict) {
     free(data);
 }
 
+MU_TEST(test_protocol_dict_batch) {
+    ProtocolDict* dict = protocol_dict_alloc(test_protocols_base, TestDictProtocolMax);
+    LevelDuration levels[16];
+    for(size_t i = 0; i < COUNT_OF(levels); i++) {
+        levels[i] = level_duration_make(i % 2, 100);
+    }
+
+    // protocol 0 goes through its own trigger while protocol 1 triggers earlier
+    levels[4] = level_duration_make(true, 543);
+    levels[8] = level_duration_make(true, 666);
+    levels[12] = level_duration_make(true, 543);
+
+    protocol_dict_decoders_start(dict);
+    const LevelDuration* batch = levels;
+    size_t count = COUNT_OF(levels);
+    size_t consumed = 0;
+
+    ProtocolId protocol_id = protocol_dict_decoders_feed_batch(dict, batch, count, &consumed);
+    mu_assert_int_eq(TestDictProtocol1, protocol_id);
+    mu_assert_int_eq(5, consumed);
+    batch += consumed;
+    count -= consumed;
+
+    // pending result of protocol 0 is reported without feeding it again
+    protocol_id = protocol_dict_decoders_feed_batch(dict, batch, count, &consumed);
+    mu_assert_int_eq(TestDictProtocol0, protocol_id);
+    mu_assert_int_eq(4, consumed);
+    batch += consumed;
+    count -= consumed;
+
+    uint32_t data;
+    protocol_dict_get_data(dict, protocol_id, (uint8_t*)&data, sizeof(data));
+    mu_assert_int_eq(protocol_0_decoder_result, data);
+
+    protocol_id = protocol_dict_decoders_feed_batch(dict, batch, count, &consumed);
+    mu_assert_int_eq(TestDictProtocol1, protocol_id);
+    mu_assert_int_eq(4, consumed);
+    batch += consumed;
+    count -= consumed;
+
+    protocol_id = protocol_dict_decoders_feed_batch(dict, batch, count, &consumed);
+    mu_assert_int_eq(PROTOCOL_NO, protocol_id);
+    mu_assert_int_eq(3, consumed);
+
+    // every edge went to protocol 0 exactly once
+    mu_assert_int_eq(COUNT_OF(levels), protocol_0_decoder_counter);
+
+    protocol_dict_free(dict);
+}
+
 MU_TEST_SUITE(test_protocol_dict_suite) {
     MU_RUN_TEST(test_protocol_dict);
+    MU_RUN_TEST(test_protocol_dict_batch);
 }
 
 int run_minunit_test_protocol_dict(void) {
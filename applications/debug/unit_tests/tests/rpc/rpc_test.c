@@ -11,6 +11,8 @@
 #include <lib/toolbox/api_lock.h>
 #include <lib/toolbox/md5_calc.h>
 #include <lib/toolbox/path.h>
+#include <lib/toolbox/frame_delta.h>
+#include <gui/gui.h>
 
 #include <m-list.h>
 #include "../test.h" // IWYU pragma: keep
@@ -1618,6 +1620,89 @@ MU_TEST_SUITE(test_rpc_app) {
     DISABLE_TEST(MU_RUN_TEST(test_app_start_and_lock_status););
 }
 
+static bool test_rpc_gui_receive(PB_Main* result) {
+    pb_istream_t istream = {
+        .callback = test_rpc_pb_stream_read,
+        .state = &rpc_session[0],
+        .errmsg = NULL,
+        .bytes_left = 0x7FFFFFFF,
+    };
+
+    rpc_session[0].timeout = furi_get_tick() + MAX_RECEIVE_OUTPUT_TIMEOUT;
+    return pb_decode_ex(&istream, &PB_Main_msg, result, PB_DECODE_DELIMITED);
+}
+
+static void test_rpc_gui_screen_stream_run(bool delta) {
+    Gui* gui = furi_record_open(RECORD_GUI);
+    const size_t frame_size = gui_get_framebuffer_size(gui);
+    furi_record_close(RECORD_GUI);
+
+    PB_Main request;
+    test_rpc_fill_basic_message(
+        &request, PB_Main_gui_start_screen_stream_request_tag, ++command_id);
+    request.content.gui_start_screen_stream_request.delta = delta;
+    test_rpc_encode_and_feed_one(&request, 0);
+
+    // Status first, then the frame from the redraw that starting the stream requests
+    PB_Main result = {.cb_content.funcs.decode = NULL};
+    bool started = test_rpc_gui_receive(&result) && result.command_id == command_id &&
+                   result.command_status == PB_CommandStatus_OK;
+    pb_release(&PB_Main_msg, &result);
+
+    bool frame_received = false;
+    bool frame_valid = false;
+    if(started && test_rpc_gui_receive(&result) &&
+       result.which_content == PB_Main_gui_screen_frame_tag) {
+        const pb_bytes_array_t* data = result.content.gui_screen_frame.data;
+        frame_received = true;
+
+        if(delta) {
+            // Client has nothing to apply delta to yet, so the first frame is a key frame
+            uint8_t* frame = malloc(frame_size);
+            uint16_t sequence = UINT16_MAX;
+            frame_valid =
+                data->size >= FRAME_DELTA_HEADER_SIZE && data->bytes[1] == FrameDeltaTypeKey &&
+                frame_delta_decode(data->bytes, data->size, frame, frame_size, &sequence) &&
+                sequence == 0;
+            free(frame);
+        } else {
+            frame_valid = data->size == frame_size;
+        }
+    }
+    pb_release(&PB_Main_msg, &result);
+
+    // Frames may still be in flight, skip them until the stop status
+    test_rpc_fill_basic_message(
+        &request, PB_Main_gui_stop_screen_stream_request_tag, ++command_id);
+    test_rpc_encode_and_feed_one(&request, 0);
+
+    bool stopped = false;
+    while(!stopped && test_rpc_gui_receive(&result)) {
+        stopped = result.command_id == command_id;
+        pb_release(&PB_Main_msg, &result);
+    }
+
+    mu_assert(started, "screen stream not started");
+    mu_assert(frame_received, "no screen frame received");
+    mu_assert(frame_valid, delta ? "malformed delta frame" : "malformed raw frame");
+    mu_assert(stopped, "screen stream not stopped");
+}
+
+MU_TEST(test_gui_screen_stream) {
+    test_rpc_gui_screen_stream_run(false);
+}
+
+MU_TEST(test_gui_screen_stream_delta) {
+    test_rpc_gui_screen_stream_run(true);
+}
+
+MU_TEST_SUITE(test_rpc_gui) {
+    MU_SUITE_CONFIGURE(&test_rpc_setup, &test_rpc_teardown);
+
+    MU_RUN_TEST(test_gui_screen_stream);
+    MU_RUN_TEST(test_gui_screen_stream_delta);
+}
+
 static void
     test_send_rubbish(RpcSession* session, const char* pattern, size_t pattern_size, size_t size) {
     UNUSED(session);
@@ -1847,6 +1932,7 @@ int run_minunit_test_rpc(void) {
     furi_record_close(RECORD_STORAGE);
     MU_RUN_SUITE(test_rpc_system);
     MU_RUN_SUITE(test_rpc_app);
+    MU_RUN_SUITE(test_rpc_gui);
     MU_RUN_SUITE(test_rpc_session);
 
     return MU_EXIT_CODE;
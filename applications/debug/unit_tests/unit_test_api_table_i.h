@@ -8,6 +8,9 @@
 #include <rpc/rpc_i.h>
 #include <flipper.pb.h>
 #include <applications/system/js_app/js_thread.h>
+#include <digital_signal/digital_sequence_cache.h>
+#include <digital_signal/digital_sequence_i.h>
+#include <signal_reader/parsers/iso15693/iso15693_parser_i.h>
 
 static constexpr auto unit_tests_api_table = sort(create_array_t<sym_entry>(
     API_METHOD(resource_manifest_reader_alloc, ResourceManifestReader*, (Storage*)),
@@ -38,4 +41,31 @@ static constexpr auto unit_tests_api_table = sort(create_array_t<sym_entry>(
         JsThread*,
         (const char* script_path, JsThreadCallback callback, void* context)),
     API_METHOD(js_thread_stop, void, (JsThread * worker)),
+    API_METHOD(iso15693_parser_alloc, Iso15693Parser*, (const GpioPin*, size_t)),
+    API_METHOD(iso15693_parser_free, void, (Iso15693Parser*)),
+    API_METHOD(iso15693_parser_start, void, (Iso15693Parser*, Iso15693ParserCallback, void*)),
+    API_METHOD(iso15693_parser_stop, void, (Iso15693Parser*)),
+    API_METHOD(iso15693_parser_run, bool, (Iso15693Parser*)),
+    API_METHOD(iso15693_parser_feed, void, (Iso15693Parser*, uint8_t)),
+    API_METHOD(iso15693_parser_get_data, void, (Iso15693Parser*, uint8_t*, size_t, size_t*)),
+    API_METHOD(digital_signal_alloc, DigitalSignal*, (uint32_t)),
+    API_METHOD(digital_signal_free, void, (DigitalSignal*)),
+    API_METHOD(digital_sequence_alloc, DigitalSequence*, (uint32_t, const GpioPin*)),
+    API_METHOD(digital_sequence_free, void, (DigitalSequence*)),
+    API_METHOD(digital_sequence_clear, void, (DigitalSequence*)),
+    API_METHOD(
+        digital_sequence_set_period_callback,
+        void,
+        (DigitalSequence*, DigitalSequencePeriodCallback, void*)),
+    API_METHOD(digital_sequence_cache_alloc, DigitalSequenceCache*, (size_t, size_t, size_t)),
+    API_METHOD(digital_sequence_cache_free, void, (DigitalSequenceCache*)),
+    API_METHOD(digital_sequence_cache_reset, void, (DigitalSequenceCache*)),
+    API_METHOD(
+        digital_sequence_cache_transmit,
+        bool,
+        (DigitalSequenceCache*, DigitalSequence*, const uint8_t*, size_t)),
+    API_METHOD(
+        digital_sequence_cache_transmit_add,
+        void,
+        (DigitalSequenceCache*, DigitalSequence*, const uint8_t*, size_t)),
     API_VARIABLE(PB_Main_msg, PB_Main_msg_t)));
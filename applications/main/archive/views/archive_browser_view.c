@@ -448,6 +448,7 @@ ArchiveBrowserView* browser_alloc(void) {
     browser->scroll_timer = furi_timer_alloc(browser_scroll_timer, FuriTimerTypePeriodic, browser);
 
     browser->path = furi_string_alloc_set(archive_get_default_path(TAB_DEFAULT));
+    browser->catalog = application_catalog_alloc(furi_record_open(RECORD_STORAGE));
 
     with_view_model(
         browser->view,
@@ -478,6 +479,9 @@ void browser_free(ArchiveBrowserView* browser) {
 
     furi_string_free(browser->path);
 
+    application_catalog_free(browser->catalog);
+    furi_record_close(RECORD_STORAGE);
+
     view_free(browser->view);
     free(browser);
 }
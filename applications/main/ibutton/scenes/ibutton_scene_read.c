@@ -19,7 +19,7 @@ void ibutton_scene_read_on_enter(void* context) {
     view_dispatcher_switch_to_view(ibutton->view_dispatcher, iButtonViewPopup);
 
     ibutton_worker_read_set_callback(worker, ibutton_scene_read_callback, ibutton);
-    ibutton_worker_read_start(worker, key);
+    ibutton_worker_read_parallel_start(worker, key);
 
     ibutton_notification_message(ibutton, iButtonNotificationMessageReadStart);
 }
@@ -12,6 +12,8 @@
 #include <toolbox/protocols/protocol_dict.h>
 #include <lfrfid/protocols/lfrfid_protocols.h>
 #include <lfrfid/lfrfid_raw_file.h>
+#include <lfrfid/tools/lfrfid_demod.h>
+#include <toolbox/manchester_block_decoder.h>
 #include <toolbox/pulse_protocols/pulse_glue.h>
 
 static void lfrfid_cli(Cli* cli, FuriString* args, void* context);
@@ -265,6 +267,62 @@ static void lfrfid_cli_emulate(Cli* cli, FuriString* args) {
     protocol_dict_free(dict);
 }
 
+#define LFRFID_CLI_MANCHESTER_PAIRS (64)
+#define LFRFID_CLI_MANCHESTER_BYTES (64)
+
+// Bitstream of an unknown ASK tag, for every common bit rate
+static void lfrfid_cli_raw_analyze_manchester(LFRFIDRawFile* file) {
+    // Half bit periods in us for RF/64, RF/32 and RF/16
+    static const uint32_t half_periods[] = {256, 128, 64};
+
+    LFRFIDRawPair* pairs = malloc(sizeof(LFRFIDRawPair) * LFRFID_CLI_MANCHESTER_PAIRS);
+    LevelDuration* durations = malloc(sizeof(LevelDuration) * LFRFID_CLI_MANCHESTER_PAIRS * 2);
+    ManchesterEvent* events = malloc(sizeof(ManchesterEvent) * LFRFID_CLI_MANCHESTER_PAIRS * 2);
+    ManchesterBlockDecoder* decoder =
+        manchester_block_decoder_alloc(ManchesterBlockCodingManchester);
+    BitBuffer* bits = bit_buffer_alloc(LFRFID_CLI_MANCHESTER_BYTES);
+
+    for(size_t i = 0; i < COUNT_OF(half_periods); i++) {
+        if(!lfrfid_raw_file_seek_pair(file, 0)) break;
+
+        manchester_block_decoder_reset(decoder);
+        manchester_block_decoder_set_clock(decoder, half_periods[i], true);
+        bit_buffer_reset(bits);
+
+        size_t count;
+        while((count = lfrfid_raw_file_read_pairs(file, pairs, LFRFID_CLI_MANCHESTER_PAIRS))) {
+            for(size_t j = 0; j < count; j++) {
+                const uint32_t low = pairs[j].duration > pairs[j].pulse ?
+                                         pairs[j].duration - pairs[j].pulse :
+                                         0;
+                durations[j * 2] = level_duration_make(true, pairs[j].pulse);
+                durations[j * 2 + 1] = level_duration_make(false, low);
+            }
+
+            manchester_block_decoder_classify(decoder, durations, count * 2, events);
+            // Stop once bit buffer is full
+            if(manchester_block_decoder_decode(decoder, events, count * 2, bits) < count * 2) {
+                break;
+            }
+        }
+
+        printf(
+            "Manchester RF/%lu, %u bits: ",
+            half_periods[i] / 4,
+            (unsigned int)bit_buffer_get_size(bits));
+        for(size_t j = 0; j < bit_buffer_get_size_bytes(bits); j++) {
+            printf("%02X", bit_buffer_get_byte(bits, j));
+        }
+        printf("\r\n");
+    }
+
+    bit_buffer_free(bits);
+    manchester_block_decoder_free(decoder);
+    free(events);
+    free(durations);
+    free(pairs);
+}
+
 static void lfrfid_cli_raw_analyze(Cli* cli, FuriString* args) {
     UNUSED(cli);
     FuriString *filepath, *info_string;
@@ -300,6 +358,7 @@ static void lfrfid_cli_raw_analyze(Cli* cli, FuriString* args) {
 
         ProtocolDict* dict = protocol_dict_alloc(lfrfid_protocols, LFRFIDProtocolMax);
         protocol_dict_decoders_start(dict);
+        LFRFIDDemod* demod = lfrfid_demod_alloc();
 
         while(!file_end) {
             uint32_t pulse = 0;
@@ -322,10 +381,12 @@ static void lfrfid_cli_raw_analyze(Cli* cli, FuriString* args) {
                 }
 
                 if(total_protocol == PROTOCOL_NO) {
-                    total_protocol = protocol_dict_decoders_feed(dict, true, pulse);
+                    const LFRFIDSymbol* symbol = lfrfid_demod_feed(demod, true, pulse);
+                    total_protocol = protocol_dict_decoders_feed_symbol(dict, true, pulse, symbol);
                     if(total_protocol == PROTOCOL_NO) {
-                        total_protocol =
-                            protocol_dict_decoders_feed(dict, false, duration - pulse);
+                        symbol = lfrfid_demod_feed(demod, false, duration - pulse);
+                        total_protocol = protocol_dict_decoders_feed_symbol(
+                            dict, false, duration - pulse, symbol);
                     }
 
                     if(total_protocol != PROTOCOL_NO) {
@@ -375,8 +436,10 @@ static void lfrfid_cli_raw_analyze(Cli* cli, FuriString* args) {
             free(data);
         } else {
             printf("not found\r\n");
+            lfrfid_cli_raw_analyze_manchester(file);
         }
 
+        lfrfid_demod_free(demod);
         protocol_dict_free(dict);
     } while(false);
 
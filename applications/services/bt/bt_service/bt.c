@@ -198,6 +198,8 @@ static uint16_t bt_serial_event_callback(SerialServiceEvent event, void* context
                 TAG, "Only %zu of %u bytes processed by RPC", bytes_processed, event.data.size);
         }
         ret = rpc_session_get_available_size(bt->rpc_session);
+    } else if(event.event == SerialServiceEventTypeFreeSizeRequest) {
+        ret = rpc_session_get_available_size(bt->rpc_session);
     } else if(event.event == SerialServiceEventTypeDataSent) {
         furi_event_flag_set(bt->rpc_event, BT_RPC_EVENT_BUFF_SENT);
     } else if(event.event == SerialServiceEventTypesBleResetRequest) {
@@ -223,15 +225,26 @@ static void bt_rpc_send_bytes_callback(void* context, uint8_t* bytes, size_t byt
         return;
     }
     furi_event_flag_clear(bt->rpc_event, BT_RPC_EVENT_ALL & (~BT_RPC_EVENT_DISCONNECTED));
+    const bool is_windowed = ble_profile_serial_get_tx_mode(bt->current_profile) ==
+                             SerialServiceTxModeNotification;
     size_t bytes_sent = 0;
     while(bytes_sent < bytes_len) {
-        size_t bytes_remain = bytes_len - bytes_sent;
-        if(bytes_remain > bt->max_packet_size) {
-            ble_profile_serial_tx(bt->current_profile, &bytes[bytes_sent], bt->max_packet_size);
-            bytes_sent += bt->max_packet_size;
+        size_t packet_size = MIN(bytes_len - bytes_sent, bt->max_packet_size);
+        SerialServiceTxStatus status =
+            ble_profile_serial_tx_ex(bt->current_profile, &bytes[bytes_sent], packet_size);
+        if(is_windowed) {
+            // Keep sending until the stack is out of buffers, then retry once it has some
+            if(status == SerialServiceTxStatusOk) {
+                bytes_sent += packet_size;
+                continue;
+            } else if(status == SerialServiceTxStatusError) {
+                // Nothing is in flight, so no DataSent event would wake us up
+                FURI_LOG_E(TAG, "Failed to send %zu bytes, dropping", packet_size);
+                bytes_sent += packet_size;
+                continue;
+            }
         } else {
-            ble_profile_serial_tx(bt->current_profile, &bytes[bytes_sent], bytes_remain);
-            bytes_sent += bytes_remain;
+            bytes_sent += packet_size;
         }
         // We want BT_RPC_EVENT_DISCONNECTED to stick, so don't clear
         uint32_t event_flag = furi_event_flag_wait(
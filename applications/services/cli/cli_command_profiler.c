@@ -0,0 +1,187 @@
+#include "cli_command_profiler.h"
+
+#include <furi.h>
+#include <lib/toolbox/args.h>
+
+#define PROFILER_MAGIC            (0x5054U) // "TP", little endian
+#define PROFILER_INTERVAL_DEFAULT (250)
+#define PROFILER_INTERVAL_MIN     (10)
+#define PROFILER_WINDOW_SIZE      (8)
+#define PROFILER_THREAD_COUNT_MAX (64)
+#define PROFILER_THREAD_NAME_SIZE (16)
+
+/* Binary stream layout, all fields are little endian:
+ * [uint16 frame size][ProfilerFrameHeader][ProfilerFrameThread * thread_count]
+ *
+ * Cycle counters come from DWT CYCCNT, the same source FreeRTOS uses for run time stats.
+ */
+
+typedef struct FURI_PACKED {
+    uint16_t magic;
+    uint8_t version;
+    uint8_t thread_count;
+    uint32_t tick; /**< System tick when sample was taken */
+    uint32_t cycles; /**< CPU cycles since previous sample */
+    uint32_t isr_cycles; /**< CPU cycles spent in ISR since previous sample */
+    uint32_t window_cycles; /**< CPU cycles in the sliding window */
+    uint32_t heap_free; /**< Free heap size */
+} ProfilerFrameHeader;
+
+typedef struct FURI_PACKED {
+    uint32_t id; /**< Thread id, stable while thread is running */
+    uint32_t cycles; /**< Thread CPU cycles since previous sample */
+    uint32_t window_cycles; /**< Thread CPU cycles in the sliding window */
+    uint16_t context_switches; /**< Context switches since previous sample */
+    uint16_t stack_min_free; /**< Stack headroom in bytes */
+    uint8_t priority;
+    char app_id[PROFILER_THREAD_NAME_SIZE]; /**< Not null terminated if truncated */
+    char name[PROFILER_THREAD_NAME_SIZE]; /**< Not null terminated if truncated */
+} ProfilerFrameThread;
+
+typedef struct {
+    FuriThread* thread;
+    uint32_t tick;
+    uint32_t cycles[PROFILER_WINDOW_SIZE];
+} ProfilerThreadWindow;
+
+typedef struct {
+    FuriThreadList* thread_list;
+    size_t position;
+    uint32_t cycles[PROFILER_WINDOW_SIZE];
+    ProfilerThreadWindow windows[PROFILER_THREAD_COUNT_MAX];
+    uint8_t frame
+        [sizeof(uint16_t) + sizeof(ProfilerFrameHeader) +
+         sizeof(ProfilerFrameThread) * PROFILER_THREAD_COUNT_MAX];
+} Profiler;
+
+static uint32_t profiler_window_sum(const uint32_t* cycles) {
+    uint32_t sum = 0;
+    for(size_t i = 0; i < PROFILER_WINDOW_SIZE; i++) {
+        sum += cycles[i];
+    }
+    return sum;
+}
+
+static ProfilerThreadWindow* profiler_get_window(Profiler* profiler, FuriThread* thread) {
+    ProfilerThreadWindow* free_window = NULL;
+
+    for(size_t i = 0; i < PROFILER_THREAD_COUNT_MAX; i++) {
+        ProfilerThreadWindow* window = &profiler->windows[i];
+        if(window->thread == thread) {
+            return window;
+        } else if(!window->thread && !free_window) {
+            free_window = window;
+        }
+    }
+
+    if(free_window) {
+        memset(free_window, 0, sizeof(ProfilerThreadWindow));
+        free_window->thread = thread;
+    }
+
+    return free_window;
+}
+
+static size_t profiler_sample(Profiler* profiler) {
+    const uint32_t tick = furi_get_tick();
+    furi_thread_enumerate(profiler->thread_list);
+
+    ProfilerFrameHeader* header = (ProfilerFrameHeader*)&profiler->frame[sizeof(uint16_t)];
+    ProfilerFrameThread* threads = (ProfilerFrameThread*)&header[1];
+
+    const size_t thread_count =
+        MIN(furi_thread_list_size(profiler->thread_list), (size_t)PROFILER_THREAD_COUNT_MAX);
+
+    uint32_t cycles = 0;
+    for(size_t i = 0; i < thread_count; i++) {
+        const FuriThreadListItem* item = furi_thread_list_get_at(profiler->thread_list, i);
+        ProfilerThreadWindow* window = profiler_get_window(profiler, item->thread);
+        furi_check(window);
+
+        // First enumeration has no previous counter value
+        const uint32_t thread_cycles =
+            item->counter_previous ? item->counter_current - item->counter_previous : 0;
+        window->cycles[profiler->position] = thread_cycles;
+        window->tick = tick;
+        cycles += thread_cycles;
+
+        ProfilerFrameThread* thread = &threads[i];
+        thread->id = (uint32_t)item->thread;
+        thread->cycles = thread_cycles;
+        thread->window_cycles = profiler_window_sum(window->cycles);
+        thread->context_switches = MIN(item->context_switches, (uint32_t)UINT16_MAX);
+        thread->stack_min_free = MIN(item->stack_min_free, (uint32_t)UINT16_MAX);
+        thread->priority = item->priority;
+        strncpy(thread->app_id, item->app_id ? item->app_id : "", PROFILER_THREAD_NAME_SIZE);
+        strncpy(thread->name, item->name ? item->name : "", PROFILER_THREAD_NAME_SIZE);
+    }
+
+    // Forget threads that are gone
+    for(size_t i = 0; i < PROFILER_THREAD_COUNT_MAX; i++) {
+        if(profiler->windows[i].tick != tick) {
+            profiler->windows[i].thread = NULL;
+        }
+    }
+
+    profiler->cycles[profiler->position] = cycles;
+    profiler->position = (profiler->position + 1) % PROFILER_WINDOW_SIZE;
+
+    header->magic = PROFILER_MAGIC;
+    header->version = CLI_PROFILER_FORMAT_VERSION;
+    header->thread_count = thread_count;
+    header->tick = tick;
+    header->cycles = cycles;
+    header->isr_cycles =
+        (uint32_t)(furi_thread_list_get_isr_time(profiler->thread_list) * (float)cycles);
+    header->window_cycles = profiler_window_sum(profiler->cycles);
+    header->heap_free = memmgr_get_free_heap();
+
+    const uint16_t frame_size =
+        sizeof(ProfilerFrameHeader) + sizeof(ProfilerFrameThread) * thread_count;
+    memcpy(profiler->frame, &frame_size, sizeof(uint16_t));
+
+    return sizeof(uint16_t) + frame_size;
+}
+
+/** Profiler Command
+ *
+ * Streams binary thread runtime samples until interrupted.
+ * Intended to be used with scripts/profiler.py
+ *
+ * Arguments:
+ * - interval - sampling interval in ms
+ */
+void cli_command_profiler(Cli* cli, FuriString* args, void* context) {
+    UNUSED(context);
+
+    int interval = PROFILER_INTERVAL_DEFAULT;
+    args_read_int_and_trim(args, &interval);
+    if(interval < PROFILER_INTERVAL_MIN) {
+        printf("Interval must be at least %dms\r\n", PROFILER_INTERVAL_MIN);
+        return;
+    }
+
+    Profiler* profiler = malloc(sizeof(Profiler));
+    profiler->thread_list = furi_thread_list_alloc();
+
+    printf("Profiler v%d, ctrl-c to stop\r\n", CLI_PROFILER_FORMAT_VERSION);
+    fflush(stdout);
+
+    uint32_t tick = furi_get_tick();
+    while(!cli_cmd_interrupt_received(cli)) {
+        const size_t size = profiler_sample(profiler);
+        cli_write(cli, profiler->frame, size);
+
+        tick += furi_ms_to_ticks(interval);
+        const uint32_t now = furi_get_tick();
+        if((int32_t)(tick - now) > 0) {
+            furi_delay_tick(tick - now);
+        } else {
+            // Host is not keeping up, skip missed samples
+            tick = now;
+        }
+    }
+
+    furi_thread_list_free(profiler->thread_list);
+    free(profiler);
+}
@@ -0,0 +1,8 @@
+#pragma once
+
+#include "cli_i.h"
+
+/** Profiler stream format version, see scripts/profiler.py */
+#define CLI_PROFILER_FORMAT_VERSION (1)
+
+void cli_command_profiler(Cli* cli, FuriString* args, void* context);
@@ -29,6 +29,23 @@ extern "C" {
  */
 #define EXPANSION_PROTOCOL_MAX_DATA_SIZE (64U)
 
+/**
+ * @brief Maximum data size per bulk data frame, in bytes.
+ *
+ * Modules short on memory may define a smaller value before including this file
+ * and announce it during the bulk mode negotiation.
+ */
+#ifndef EXPANSION_PROTOCOL_MAX_BULK_DATA_SIZE
+#define EXPANSION_PROTOCOL_MAX_BULK_DATA_SIZE (256U)
+#endif
+
+/**
+ * @brief Maximum number of unacknowledged bulk data frames in either direction.
+ *
+ * Must stay below half of the sequence number range.
+ */
+#define EXPANSION_PROTOCOL_MAX_BULK_WINDOW_SIZE (16U)
+
 /**
  * @brief Maximum allowed inactivity period, in milliseconds.
  */
@@ -48,6 +65,9 @@ typedef enum {
     ExpansionFrameTypeBaudRate = 3, /**< Baud rate negotiation frame. */
     ExpansionFrameTypeControl = 4, /**< Control frame. */
     ExpansionFrameTypeData = 5, /**< Data frame. */
+    ExpansionFrameTypeBulkSetup = 6, /**< Bulk mode negotiation frame. */
+    ExpansionFrameTypeBulkData = 7, /**< Bulk data frame. */
+    ExpansionFrameTypeBulkAck = 8, /**< Bulk data acknowledgement frame. */
     ExpansionFrameTypeReserved, /**< Special value. */
 } ExpansionFrameType;
 
@@ -135,6 +155,39 @@ typedef struct {
     uint8_t bytes[EXPANSION_PROTOCOL_MAX_DATA_SIZE];
 } ExpansionFrameData;
 
+/**
+ * @brief Bulk mode negotiation frame contents.
+ *
+ * Each side announces what it is able to receive. Zero values are not allowed.
+ */
+typedef struct {
+    /** Largest bulk data frame size the sender can receive, in bytes. */
+    uint16_t max_data_size;
+    /** Number of bulk data frames the sender can receive without acknowledging them. */
+    uint8_t window_size;
+} ExpansionFrameBulkSetup;
+
+/**
+ * @brief Bulk data frame contents.
+ *
+ * The data bytes follow the contents and are kept in a separate buffer,
+ * see expansion_protocol_encode_bulk() and expansion_protocol_decode_bulk().
+ */
+typedef struct {
+    /** Sequence number, incremented by one (modulo 256) with each bulk data frame. */
+    uint8_t seq;
+    /** Size of the data. Must not exceed the size negotiated for the receiving side. */
+    uint16_t size;
+} ExpansionFrameBulkData;
+
+/**
+ * @brief Bulk data acknowledgement frame contents.
+ */
+typedef struct {
+    /** Sequence number of the last bulk data frame received, all preceding ones included. */
+    uint8_t seq;
+} ExpansionFrameBulkAck;
+
 /**
  * @brief Expansion protocol frame structure.
  */
@@ -146,6 +199,9 @@ typedef struct {
         ExpansionFrameBaudRate baud_rate; /**< Baud rate frame contents. */
         ExpansionFrameControl control; /**< Control frame contents. */
         ExpansionFrameData data; /**< Data frame contents. */
+        ExpansionFrameBulkSetup bulk_setup; /**< Bulk mode negotiation frame contents. */
+        ExpansionFrameBulkData bulk_data; /**< Bulk data frame contents. */
+        ExpansionFrameBulkAck bulk_ack; /**< Bulk data acknowledgement frame contents. */
     } content; /**< Contents of the frame. */
 } ExpansionFrame;
 
@@ -184,6 +240,7 @@ typedef size_t (*ExpansionFrameSendCallback)(const uint8_t* data, size_t data_si
  * @brief Get encoded frame size.
  *
  * The frame MUST be complete and properly formed.
+ * The data of a bulk data frame is not included.
  *
  * @param[in] frame pointer to the frame to be evaluated.
  * @returns encoded frame size, in bytes.
@@ -200,6 +257,12 @@ static inline size_t expansion_frame_get_encoded_size(const ExpansionFrame* fram
         return sizeof(frame->header) + sizeof(frame->content.control);
     case ExpansionFrameTypeData:
         return sizeof(frame->header) + sizeof(frame->content.data.size) + frame->content.data.size;
+    case ExpansionFrameTypeBulkSetup:
+        return sizeof(frame->header) + sizeof(frame->content.bulk_setup);
+    case ExpansionFrameTypeBulkData:
+        return sizeof(frame->header) + sizeof(frame->content.bulk_data);
+    case ExpansionFrameTypeBulkAck:
+        return sizeof(frame->header) + sizeof(frame->content.bulk_ack);
     default:
         return 0;
     }
@@ -253,6 +316,16 @@ static inline bool expansion_frame_get_remaining_size(
             content_size = sizeof(frame->content.data.size) + frame->content.data.size;
         }
         break;
+    case ExpansionFrameTypeBulkSetup:
+        content_size = sizeof(frame->content.bulk_setup);
+        break;
+    case ExpansionFrameTypeBulkData:
+        // Data is received separately, see expansion_protocol_decode_bulk()
+        content_size = sizeof(frame->content.bulk_data);
+        break;
+    case ExpansionFrameTypeBulkAck:
+        content_size = sizeof(frame->content.bulk_ack);
+        break;
     default:
         return false;
     }
@@ -295,17 +368,21 @@ static inline ExpansionFrameChecksum
 }
 
 /**
- * @brief Receive and decode a frame.
+ * @brief Receive and decode a frame, including the data of a bulk data frame.
  *
  * Will repeatedly call the receive callback function until enough data is received.
  *
  * @param[out] frame pointer to the frame to contain decoded data.
+ * @param[out] bulk_data pointer to the buffer to contain bulk data, may be NULL if bulk_data_size is 0.
+ * @param[in] bulk_data_size bulk data buffer capacity, larger bulk data frames are rejected.
  * @param[in] receive pointer to the function used to receive data.
  * @param[in,out] context pointer to a user-defined context object. Will be passed to the receive callback function.
  * @returns ExpansionProtocolStatusOk on success, any other error code on failure.
  */
-static inline ExpansionProtocolStatus expansion_protocol_decode(
+static inline ExpansionProtocolStatus expansion_protocol_decode_bulk(
     ExpansionFrame* frame,
+    uint8_t* bulk_data,
+    size_t bulk_data_size,
     ExpansionFrameReceiveCallback receive,
     void* context) {
     size_t total_size = 0;
@@ -328,12 +405,36 @@ static inline ExpansionProtocolStatus expansion_protocol_decode(
         total_size += received_size;
     }
 
+    ExpansionFrameChecksum expected_checksum =
+        expansion_protocol_get_checksum((const uint8_t*)frame, total_size);
+
+    if(frame->header.type == ExpansionFrameTypeBulkData) {
+        const size_t data_size = frame->content.bulk_data.size;
+
+        if(data_size > bulk_data_size) {
+            return ExpansionProtocolStatusErrorFormat;
+        }
+
+        for(size_t data_received = 0; data_received < data_size;) {
+            const size_t received_size =
+                receive(bulk_data + data_received, data_size - data_received, context);
+
+            if(received_size == 0) {
+                return ExpansionProtocolStatusErrorCommunication;
+            }
+
+            data_received += received_size;
+        }
+
+        expected_checksum ^= expansion_protocol_get_checksum(bulk_data, data_size);
+    }
+
     ExpansionFrameChecksum checksum;
     const size_t received_size = receive(&checksum, sizeof(checksum), context);
 
     if(received_size != sizeof(checksum)) {
         return ExpansionProtocolStatusErrorCommunication;
-    } else if(checksum != expansion_protocol_get_checksum((const uint8_t*)frame, total_size)) {
+    } else if(checksum != expected_checksum) {
         return ExpansionProtocolStatusErrorChecksum;
     } else {
         return ExpansionProtocolStatusOk;
@@ -341,15 +442,35 @@ static inline ExpansionProtocolStatus expansion_protocol_decode(
 }
 
 /**
- * @brief Encode and send a frame.
+ * @brief Receive and decode a frame.
+ *
+ * Will repeatedly call the receive callback function until enough data is received.
+ * Bulk data frames carrying any data are rejected, see expansion_protocol_decode_bulk().
+ *
+ * @param[out] frame pointer to the frame to contain decoded data.
+ * @param[in] receive pointer to the function used to receive data.
+ * @param[in,out] context pointer to a user-defined context object. Will be passed to the receive callback function.
+ * @returns ExpansionProtocolStatusOk on success, any other error code on failure.
+ */
+static inline ExpansionProtocolStatus expansion_protocol_decode(
+    ExpansionFrame* frame,
+    ExpansionFrameReceiveCallback receive,
+    void* context) {
+    return expansion_protocol_decode_bulk(frame, NULL, 0, receive, context);
+}
+
+/**
+ * @brief Encode and send a frame, including the data of a bulk data frame.
  *
  * @param[in] frame pointer to the frame to be encoded and sent.
+ * @param[in] bulk_data pointer to the bulk data, ExpansionFrameBulkData::size bytes long. May be NULL for other frame types.
  * @param[in] send pointer to the function used to send data.
  * @param[in,out] context pointer to a user-defined context object. Will be passed to the send callback function.
  * @returns ExpansionProtocolStatusOk on success, any other error code on failure.
  */
-static inline ExpansionProtocolStatus expansion_protocol_encode(
+static inline ExpansionProtocolStatus expansion_protocol_encode_bulk(
     const ExpansionFrame* frame,
+    const uint8_t* bulk_data,
     ExpansionFrameSendCallback send,
     void* context) {
     const size_t encoded_size = expansion_frame_get_encoded_size(frame);
@@ -357,10 +478,18 @@ static inline ExpansionProtocolStatus expansion_protocol_encode(
         return ExpansionProtocolStatusErrorFormat;
     }
 
+    const size_t data_size =
+        frame->header.type == ExpansionFrameTypeBulkData ? frame->content.bulk_data.size : 0;
+    if(data_size != 0 && bulk_data == NULL) {
+        return ExpansionProtocolStatusErrorFormat;
+    }
+
     const ExpansionFrameChecksum checksum =
-        expansion_protocol_get_checksum((const uint8_t*)frame, encoded_size);
+        expansion_protocol_get_checksum((const uint8_t*)frame, encoded_size) ^
+        expansion_protocol_get_checksum(bulk_data, data_size);
 
     if((send((const uint8_t*)frame, encoded_size, context) != encoded_size) ||
+       (data_size != 0 && send(bulk_data, data_size, context) != data_size) ||
        (send(&checksum, sizeof(checksum), context) != sizeof(checksum))) {
         return ExpansionProtocolStatusErrorCommunication;
     } else {
@@ -368,6 +497,23 @@ static inline ExpansionProtocolStatus expansion_protocol_encode(
     }
 }
 
+/**
+ * @brief Encode and send a frame.
+ *
+ * Bulk data frames carrying any data are rejected, see expansion_protocol_encode_bulk().
+ *
+ * @param[in] frame pointer to the frame to be encoded and sent.
+ * @param[in] send pointer to the function used to send data.
+ * @param[in,out] context pointer to a user-defined context object. Will be passed to the send callback function.
+ * @returns ExpansionProtocolStatusOk on success, any other error code on failure.
+ */
+static inline ExpansionProtocolStatus expansion_protocol_encode(
+    const ExpansionFrame* frame,
+    ExpansionFrameSendCallback send,
+    void* context) {
+    return expansion_protocol_encode_bulk(frame, NULL, send, context);
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -12,7 +12,11 @@
 #define TAG "ExpansionSrv"
 
 #define EXPANSION_WORKER_STACK_SZIE  (768UL)
-#define EXPANSION_WORKER_BUFFER_SIZE (sizeof(ExpansionFrame) + sizeof(ExpansionFrameChecksum))
+#define EXPANSION_WORKER_FRAME_SIZE                                   \
+    (sizeof(ExpansionFrame) + EXPANSION_PROTOCOL_MAX_BULK_DATA_SIZE + \
+     sizeof(ExpansionFrameChecksum))
+#define EXPANSION_WORKER_BULK_WINDOW (4U)
+#define EXPANSION_WORKER_BUFFER_SIZE (EXPANSION_WORKER_FRAME_SIZE * EXPANSION_WORKER_BULK_WINDOW)
 
 typedef enum {
     ExpansionWorkerStateHandShake,
@@ -39,12 +43,26 @@ struct ExpansionWorker {
     FuriThread* thread;
     FuriStreamBuffer* rx_buf;
     FuriSemaphore* tx_semaphore;
+    FuriMutex* tx_mutex;
 
     FuriHalSerialId serial_id;
     FuriHalSerialHandle* serial_handle;
 
     RpcSession* rpc_session;
 
+    ExpansionFrame rx_frame;
+    ExpansionFrame tx_frame;
+    // Bulk payload is received here, it is too large for the thread stack
+    uint8_t rx_bulk_data[EXPANSION_PROTOCOL_MAX_BULK_DATA_SIZE];
+
+    // Bulk mode: module receive limits, zero if not negotiated
+    uint16_t bulk_tx_size;
+    uint8_t bulk_tx_window;
+    uint8_t tx_seq;
+    uint8_t tx_acked_seq;
+    uint8_t rx_seq;
+    uint8_t rx_unacked_count;
+
     ExpansionWorkerState state;
     ExpansionWorkerExitReason exit_reason;
     ExpansionWorkerCallback callback;
@@ -115,8 +133,12 @@ static size_t expansion_worker_receive_callback(uint8_t* data, size_t data_size,
 
 static inline bool
     expansion_worker_receive_frame(ExpansionWorker* instance, ExpansionFrame* frame) {
-    return expansion_protocol_decode(frame, expansion_worker_receive_callback, instance) ==
-           ExpansionProtocolStatusOk;
+    return expansion_protocol_decode_bulk(
+               frame,
+               instance->rx_bulk_data,
+               sizeof(instance->rx_bulk_data),
+               expansion_worker_receive_callback,
+               instance) == ExpansionProtocolStatusOk;
 }
 
 static size_t
@@ -127,50 +149,84 @@ static size_t
     return data_size;
 }
 
-static inline bool
-    expansion_worker_send_frame(ExpansionWorker* instance, const ExpansionFrame* frame) {
-    return expansion_protocol_encode(frame, expansion_worker_send_callback, instance) ==
-           ExpansionProtocolStatusOk;
+// Worker and Rpc session threads both send frames, the mutex is held until the frame is sent
+static ExpansionFrame* expansion_worker_tx_frame_begin(ExpansionWorker* instance, uint8_t type) {
+    furi_check(furi_mutex_acquire(instance->tx_mutex, FuriWaitForever) == FuriStatusOk);
+    instance->tx_frame.header.type = type;
+    return &instance->tx_frame;
 }
 
-static bool expansion_worker_send_heartbeat(ExpansionWorker* instance) {
-    const ExpansionFrame frame = {
-        .header.type = ExpansionFrameTypeHeartbeat,
-        .content.heartbeat = {},
-    };
+static bool
+    expansion_worker_tx_frame_end_bulk(ExpansionWorker* instance, const uint8_t* bulk_data) {
+    const bool success = expansion_protocol_encode_bulk(
+                             &instance->tx_frame,
+                             bulk_data,
+                             expansion_worker_send_callback,
+                             instance) == ExpansionProtocolStatusOk;
+    furi_check(furi_mutex_release(instance->tx_mutex) == FuriStatusOk);
+    return success;
+}
 
-    return expansion_worker_send_frame(instance, &frame);
+static inline bool expansion_worker_tx_frame_end(ExpansionWorker* instance) {
+    return expansion_worker_tx_frame_end_bulk(instance, NULL);
+}
+
+static bool expansion_worker_send_heartbeat(ExpansionWorker* instance) {
+    expansion_worker_tx_frame_begin(instance, ExpansionFrameTypeHeartbeat);
+    return expansion_worker_tx_frame_end(instance);
 }
 
 static bool
     expansion_worker_send_status_response(ExpansionWorker* instance, ExpansionFrameError error) {
-    const ExpansionFrame frame = {
-        .header.type = ExpansionFrameTypeStatus,
-        .content.status.error = error,
-    };
+    ExpansionFrame* frame = expansion_worker_tx_frame_begin(instance, ExpansionFrameTypeStatus);
+    frame->content.status.error = error;
+    return expansion_worker_tx_frame_end(instance);
+}
 
-    return expansion_worker_send_frame(instance, &frame);
+static bool expansion_worker_send_bulk_setup_response(ExpansionWorker* instance) {
+    ExpansionFrame* frame = expansion_worker_tx_frame_begin(instance, ExpansionFrameTypeBulkSetup);
+    frame->content.bulk_setup.max_data_size = EXPANSION_PROTOCOL_MAX_BULK_DATA_SIZE;
+    frame->content.bulk_setup.window_size = EXPANSION_WORKER_BULK_WINDOW;
+    return expansion_worker_tx_frame_end(instance);
+}
+
+static bool expansion_worker_send_bulk_ack(ExpansionWorker* instance, uint8_t seq) {
+    ExpansionFrame* frame = expansion_worker_tx_frame_begin(instance, ExpansionFrameTypeBulkAck);
+    frame->content.bulk_ack.seq = seq;
+    return expansion_worker_tx_frame_end(instance);
 }
 
 static bool expansion_worker_send_data_response(
     ExpansionWorker* instance,
     const uint8_t* data,
     size_t data_size) {
-    furi_assert(data_size <= EXPANSION_PROTOCOL_MAX_DATA_SIZE);
-
-    ExpansionFrame frame = {
-        .header.type = ExpansionFrameTypeData,
-        .content.data.size = data_size,
-    };
-
-    memcpy(frame.content.data.bytes, data, data_size);
-    return expansion_worker_send_frame(instance, &frame);
+    ExpansionFrame* frame;
+
+    if(instance->bulk_tx_window) {
+        furi_assert(data_size <= instance->bulk_tx_size);
+        frame = expansion_worker_tx_frame_begin(instance, ExpansionFrameTypeBulkData);
+        // Sequence number advances before sending, an acknowledgement may arrive right after
+        frame->content.bulk_data.seq = instance->tx_seq++;
+        frame->content.bulk_data.size = data_size;
+        // Data is sent straight from the Rpc buffer
+        return expansion_worker_tx_frame_end_bulk(instance, data);
+    } else {
+        furi_assert(data_size <= EXPANSION_PROTOCOL_MAX_DATA_SIZE);
+        frame = expansion_worker_tx_frame_begin(instance, ExpansionFrameTypeData);
+        frame->content.data.size = data_size;
+        memcpy(frame->content.data.bytes, data, data_size);
+        return expansion_worker_tx_frame_end(instance);
+    }
 }
 
 // Called in Rpc session thread context
 static void expansion_worker_rpc_send_callback(void* context, uint8_t* data, size_t data_size) {
     ExpansionWorker* instance = context;
 
+    // Semaphore holds one slot per frame the module can take without acknowledging it
+    const size_t max_data_size = instance->bulk_tx_window ? instance->bulk_tx_size :
+                                                            EXPANSION_PROTOCOL_MAX_DATA_SIZE;
+
     for(size_t sent_data_size = 0; sent_data_size < data_size;) {
         if(furi_semaphore_acquire(
                instance->tx_semaphore, furi_ms_to_ticks(EXPANSION_PROTOCOL_TIMEOUT_MS)) !=
@@ -179,8 +235,7 @@ static void expansion_worker_rpc_send_callback(void* context, uint8_t* data, siz
             break;
         }
 
-        const size_t current_data_size =
-            MIN(data_size - sent_data_size, EXPANSION_PROTOCOL_MAX_DATA_SIZE);
+        const size_t current_data_size = MIN(data_size - sent_data_size, max_data_size);
         if(!expansion_worker_send_data_response(instance, data + sent_data_size, current_data_size))
             break;
         sent_data_size += current_data_size;
@@ -192,7 +247,12 @@ static bool expansion_worker_rpc_session_open(ExpansionWorker* instance) {
     instance->rpc_session = rpc_session_open(rpc, RpcOwnerUart);
 
     if(instance->rpc_session) {
-        instance->tx_semaphore = furi_semaphore_alloc(1, 1);
+        const uint32_t window = instance->bulk_tx_window ? instance->bulk_tx_window : 1;
+        instance->tx_semaphore = furi_semaphore_alloc(window, window);
+        instance->tx_seq = 0;
+        instance->tx_acked_seq = 0;
+        instance->rx_seq = 0;
+        instance->rx_unacked_count = 0;
         rpc_session_set_context(instance->rpc_session, instance);
         rpc_session_set_send_bytes_callback(
             instance->rpc_session, expansion_worker_rpc_send_callback);
@@ -210,13 +270,12 @@ static void expansion_worker_rpc_session_close(ExpansionWorker* instance) {
     furi_record_close(RECORD_RPC);
 }
 
-static bool expansion_worker_handle_state_handshake(
+static bool expansion_worker_handle_baud_rate(
     ExpansionWorker* instance,
     const ExpansionFrame* rx_frame) {
     bool success = false;
 
     do {
-        if(rx_frame->header.type != ExpansionFrameTypeBaudRate) break;
         const uint32_t baud_rate = rx_frame->content.baud_rate.baud;
 
         FURI_LOG_D(TAG, "Proposed baud rate: %lu", baud_rate);
@@ -238,6 +297,32 @@ static bool expansion_worker_handle_state_handshake(
     return success;
 }
 
+static bool expansion_worker_handle_bulk_setup(
+    ExpansionWorker* instance,
+    const ExpansionFrame* rx_frame) {
+    const uint16_t max_data_size = rx_frame->content.bulk_setup.max_data_size;
+    const uint8_t window_size = rx_frame->content.bulk_setup.window_size;
+
+    FURI_LOG_D(TAG, "Proposed bulk mode: %u bytes, %u frames", max_data_size, window_size);
+
+    if(max_data_size == 0 || window_size == 0) {
+        instance->bulk_tx_window = 0;
+        return expansion_worker_send_status_response(instance, ExpansionFrameErrorUnknown);
+    }
+
+    instance->bulk_tx_size = MIN(max_data_size, EXPANSION_PROTOCOL_MAX_BULK_DATA_SIZE);
+    instance->bulk_tx_window = MIN(window_size, EXPANSION_PROTOCOL_MAX_BULK_WINDOW_SIZE);
+
+    return expansion_worker_send_bulk_setup_response(instance);
+}
+
+static bool expansion_worker_handle_state_handshake(
+    ExpansionWorker* instance,
+    const ExpansionFrame* rx_frame) {
+    if(rx_frame->header.type != ExpansionFrameTypeBaudRate) return false;
+    return expansion_worker_handle_baud_rate(instance, rx_frame);
+}
+
 static bool expansion_worker_handle_state_connected(
     ExpansionWorker* instance,
     const ExpansionFrame* rx_frame) {
@@ -262,6 +347,13 @@ static bool expansion_worker_handle_state_connected(
         } else if(rx_frame->header.type == ExpansionFrameTypeHeartbeat) {
             if(!expansion_worker_send_heartbeat(instance)) break;
 
+        } else if(rx_frame->header.type == ExpansionFrameTypeBulkSetup) {
+            if(!expansion_worker_handle_bulk_setup(instance, rx_frame)) break;
+
+        } else if(rx_frame->header.type == ExpansionFrameTypeBaudRate) {
+            // Baud rate step-up, e.g. after bulk mode has been negotiated
+            if(!expansion_worker_handle_baud_rate(instance, rx_frame)) break;
+
         } else {
             break;
         }
@@ -271,6 +363,54 @@ static bool expansion_worker_handle_state_connected(
     return success;
 }
 
+static bool expansion_worker_handle_bulk_data(
+    ExpansionWorker* instance,
+    const ExpansionFrame* rx_frame) {
+    bool success = false;
+
+    do {
+        if(!instance->bulk_tx_window) break;
+        if(rx_frame->content.bulk_data.seq != instance->rx_seq) break;
+
+        // Only the data accepted by Rpc is acknowledged
+        const size_t size_consumed = rpc_session_feed(
+            instance->rpc_session,
+            instance->rx_bulk_data,
+            rx_frame->content.bulk_data.size,
+            EXPANSION_PROTOCOL_TIMEOUT_MS);
+        if(size_consumed != rx_frame->content.bulk_data.size) break;
+
+        // Acknowledge every half window, or as soon as the module stops sending
+        ++instance->rx_seq;
+        if(++instance->rx_unacked_count >= EXPANSION_WORKER_BULK_WINDOW / 2 ||
+           furi_stream_buffer_is_empty(instance->rx_buf)) {
+            if(!expansion_worker_send_bulk_ack(instance, rx_frame->content.bulk_data.seq)) break;
+            instance->rx_unacked_count = 0;
+        }
+
+        success = true;
+    } while(false);
+
+    return success;
+}
+
+static bool expansion_worker_handle_bulk_ack(
+    ExpansionWorker* instance,
+    const ExpansionFrame* rx_frame) {
+    // Cumulative: acknowledges every frame up to and including the given one
+    const uint8_t acked_count = rx_frame->content.bulk_ack.seq + 1U - instance->tx_acked_seq;
+    const uint8_t pending_count = instance->tx_seq - instance->tx_acked_seq;
+
+    if(!instance->bulk_tx_window || acked_count > pending_count) return false;
+
+    for(uint8_t i = 0; i < acked_count; ++i) {
+        furi_semaphore_release(instance->tx_semaphore);
+    }
+
+    instance->tx_acked_seq += acked_count;
+    return true;
+}
+
 static bool expansion_worker_handle_state_rpc_active(
     ExpansionWorker* instance,
     const ExpansionFrame* rx_frame) {
@@ -302,6 +442,12 @@ static bool expansion_worker_handle_state_rpc_active(
             if(rx_frame->content.status.error != ExpansionFrameErrorNone) break;
             furi_semaphore_release(instance->tx_semaphore);
 
+        } else if(rx_frame->header.type == ExpansionFrameTypeBulkData) {
+            if(!expansion_worker_handle_bulk_data(instance, rx_frame)) break;
+
+        } else if(rx_frame->header.type == ExpansionFrameTypeBulkAck) {
+            if(!expansion_worker_handle_bulk_ack(instance, rx_frame)) break;
+
         } else if(rx_frame->header.type == ExpansionFrameTypeHeartbeat) {
             if(!expansion_worker_send_heartbeat(instance)) break;
 
@@ -323,11 +469,11 @@ static const ExpansionWorkerStateHandler expansion_handlers[] = {
 };
 
 static inline void expansion_worker_state_machine(ExpansionWorker* instance) {
-    ExpansionFrame rx_frame;
+    ExpansionFrame* rx_frame = &instance->rx_frame;
 
     while(true) {
-        if(!expansion_worker_receive_frame(instance, &rx_frame)) break;
-        if(!expansion_handlers[instance->state](instance, &rx_frame)) break;
+        if(!expansion_worker_receive_frame(instance, rx_frame)) break;
+        if(!expansion_handlers[instance->state](instance, rx_frame)) break;
     }
 }
 
@@ -344,6 +490,7 @@ static int32_t expansion_worker(void* context) {
 
     instance->state = ExpansionWorkerStateHandShake;
     instance->exit_reason = ExpansionWorkerExitReasonUnknown;
+    instance->bulk_tx_window = 0;
 
     furi_hal_serial_init(instance->serial_handle, EXPANSION_PROTOCOL_DEFAULT_BAUD_RATE);
 
@@ -377,6 +524,7 @@ ExpansionWorker* expansion_worker_alloc(FuriHalSerialId serial_id) {
     instance->thread = furi_thread_alloc_ex(
         TAG "Worker", EXPANSION_WORKER_STACK_SZIE, expansion_worker, instance);
     instance->rx_buf = furi_stream_buffer_alloc(EXPANSION_WORKER_BUFFER_SIZE, 1);
+    instance->tx_mutex = furi_mutex_alloc(FuriMutexTypeNormal);
     instance->serial_id = serial_id;
 
     // Improves responsiveness in heavy games at the expense of dropped frames
@@ -387,6 +535,7 @@ ExpansionWorker* expansion_worker_alloc(FuriHalSerialId serial_id) {
 
 void expansion_worker_free(ExpansionWorker* instance) {
     furi_stream_buffer_free(instance->rx_buf);
+    furi_mutex_free(instance->tx_mutex);
     furi_thread_join(instance->thread);
     furi_thread_free(instance->thread);
     free(instance);
@@ -15,7 +15,8 @@ const CanvasFontParameters canvas_font_params[FontTotalNumber] = {
 
 Canvas* canvas_init(void) {
     Canvas* canvas = malloc(sizeof(Canvas));
-    canvas->compress_icon = compress_icon_alloc(ICON_DECOMPRESSOR_BUFFER_SIZE);
+    canvas->compress_icon =
+        compress_icon_alloc_cached(ICON_DECOMPRESSOR_BUFFER_SIZE, ICON_CACHE_SIZE);
 
     // Initialize mutex
     canvas->mutex = furi_mutex_alloc(FuriMutexTypeNormal);
@@ -23,6 +24,9 @@ Canvas* canvas_init(void) {
     // Initialize callback array
     CanvasCallbackPairArray_init(canvas->canvas_callback_pair);
 
+    // Nothing is known about display content yet
+    canvas->flush_full = true;
+
     // Setup u8g2
     u8g2_Setup_st756x_flipper(&canvas->fb, U8G2_R0, u8x8_hw_spi_stm32, u8g2_gpio_and_delay_stm32);
     canvas->orientation = CanvasOrientationHorizontal;
@@ -31,6 +35,8 @@ Canvas* canvas_init(void) {
     // Wake up display
     u8g2_SetPowerSave(&canvas->fb, 0);
 
+    canvas->flushed_buffer = malloc(canvas_get_buffer_size(canvas));
+
     // Clear buffer and send to device
     canvas_clear(canvas);
     canvas_commit(canvas);
@@ -43,9 +49,27 @@ void canvas_free(Canvas* canvas) {
     compress_icon_free(canvas->compress_icon);
     CanvasCallbackPairArray_clear(canvas->canvas_callback_pair);
     furi_mutex_free(canvas->mutex);
+    free(canvas->flushed_buffer);
     free(canvas);
 }
 
+void canvas_get_icon_cache_stats(Canvas* canvas, CompressIconCacheStats* stats) {
+    furi_check(canvas);
+    compress_icon_get_cache_stats(canvas->compress_icon, stats);
+}
+
+static void canvas_decode_icon(Canvas* canvas, const uint8_t* icon_data, uint8_t** output) {
+    // Cache is keyed by address: only firmware image never changes under it,
+    // icons of loaded applications and animations from SD card live in RAM
+    const size_t address = (size_t)icon_data;
+    if(address >= furi_hal_flash_get_base() &&
+       address < (size_t)furi_hal_flash_get_free_start_address()) {
+        compress_icon_decode_cached(canvas->compress_icon, icon_data, output);
+    } else {
+        compress_icon_decode(canvas->compress_icon, icon_data, output);
+    }
+}
+
 static void canvas_lock(Canvas* canvas) {
     furi_assert(canvas);
     furi_check(furi_mutex_acquire(canvas->mutex, FuriWaitForever) == FuriStatusOk);
@@ -66,19 +90,84 @@ void canvas_reset(Canvas* canvas) {
     canvas_set_font_direction(canvas, CanvasDirectionLeftToRight);
 }
 
+static bool canvas_get_dirty_tiles(Canvas* canvas, CanvasDirtyTiles* tiles) {
+    const uint8_t* buffer = canvas_get_buffer(canvas);
+    bool dirty = false;
+
+    for(size_t row = 0; row < CANVAS_TILE_ROWS; row++) {
+        uint16_t row_tiles = 0;
+        for(size_t column = 0; column < CANVAS_TILE_COLUMNS; column++) {
+            const size_t offset = (row * CANVAS_TILE_COLUMNS + column) * CANVAS_TILE_SIZE;
+            if(memcmp(&buffer[offset], &canvas->flushed_buffer[offset], CANVAS_TILE_SIZE) != 0) {
+                row_tiles |= 1U << column;
+            }
+        }
+        tiles->rows[row] = row_tiles;
+        dirty |= row_tiles != 0;
+    }
+
+    return dirty;
+}
+
+static void canvas_flush_tiles(Canvas* canvas, const CanvasDirtyTiles* tiles) {
+    for(size_t row = 0; row < CANVAS_TILE_ROWS; row++) {
+        // One transfer per run of adjacent tiles, address setup costs more than a few extra bytes
+        uint32_t row_tiles = tiles->rows[row];
+        while(row_tiles) {
+            const uint8_t start = __builtin_ctz(row_tiles);
+            const uint8_t length = __builtin_ctz(~(row_tiles >> start));
+            u8g2_UpdateDisplayArea(&canvas->fb, start, row, length, 1);
+            row_tiles &= ~(((1UL << length) - 1) << start);
+        }
+    }
+}
+
 void canvas_commit(Canvas* canvas) {
     furi_check(canvas);
-    u8g2_SendBuffer(&canvas->fb);
+
+    CanvasDirtyTiles tiles;
+    const bool dirty = canvas_get_dirty_tiles(canvas, &tiles);
+
+    const uint32_t tick = furi_get_tick();
+    if(canvas->flush_full ||
+       (tick - canvas->flush_full_tick) >= furi_ms_to_ticks(CANVAS_FULL_FLUSH_PERIOD_MS)) {
+        canvas->flush_full = false;
+        canvas->flush_full_tick = tick;
+        u8g2_SendBuffer(&canvas->fb);
+    } else if(dirty) {
+        canvas_flush_tiles(canvas, &tiles);
+    }
+
+    memcpy(canvas->flushed_buffer, canvas_get_buffer(canvas), canvas_get_buffer_size(canvas));
 
     // Iterate over callbacks
     canvas_lock(canvas);
+    const CanvasOrientation orientation = canvas_get_orientation(canvas);
+    if(canvas->callbacks_full || canvas->callbacks_orientation != orientation) {
+        canvas->callbacks_full = false;
+        canvas->callbacks_orientation = orientation;
+        memset(tiles.rows, 0xFF, sizeof(tiles.rows));
+    } else if(!dirty) {
+        canvas_unlock(canvas);
+        return;
+    }
+
     for
         M_EACH(p, canvas->canvas_callback_pair, CanvasCallbackPairArray_t) {
-            p->callback(
-                canvas_get_buffer(canvas),
-                canvas_get_buffer_size(canvas),
-                canvas_get_orientation(canvas),
-                p->context);
+            if(p->tiles_callback) {
+                p->tiles_callback(
+                    canvas_get_buffer(canvas),
+                    canvas_get_buffer_size(canvas),
+                    &tiles,
+                    orientation,
+                    p->context);
+            } else {
+                p->callback(
+                    canvas_get_buffer(canvas),
+                    canvas_get_buffer_size(canvas),
+                    orientation,
+                    p->context);
+            }
         }
     canvas_unlock(canvas);
 }
@@ -248,7 +337,7 @@ void canvas_draw_bitmap(
     x += canvas->offset_x;
     y += canvas->offset_y;
     uint8_t* bitmap_data = NULL;
-    compress_icon_decode(canvas->compress_icon, compressed_bitmap_data, &bitmap_data);
+    canvas_decode_icon(canvas, compressed_bitmap_data, &bitmap_data);
     canvas_draw_u8g2_bitmap(&canvas->fb, x, y, width, height, bitmap_data, IconRotation0);
 }
 
@@ -263,8 +352,7 @@ void canvas_draw_icon_animation(
     x += canvas->offset_x;
     y += canvas->offset_y;
     uint8_t* icon_data = NULL;
-    compress_icon_decode(
-        canvas->compress_icon, icon_animation_get_data(icon_animation), &icon_data);
+    canvas_decode_icon(canvas, icon_animation_get_data(icon_animation), &icon_data);
     canvas_draw_u8g2_bitmap(
         &canvas->fb,
         x,
@@ -390,7 +478,7 @@ void canvas_draw_icon_ex(
     x += canvas->offset_x;
     y += canvas->offset_y;
     uint8_t* icon_data = NULL;
-    compress_icon_decode(canvas->compress_icon, icon_get_frame_data(icon, 0), &icon_data);
+    canvas_decode_icon(canvas, icon_get_frame_data(icon, 0), &icon_data);
     canvas_draw_u8g2_bitmap(
         &canvas->fb, x, y, icon_get_width(icon), icon_get_height(icon), icon_data, rotation);
 }
@@ -402,7 +490,7 @@ void canvas_draw_icon(Canvas* canvas, int32_t x, int32_t y, const Icon* icon) {
     x += canvas->offset_x;
     y += canvas->offset_y;
     uint8_t* icon_data = NULL;
-    compress_icon_decode(canvas->compress_icon, icon_get_frame_data(icon, 0), &icon_data);
+    canvas_decode_icon(canvas, icon_get_frame_data(icon, 0), &icon_data);
     canvas_draw_u8g2_bitmap(
         &canvas->fb, x, y, icon_get_width(icon), icon_get_height(icon), icon_data, IconRotation0);
 }
@@ -580,27 +668,57 @@ CanvasOrientation canvas_get_orientation(const Canvas* canvas) {
     return canvas->orientation;
 }
 
-void canvas_add_framebuffer_callback(Canvas* canvas, CanvasCommitCallback callback, void* context) {
-    furi_check(canvas);
-
-    const CanvasCallbackPair p = {callback, context};
-
+static void canvas_add_callback_pair(Canvas* canvas, const CanvasCallbackPair p) {
     canvas_lock(canvas);
     furi_check(!CanvasCallbackPairArray_count(canvas->canvas_callback_pair, p));
     CanvasCallbackPairArray_push_back(canvas->canvas_callback_pair, p);
+    // New subscriber has not seen anything yet
+    canvas->callbacks_full = true;
     canvas_unlock(canvas);
 }
 
+static void canvas_remove_callback_pair(Canvas* canvas, const CanvasCallbackPair p) {
+    canvas_lock(canvas);
+    furi_check(CanvasCallbackPairArray_count(canvas->canvas_callback_pair, p) == 1);
+    CanvasCallbackPairArray_remove_val(canvas->canvas_callback_pair, p);
+    canvas_unlock(canvas);
+}
+
+void canvas_add_framebuffer_callback(Canvas* canvas, CanvasCommitCallback callback, void* context) {
+    furi_check(canvas);
+    furi_check(callback);
+
+    const CanvasCallbackPair p = {.callback = callback, .context = context};
+    canvas_add_callback_pair(canvas, p);
+}
+
 void canvas_remove_framebuffer_callback(
     Canvas* canvas,
     CanvasCommitCallback callback,
     void* context) {
     furi_check(canvas);
 
-    const CanvasCallbackPair p = {callback, context};
+    const CanvasCallbackPair p = {.callback = callback, .context = context};
+    canvas_remove_callback_pair(canvas, p);
+}
 
-    canvas_lock(canvas);
-    furi_check(CanvasCallbackPairArray_count(canvas->canvas_callback_pair, p) == 1);
-    CanvasCallbackPairArray_remove_val(canvas->canvas_callback_pair, p);
-    canvas_unlock(canvas);
+void canvas_add_framebuffer_tiles_callback(
+    Canvas* canvas,
+    CanvasCommitTilesCallback callback,
+    void* context) {
+    furi_check(canvas);
+    furi_check(callback);
+
+    const CanvasCallbackPair p = {.tiles_callback = callback, .context = context};
+    canvas_add_callback_pair(canvas, p);
+}
+
+void canvas_remove_framebuffer_tiles_callback(
+    Canvas* canvas,
+    CanvasCommitTilesCallback callback,
+    void* context) {
+    furi_check(canvas);
+
+    const CanvasCallbackPair p = {.tiles_callback = callback, .context = context};
+    canvas_remove_callback_pair(canvas, p);
 }
@@ -84,13 +84,29 @@ typedef enum {
 /** Canvas anonymous structure */
 typedef struct Canvas Canvas;
 
+/** Framebuffer tile size in pixels and bytes, display is updated in tiles */
+#define CANVAS_TILE_SIZE    (8u)
+/** Framebuffer width in tiles */
+#define CANVAS_TILE_COLUMNS (16u)
+/** Framebuffer height in tiles, one tile row per display page */
+#define CANVAS_TILE_ROWS    (8u)
+
+/** Framebuffer tiles changed by canvas commit
+ *
+ * Bit N of rows[R] marks the tile in column N of row R. Its data are
+ * CANVAS_TILE_SIZE bytes at offset (R * CANVAS_TILE_COLUMNS + N) * CANVAS_TILE_SIZE.
+ */
+typedef struct {
+    uint16_t rows[CANVAS_TILE_ROWS];
+} CanvasDirtyTiles;
+
 /** Reset canvas drawing tools configuration
  *
  * @param      canvas  Canvas instance
  */
 void canvas_reset(Canvas* canvas);
 
-/** Commit canvas. Send buffer to display
+/** Commit canvas. Send changed part of buffer to display
  *
  * @param      canvas  Canvas instance
  */
@@ -13,6 +13,10 @@
 #include <furi.h>
 
 #define ICON_DECOMPRESSOR_BUFFER_SIZE (128u * 64 / 8)
+#define ICON_CACHE_SIZE               (4096u)
+
+/** Period of full display refresh that repairs display RAM if it got corrupted */
+#define CANVAS_FULL_FLUSH_PERIOD_MS (1000u)
 
 #ifdef __cplusplus
 extern "C" {
@@ -24,8 +28,16 @@ typedef void (*CanvasCommitCallback)(
     CanvasOrientation orientation,
     void* context);
 
+typedef void (*CanvasCommitTilesCallback)(
+    const uint8_t* data,
+    size_t size,
+    const CanvasDirtyTiles* tiles,
+    CanvasOrientation orientation,
+    void* context);
+
 typedef struct {
     CanvasCommitCallback callback;
+    CanvasCommitTilesCallback tiles_callback;
     void* context;
 } CanvasCallbackPair;
 
@@ -47,6 +59,11 @@ struct Canvas {
     CompressIcon* compress_icon;
     CanvasCallbackPairArray_t canvas_callback_pair;
     FuriMutex* mutex;
+    uint8_t* flushed_buffer; /**< Framebuffer as it was on last commit */
+    uint32_t flush_full_tick;
+    bool flush_full; /**< Next commit sends whole framebuffer to display */
+    bool callbacks_full; /**< Next commit reports all tiles to callbacks */
+    CanvasOrientation callbacks_orientation;
 };
 
 /** Allocate memory and initialize canvas
@@ -61,6 +78,13 @@ Canvas* canvas_init(void);
  */
 void canvas_free(Canvas* canvas);
 
+/** Get decoded icon cache statistics
+ *
+ * @param      canvas  Canvas instance
+ * @param[out] stats   statistics
+ */
+void canvas_get_icon_cache_stats(Canvas* canvas, CompressIconCacheStats* stats);
+
 /** Get canvas buffer.
  *
  * @param      canvas  Canvas instance
@@ -128,7 +152,8 @@ void canvas_draw_u8g2_bitmap(
 
 /** Add canvas commit callback.
  *
- * This callback will be called upon Canvas commit.
+ * This callback will be called upon Canvas commit if framebuffer or
+ * orientation has changed.
  * 
  * @param      canvas    Canvas instance
  * @param      callback  CanvasCommitCallback
@@ -147,6 +172,31 @@ void canvas_remove_framebuffer_callback(
     CanvasCommitCallback callback,
     void* context);
 
+/** Add canvas commit callback that is notified about changed tiles only.
+ *
+ * Callback is called upon Canvas commit if any tile has changed. First call
+ * after registration reports all tiles.
+ *
+ * @param      canvas    Canvas instance
+ * @param      callback  CanvasCommitTilesCallback
+ * @param      context   CanvasCommitTilesCallback context
+ */
+void canvas_add_framebuffer_tiles_callback(
+    Canvas* canvas,
+    CanvasCommitTilesCallback callback,
+    void* context);
+
+/** Remove canvas commit tiles callback.
+ *
+ * @param      canvas    Canvas instance
+ * @param      callback  CanvasCommitTilesCallback
+ * @param      context   CanvasCommitTilesCallback context
+ */
+void canvas_remove_framebuffer_tiles_callback(
+    Canvas* canvas,
+    CanvasCommitTilesCallback callback,
+    void* context);
+
 #ifdef __cplusplus
 }
 #endif
@@ -478,6 +478,27 @@ void gui_remove_framebuffer_callback(Gui* gui, GuiCanvasCommitCallback callback,
     canvas_remove_framebuffer_callback(gui->canvas, callback, context);
 }
 
+void gui_add_framebuffer_tiles_callback(
+    Gui* gui,
+    GuiCanvasCommitTilesCallback callback,
+    void* context) {
+    furi_check(gui);
+
+    canvas_add_framebuffer_tiles_callback(gui->canvas, callback, context);
+
+    // Request redraw
+    gui_update(gui);
+}
+
+void gui_remove_framebuffer_tiles_callback(
+    Gui* gui,
+    GuiCanvasCommitTilesCallback callback,
+    void* context) {
+    furi_check(gui);
+
+    canvas_remove_framebuffer_tiles_callback(gui->canvas, callback, context);
+}
+
 size_t gui_get_framebuffer_size(const Gui* gui) {
     furi_check(gui);
 
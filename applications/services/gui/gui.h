@@ -33,6 +33,17 @@ typedef void (*GuiCanvasCommitCallback)(
     CanvasOrientation orientation,
     void* context);
 
+/** Gui Canvas Commit Tiles Callback
+ *
+ * Receives whole framebuffer, tiles tell which parts changed since previous call.
+ */
+typedef void (*GuiCanvasCommitTilesCallback)(
+    const uint8_t* data,
+    size_t size,
+    const CanvasDirtyTiles* tiles,
+    CanvasOrientation orientation,
+    void* context);
+
 #define RECORD_GUI "gui"
 
 typedef struct Gui Gui;
@@ -93,6 +104,32 @@ void gui_add_framebuffer_callback(Gui* gui, GuiCanvasCommitCallback callback, vo
  */
 void gui_remove_framebuffer_callback(Gui* gui, GuiCanvasCommitCallback callback, void* context);
 
+/** Add gui canvas commit callback that is notified about changed tiles
+ *
+ * This callback will be called upon Canvas commit if any tile has changed.
+ * First call after registration reports all tiles. Callback is called from
+ * GUI thread and is time critical.
+ *
+ * @param      gui       Gui instance
+ * @param      callback  GuiCanvasCommitTilesCallback
+ * @param      context   GuiCanvasCommitTilesCallback context
+ */
+void gui_add_framebuffer_tiles_callback(
+    Gui* gui,
+    GuiCanvasCommitTilesCallback callback,
+    void* context);
+
+/** Remove gui canvas commit tiles callback
+ *
+ * @param      gui       Gui instance
+ * @param      callback  GuiCanvasCommitTilesCallback
+ * @param      context   GuiCanvasCommitTilesCallback context
+ */
+void gui_remove_framebuffer_tiles_callback(
+    Gui* gui,
+    GuiCanvasCommitTilesCallback callback,
+    void* context);
+
 /** Get gui canvas frame buffer size
  * *
  * @param      gui       Gui instance
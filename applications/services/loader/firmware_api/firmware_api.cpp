@@ -10,17 +10,35 @@
 
 static_assert(!has_hash_collisions(elf_api_table), "Detected API method hash collision!");
 
-constexpr HashtableApiInterface elf_api_interface{
+static constexpr auto elf_api_perfect_hashtable = make_perfect_hashtable(elf_api_table);
+static_assert(elf_api_perfect_hashtable.valid, "Can't build perfect hash table for API");
+static_assert(
+    perfect_hashtable_contains_all(elf_api_perfect_hashtable, elf_api_table),
+    "API method not found in perfect hash table");
+
+constexpr PerfectHashtableApiInterface elf_api_interface{
     {
         .api_version_major = (elf_api_version >> 16),
         .api_version_minor = (elf_api_version & 0xFFFF),
-        .resolver_callback = &elf_resolve_from_hashtable,
+        .resolver_callback = &elf_resolve_from_perfect_hashtable,
     },
-    elf_api_table.cbegin(),
-    elf_api_table.cend(),
+    elf_api_perfect_hashtable.table.data(),
+    elf_api_perfect_hashtable.seeds.data(),
+    elf_api_perfect_hashtable.table.size(),
+    elf_api_perfect_hashtable.seeds.size(),
 };
 const ElfApiInterface* const firmware_api_interface = &elf_api_interface;
 
+extern "C" uint32_t firmware_api_get_hash(void) {
+    // Addresses are only known after linking, so the table is hashed at runtime
+    uint32_t hash = perfect_hash_mix(elf_api_version, 0);
+    for(const sym_entry& entry : elf_api_perfect_hashtable.table) {
+        hash = perfect_hash_mix(hash ^ entry.hash, 0);
+        hash = perfect_hash_mix(hash ^ entry.address, 0);
+    }
+    return hash;
+}
+
 extern "C" void furi_hal_info_get_api_version(uint16_t* major, uint16_t* minor) {
     *major = firmware_api_interface->api_version_major;
     *minor = firmware_api_interface->api_version_minor;
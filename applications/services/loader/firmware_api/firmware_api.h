@@ -2,4 +2,21 @@
 
 #include <flipper_application/elf/elf_api_interface.h>
 
+#ifdef __cplusplus
+extern "C" {
+#endif
+
 extern const ElfApiInterface* const firmware_api_interface;
+
+/**
+ * @brief Get hash of firmware API table: version, symbol names and addresses
+ * 
+ * Changes whenever any API symbol moves, use it to key data derived from the table.
+ * 
+ * @return uint32_t hash
+ */
+uint32_t firmware_api_get_hash(void);
+
+#ifdef __cplusplus
+}
+#endif
@@ -8,6 +8,7 @@
 #include <dialogs/dialogs.h>
 #include <toolbox/path.h>
 #include <flipper_application/flipper_application.h>
+#include <flipper_application/plugins/plugin_manager.h>
 #include <loader/firmware_api/firmware_api.h>
 
 #define TAG "Loader"
@@ -689,6 +690,8 @@ static void loader_do_app_closed(Loader* loader) {
     }
 
     if(loader->app.fap) {
+        // Idle plugins may be resolved against API tables of the application
+        plugin_manager_flush_application(loader->app.fap);
         flipper_application_free(loader->app.fap);
         loader->app.fap = NULL;
         loader->app.thread = NULL;
@@ -2,6 +2,7 @@
 #include "loader_applications.h"
 #include <dialogs/dialogs.h>
 #include <flipper_application/flipper_application.h>
+#include <flipper_application/application_catalog.h>
 #include <assets_icons.h>
 #include <gui/gui.h>
 #include <gui/view_holder.h>
@@ -24,7 +25,7 @@ static int32_t loader_applications_thread(void* p);
 LoaderApplications* loader_applications_alloc(void (*closed_cb)(void*), void* context) {
     LoaderApplications* loader_applications = malloc(sizeof(LoaderApplications));
     loader_applications->thread =
-        furi_thread_alloc_ex(TAG, 768, loader_applications_thread, (void*)loader_applications);
+        furi_thread_alloc_ex(TAG, 1024, loader_applications_thread, (void*)loader_applications);
     loader_applications->closed_cb = closed_cb;
     loader_applications->context = context;
     furi_thread_start(loader_applications->thread);
@@ -42,6 +43,7 @@ typedef struct {
     FuriString* file_path;
     DialogsApp* dialogs;
     Storage* storage;
+    ApplicationCatalog* catalog;
     Loader* loader;
 
     Gui* gui;
@@ -54,6 +56,7 @@ static LoaderApplicationsApp* loader_applications_app_alloc(void) {
     app->file_path = furi_string_alloc_set(EXT_PATH("apps"));
     app->dialogs = furi_record_open(RECORD_DIALOGS);
     app->storage = furi_record_open(RECORD_STORAGE);
+    app->catalog = application_catalog_alloc(app->storage);
     app->loader = furi_record_open(RECORD_LOADER);
 
     app->gui = furi_record_open(RECORD_GUI);
@@ -74,6 +77,7 @@ static void loader_applications_app_free(LoaderApplicationsApp* app) {
 
     furi_record_close(RECORD_LOADER);
     furi_record_close(RECORD_DIALOGS);
+    application_catalog_free(app->catalog);
     furi_record_close(RECORD_STORAGE);
     furi_string_free(app->file_path);
     free(app);
@@ -87,8 +91,8 @@ static bool loader_applications_item_callback(
     LoaderApplicationsApp* loader_applications_app = context;
     furi_assert(loader_applications_app);
     if(furi_string_end_with(path, ".fap")) {
-        return flipper_application_load_name_and_icon(
-            path, loader_applications_app->storage, icon_ptr, item_name);
+        return application_catalog_load_name_and_icon(
+            loader_applications_app->catalog, path, icon_ptr, item_name);
     } else {
         path_extract_filename(path, item_name, false);
         memcpy(*icon_ptr, icon_get_frame_data(&I_js_script_10px, 0), FAP_MANIFEST_MAX_ICON_SIZE);
@@ -1,6 +1,7 @@
 #include "rpc_i.h"
 #include <gui/gui_i.h>
 #include <assets_icons.h>
+#include <toolbox/frame_delta.h>
 
 #include <flipper.pb.h>
 #include <gui.pb.h>
@@ -51,6 +52,9 @@ typedef enum {
 
 #define RPC_GUI_INPUT_RESET (0u)
 
+/** Delta streaming: every Nth frame is a key frame, so clients can resynchronize */
+#define RPC_GUI_KEYFRAME_INTERVAL (64u)
+
 typedef struct {
     RpcSession* session;
     Gui* gui;
@@ -64,6 +68,13 @@ typedef struct {
     // Transmit
     PB_Main* transmit_frame;
     FuriThread* transmit_thread;
+    FuriMutex* stream_mutex;
+    uint8_t* stream_frame; /**< Latest framebuffer, frames are coalesced here */
+    uint8_t* stream_reference; /**< Last transmitted frame, base for deltas */
+    size_t stream_frame_size;
+    CanvasOrientation stream_orientation;
+    uint16_t stream_sequence;
+    bool stream_delta;
 
     bool virtual_display_not_empty;
     bool is_streaming;
@@ -82,25 +93,58 @@ static const PB_Gui_ScreenOrientation rpc_system_gui_screen_orientation_map[] =
 };
 
 static void rpc_system_gui_screen_stream_frame_callback(
-    uint8_t* data,
+    const uint8_t* data,
     size_t size,
+    const CanvasDirtyTiles* tiles,
     CanvasOrientation orientation,
     void* context) {
     furi_assert(data);
+    furi_assert(tiles);
     furi_assert(context);
 
     RpcGuiSystem* rpc_gui = (RpcGuiSystem*)context;
-    uint8_t* buffer = rpc_gui->transmit_frame->content.gui_screen_frame.data->bytes;
-
-    furi_assert(size == rpc_gui->transmit_frame->content.gui_screen_frame.data->size);
-
-    memcpy(buffer, data, size);
-    rpc_gui->transmit_frame->content.gui_screen_frame.orientation =
-        rpc_system_gui_screen_orientation_map[orientation];
+    furi_assert(size == rpc_gui->stream_frame_size);
+
+    // Transmit thread picks the latest frame when it is ready, frames rendered while
+    // transport is backlogged are merged instead of queued
+    furi_check(furi_mutex_acquire(rpc_gui->stream_mutex, FuriWaitForever) == FuriStatusOk);
+    for(size_t row = 0; row < CANVAS_TILE_ROWS; row++) {
+        for(size_t column = 0; column < CANVAS_TILE_COLUMNS; column++) {
+            if(tiles->rows[row] & (1U << column)) {
+                const size_t offset = (row * CANVAS_TILE_COLUMNS + column) * CANVAS_TILE_SIZE;
+                memcpy(&rpc_gui->stream_frame[offset], &data[offset], CANVAS_TILE_SIZE);
+            }
+        }
+    }
+    rpc_gui->stream_orientation = orientation;
+    furi_check(furi_mutex_release(rpc_gui->stream_mutex) == FuriStatusOk);
 
     furi_thread_flags_set(furi_thread_get_id(rpc_gui->transmit_thread), RpcGuiWorkerFlagTransmit);
 }
 
+static void rpc_system_gui_screen_stream_prepare_frame(RpcGuiSystem* rpc_gui) {
+    PB_Gui_ScreenFrame* screen_frame = &rpc_gui->transmit_frame->content.gui_screen_frame;
+
+    furi_check(furi_mutex_acquire(rpc_gui->stream_mutex, FuriWaitForever) == FuriStatusOk);
+    screen_frame->orientation = rpc_system_gui_screen_orientation_map[rpc_gui->stream_orientation];
+
+    if(rpc_gui->stream_delta) {
+        const bool key_frame = (rpc_gui->stream_sequence % RPC_GUI_KEYFRAME_INTERVAL) == 0;
+        screen_frame->data->size = frame_delta_encode(
+            rpc_gui->stream_frame,
+            key_frame ? NULL : rpc_gui->stream_reference,
+            rpc_gui->stream_frame_size,
+            rpc_gui->stream_sequence,
+            screen_frame->data->bytes);
+        // Session delivers messages reliably and in order, sent frame is what client has
+        memcpy(rpc_gui->stream_reference, rpc_gui->stream_frame, rpc_gui->stream_frame_size);
+        rpc_gui->stream_sequence++;
+    } else {
+        memcpy(screen_frame->data->bytes, rpc_gui->stream_frame, rpc_gui->stream_frame_size);
+    }
+    furi_check(furi_mutex_release(rpc_gui->stream_mutex) == FuriStatusOk);
+}
+
 static int32_t rpc_system_gui_screen_stream_frame_transmit_thread(void* context) {
     furi_assert(context);
 
@@ -113,6 +157,7 @@ static int32_t rpc_system_gui_screen_stream_frame_transmit_thread(void* context)
 
         if(flags & RpcGuiWorkerFlagTransmit) {
             transmit_time = furi_get_tick();
+            rpc_system_gui_screen_stream_prepare_frame(rpc_gui);
             rpc_send(rpc_gui->session, rpc_gui->transmit_frame);
             transmit_time = furi_get_tick() - transmit_time;
 
@@ -148,23 +193,53 @@ static void rpc_system_gui_start_screen_stream_process(const PB_Main* request, v
 
         rpc_gui->is_streaming = true;
         size_t framebuffer_size = gui_get_framebuffer_size(rpc_gui->gui);
+        // Old clients don't set the field and keep getting raw frames
+        rpc_gui->stream_delta = request->content.gui_start_screen_stream_request.delta;
+        FURI_LOG_D(TAG, "Delta frames: %s", rpc_gui->stream_delta ? "on" : "off");
+        const size_t frame_data_size =
+            rpc_gui->stream_delta ? frame_delta_get_max_size(framebuffer_size) : framebuffer_size;
+        // Frame state
+        rpc_gui->stream_mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+        rpc_gui->stream_frame = malloc(framebuffer_size);
+        rpc_gui->stream_reference = rpc_gui->stream_delta ? malloc(framebuffer_size) : NULL;
+        rpc_gui->stream_frame_size = framebuffer_size;
+        rpc_gui->stream_sequence = 0;
         // Reusable Frame
         rpc_gui->transmit_frame = malloc(sizeof(PB_Main));
         rpc_gui->transmit_frame->which_content = PB_Main_gui_screen_frame_tag;
         rpc_gui->transmit_frame->command_status = PB_CommandStatus_OK;
         rpc_gui->transmit_frame->content.gui_screen_frame.data =
-            malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(framebuffer_size));
+            malloc(PB_BYTES_ARRAY_T_ALLOCSIZE(frame_data_size));
         rpc_gui->transmit_frame->content.gui_screen_frame.data->size = framebuffer_size;
         // Transmission thread for async TX
         rpc_gui->transmit_thread = furi_thread_alloc_ex(
             "GuiRpcWorker", 1024, rpc_system_gui_screen_stream_frame_transmit_thread, rpc_gui);
         furi_thread_start(rpc_gui->transmit_thread);
-        // GUI framebuffer callback
-        gui_add_framebuffer_callback(
+        // GUI framebuffer callback, first call delivers whole frame
+        gui_add_framebuffer_tiles_callback(
             rpc_gui->gui, rpc_system_gui_screen_stream_frame_callback, context);
     }
 }
 
+static void rpc_system_gui_screen_stream_stop(RpcGuiSystem* rpc_gui) {
+    rpc_gui->is_streaming = false;
+    // Remove GUI framebuffer callback
+    gui_remove_framebuffer_tiles_callback(
+        rpc_gui->gui, rpc_system_gui_screen_stream_frame_callback, rpc_gui);
+    // Stop and release worker thread
+    furi_thread_flags_set(furi_thread_get_id(rpc_gui->transmit_thread), RpcGuiWorkerFlagExit);
+    furi_thread_join(rpc_gui->transmit_thread);
+    furi_thread_free(rpc_gui->transmit_thread);
+    // Release frame
+    pb_release(&PB_Main_msg, rpc_gui->transmit_frame);
+    free(rpc_gui->transmit_frame);
+    rpc_gui->transmit_frame = NULL;
+    // Release frame state
+    free(rpc_gui->stream_frame);
+    free(rpc_gui->stream_reference);
+    furi_mutex_free(rpc_gui->stream_mutex);
+}
+
 static void rpc_system_gui_stop_screen_stream_process(const PB_Main* request, void* context) {
     furi_assert(request);
     furi_assert(context);
@@ -176,18 +251,7 @@ static void rpc_system_gui_stop_screen_stream_process(const PB_Main* request, vo
     furi_assert(session);
 
     if(rpc_gui->is_streaming) {
-        rpc_gui->is_streaming = false;
-        // Remove GUI framebuffer callback
-        gui_remove_framebuffer_callback(
-            rpc_gui->gui, rpc_system_gui_screen_stream_frame_callback, context);
-        // Stop and release worker thread
-        furi_thread_flags_set(furi_thread_get_id(rpc_gui->transmit_thread), RpcGuiWorkerFlagExit);
-        furi_thread_join(rpc_gui->transmit_thread);
-        furi_thread_free(rpc_gui->transmit_thread);
-        // Release frame
-        pb_release(&PB_Main_msg, rpc_gui->transmit_frame);
-        free(rpc_gui->transmit_frame);
-        rpc_gui->transmit_frame = NULL;
+        rpc_system_gui_screen_stream_stop(rpc_gui);
     }
 
     rpc_send_and_release_empty(session, request->command_id, PB_CommandStatus_OK);
@@ -473,18 +537,7 @@ void rpc_system_gui_free(void* context) {
     }
 
     if(rpc_gui->is_streaming) {
-        rpc_gui->is_streaming = false;
-        // Remove GUI framebuffer callback
-        gui_remove_framebuffer_callback(
-            rpc_gui->gui, rpc_system_gui_screen_stream_frame_callback, context);
-        // Stop and release worker thread
-        furi_thread_flags_set(furi_thread_get_id(rpc_gui->transmit_thread), RpcGuiWorkerFlagExit);
-        furi_thread_join(rpc_gui->transmit_thread);
-        furi_thread_free(rpc_gui->transmit_thread);
-        // Release frame
-        pb_release(&PB_Main_msg, rpc_gui->transmit_frame);
-        free(rpc_gui->transmit_frame);
-        rpc_gui->transmit_frame = NULL;
+        rpc_system_gui_screen_stream_stop(rpc_gui);
     }
     furi_record_close(RECORD_INPUT_EVENTS);
     furi_record_close(RECORD_GUI);
@@ -2,7 +2,7 @@
 #include "applications.h"
 #include "desktop_settings_scene.h"
 #include "desktop_settings_scene_i.h"
-#include <flipper_application/flipper_application.h>
+#include <flipper_application/application_catalog.h>
 #include <storage/storage.h>
 #include <dialogs/dialogs.h>
 
@@ -39,11 +39,8 @@ static bool favorite_fap_selector_item_callback(
     void* context,
     uint8_t** icon_ptr,
     FuriString* item_name) {
-    UNUSED(context);
-    Storage* storage = furi_record_open(RECORD_STORAGE);
-    bool success = flipper_application_load_name_and_icon(file_path, storage, icon_ptr, item_name);
-    furi_record_close(RECORD_STORAGE);
-    return success;
+    ApplicationCatalog* catalog = context;
+    return application_catalog_load_name_and_icon(catalog, file_path, icon_ptr, item_name);
 }
 
 static bool favorite_fap_selector_file_exists(char* file_path) {
@@ -192,13 +189,16 @@ bool desktop_settings_scene_favorite_on_event(void* context, SceneManagerEvent e
             curr_favorite_app->name_or_path[0] = '\0';
             consumed = true;
         } else if(event.event == EXTERNAL_APPLICATION_INDEX) {
+            Storage* storage = furi_record_open(RECORD_STORAGE);
+            ApplicationCatalog* catalog = application_catalog_alloc(storage);
+
             const DialogsFileBrowserOptions browser_options = {
                 .extension = ".fap",
                 .icon = &I_unknown_10px,
                 .skip_assets = true,
                 .hide_ext = true,
                 .item_loader_callback = favorite_fap_selector_item_callback,
-                .item_loader_context = app,
+                .item_loader_context = catalog,
                 .base_path = EXT_PATH("apps"),
             };
 
@@ -207,7 +207,13 @@ bool desktop_settings_scene_favorite_on_event(void* context, SceneManagerEvent e
                 furi_string_set_str(temp_path, curr_favorite_app->name_or_path);
             }
 
-            if(dialog_file_browser_show(app->dialogs, temp_path, temp_path, &browser_options)) {
+            const bool selected =
+                dialog_file_browser_show(app->dialogs, temp_path, temp_path, &browser_options);
+
+            application_catalog_free(catalog);
+            furi_record_close(RECORD_STORAGE);
+
+            if(selected) {
                 submenu_reset(app->submenu); // Prevent menu from being shown when we exiting scene
                 strlcpy(
                     curr_favorite_app->name_or_path,
@@ -193,10 +193,22 @@ void js_cli_execute(Cli* cli, FuriString* args, void* context) {
         printf("Running script %s, press CTRL+C to stop\r\n", path);
         JsThread* js_thread = js_thread_run(path, js_cli_callback, &ctx);
 
-        while(furi_semaphore_acquire(ctx.exit_sem, 100) != FuriStatusOk) {
+        bool finished = false;
+        while(!(finished = furi_semaphore_acquire(ctx.exit_sem, 100) == FuriStatusOk)) {
             if(cli_cmd_interrupt_received(cli)) break;
         }
 
+        if(finished) {
+            struct mjs_gc_stats gc_stats;
+            js_thread_get_gc_stats(js_thread, &gc_stats);
+            printf(
+                "GC: %lu cycles, %lu steps, max pause %lu us, total %lu us\r\n",
+                gc_stats.cycles,
+                gc_stats.steps,
+                gc_stats.max_pause,
+                gc_stats.total_pause);
+        }
+
         js_thread_stop(js_thread);
         furi_semaphore_free(ctx.exit_sem);
     } while(false);
@@ -0,0 +1,165 @@
+#include "js_bcode_cache.h"
+
+#include <furi.h>
+#include <storage/storage.h>
+#include <common/cs_file.h>
+#include <mjs_exec_public.h>
+
+#define TAG "JsBcodeCache"
+
+#define JS_BCODE_CACHE_PATH       EXT_PATH(".cache")
+#define JS_BCODE_CACHE_JS_PATH    JS_BCODE_CACHE_PATH "/js"
+#define JS_BCODE_CACHE_CHUNK_SIZE (512)
+
+static bool js_bcode_cache_hash_source(Storage* storage, const char* path, uint32_t* hash) {
+    File* file = storage_file_alloc(storage);
+    uint8_t* chunk = malloc(JS_BCODE_CACHE_CHUNK_SIZE);
+    bool success = false;
+
+    *hash = MJS_SOURCE_HASH_INIT;
+    if(storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING)) {
+        size_t read;
+        do {
+            read = storage_file_read(file, chunk, JS_BCODE_CACHE_CHUNK_SIZE);
+            *hash = mjs_source_hash(*hash, chunk, read);
+        } while(read == JS_BCODE_CACHE_CHUNK_SIZE);
+        success = storage_file_get_error(file) == FSE_OK;
+    }
+
+    free(chunk);
+    storage_file_free(file);
+    return success;
+}
+
+static char* js_bcode_cache_load(
+    Storage* storage,
+    const char* path,
+    uint32_t source_hash,
+    size_t* bcode_size) {
+    File* file = storage_file_alloc(storage);
+    char* bcode = NULL;
+
+    do {
+        if(!storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING)) break;
+
+        struct mjs_bcode_file_header header;
+        if(storage_file_read(file, &header, sizeof(header)) != sizeof(header)) break;
+        if(!mjs_bcode_file_header_check(&header, source_hash)) break;
+        if(storage_file_size(file) != sizeof(header) + header.bcode_size) break;
+
+        bcode = malloc(header.bcode_size);
+        if(storage_file_read(file, bcode, header.bcode_size) != header.bcode_size ||
+           !mjs_bcode_file_bcode_check(&header, bcode)) {
+            FURI_LOG_W(TAG, "Damaged %s", path);
+            free(bcode);
+            bcode = NULL;
+            break;
+        }
+        *bcode_size = header.bcode_size;
+    } while(false);
+
+    storage_file_free(file);
+    return bcode;
+}
+
+static void js_bcode_cache_save(
+    Storage* storage,
+    const char* path,
+    uint32_t source_hash,
+    const char* bcode,
+    size_t bcode_size) {
+    if(!storage_simply_mkdir(storage, JS_BCODE_CACHE_PATH) ||
+       !storage_simply_mkdir(storage, JS_BCODE_CACHE_JS_PATH)) {
+        return;
+    }
+
+    // Write to temporary file first, so interrupted write never leaves broken cache entry
+    FuriString* tmp_path = furi_string_alloc_printf("%s.tmp", path);
+    File* file = storage_file_alloc(storage);
+    bool success = false;
+
+    if(storage_file_open(file, furi_string_get_cstr(tmp_path), FSAM_WRITE, FSOM_CREATE_ALWAYS)) {
+        struct mjs_bcode_file_header header;
+        mjs_bcode_file_header_init(&header, source_hash, bcode, bcode_size);
+        success = storage_file_write(file, &header, sizeof(header)) == sizeof(header) &&
+                  storage_file_write(file, bcode, bcode_size) == bcode_size;
+        storage_file_close(file);
+    }
+    storage_file_free(file);
+
+    if(success) {
+        storage_common_remove(storage, path);
+        success = storage_common_rename(storage, furi_string_get_cstr(tmp_path), path) == FSE_OK;
+    }
+    if(!success) {
+        FURI_LOG_W(TAG, "Failed to save %s", path);
+        storage_common_remove(storage, furi_string_get_cstr(tmp_path));
+    }
+
+    furi_string_free(tmp_path);
+}
+
+static char* js_bcode_cache_compile(
+    Storage* storage,
+    struct mjs* mjs,
+    const char* path,
+    const char* cache_path,
+    uint32_t source_hash,
+    size_t* bcode_size,
+    mjs_err_t* err) {
+    size_t src_size = 0;
+    char* src = cs_read_file(path, &src_size);
+    if(!src) return NULL;
+
+    char* bcode = NULL;
+    *err = mjs_compile(mjs, path, src, &bcode, bcode_size);
+    free(src);
+
+    if(bcode) {
+        js_bcode_cache_save(storage, cache_path, source_hash, bcode, *bcode_size);
+    }
+
+    return bcode;
+}
+
+mjs_err_t js_bcode_cache_exec(struct mjs* mjs, const char* path) {
+    Storage* storage = furi_record_open(RECORD_STORAGE);
+    char* bcode = NULL;
+    size_t bcode_size = 0;
+    uint32_t source_hash;
+    mjs_err_t err = MJS_OK;
+
+    if(js_bcode_cache_hash_source(storage, path, &source_hash)) {
+        // Cache entry is named after script path only, so an edited script replaces its
+        // entry. Header checks source hash and interpreter version before use.
+        const uint32_t key = mjs_source_hash(MJS_SOURCE_HASH_INIT, path, strlen(path));
+        FuriString* cache_path =
+            furi_string_alloc_printf("%s/%08lX.jsc", JS_BCODE_CACHE_JS_PATH, key);
+
+        bcode = js_bcode_cache_load(
+            storage, furi_string_get_cstr(cache_path), source_hash, &bcode_size);
+        if(!bcode) {
+            bcode = js_bcode_cache_compile(
+                storage,
+                mjs,
+                path,
+                furi_string_get_cstr(cache_path),
+                source_hash,
+                &bcode_size,
+                &err);
+        }
+
+        furi_string_free(cache_path);
+    }
+
+    furi_record_close(RECORD_STORAGE);
+
+    // Syntax errors are reported as is, anything else is retried from source
+    if(bcode) {
+        err = mjs_exec_bcode(mjs, bcode, bcode_size, NULL);
+    } else if(err == MJS_OK) {
+        err = mjs_exec_file(mjs, path, NULL);
+    }
+
+    return err;
+}
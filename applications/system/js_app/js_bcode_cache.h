@@ -0,0 +1,25 @@
+#pragma once
+
+#include <mjs_core_public.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Execute script, skipping parsing if precompiled bytecode is available
+ *
+ * Bytecode is taken from the bytecode cache, script is compiled and added to the cache
+ * otherwise.
+ * Bytecode is only used if it was compiled from the same source by the same interpreter
+ * version and is intact, any cache failure falls back to mjs_exec_file.
+ *
+ * @param mjs mjs instance
+ * @param path script path
+ * @return mjs_err_t
+ */
+mjs_err_t js_bcode_cache_exec(struct mjs* mjs, const char* path);
+
+#ifdef __cplusplus
+}
+#endif
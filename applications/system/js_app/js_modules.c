@@ -49,6 +49,8 @@ JsModules* js_modules_create(struct mjs* mjs, CompositeApiResolver* resolver) {
 
     modules->plugin_manager = plugin_manager_alloc(
         PLUGIN_APP_ID, PLUGIN_API_VERSION, composite_api_resolver_get(resolver));
+    // Modules keep their state in module instances, next script reuses loaded ones
+    plugin_manager_set_shared(modules->plugin_manager, true);
 
     modules->resolver = resolver;
 
@@ -8,6 +8,7 @@
 #include "js_thread.h"
 #include "js_thread_i.h"
 #include "js_modules.h"
+#include "js_bcode_cache.h"
 
 #define TAG "JS"
 
@@ -18,6 +19,7 @@ struct JsThread {
     JsThreadCallback app_callback;
     void* context;
     JsModules* modules;
+    struct mjs_gc_stats gc_stats;
 };
 
 static void js_str_print(FuriString* msg_str, struct mjs* mjs) {
@@ -248,7 +250,16 @@ static int32_t js_thread(void* arg) {
 
     mjs_set_exec_flags_poller(mjs, js_exit_flag_poll);
 
-    mjs_err_t err = mjs_exec_file(mjs, furi_string_get_cstr(worker->path), NULL);
+    mjs_err_t err = js_bcode_cache_exec(mjs, furi_string_get_cstr(worker->path));
+
+    // Must be saved before app callback, caller may read it right after Done event
+    mjs_get_gc_stats(mjs, &worker->gc_stats);
+    FURI_LOG_D(
+        TAG,
+        "GC: %lu cycles, %lu steps, max pause %lu us",
+        worker->gc_stats.cycles,
+        worker->gc_stats.steps,
+        worker->gc_stats.max_pause);
 
 #ifdef JS_DEBUG
     if(furi_hal_rtc_is_flag_set(FuriHalRtcFlagDebug)) {
@@ -307,6 +318,10 @@ JsThread* js_thread_run(const char* script_path, JsThreadCallback callback, void
     return worker;
 }
 
+void js_thread_get_gc_stats(JsThread* worker, struct mjs_gc_stats* stats) {
+    *stats = worker->gc_stats;
+}
+
 void js_thread_stop(JsThread* worker) {
     furi_thread_flags_set(furi_thread_get_id(worker->thread), ThreadEventStop);
     furi_thread_join(worker->thread);
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <mjs_gc_public.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -17,6 +19,16 @@ typedef void (*JsThreadCallback)(JsThreadEvent event, const char* msg, void* con
 
 JsThread* js_thread_run(const char* script_path, JsThreadCallback callback, void* context);
 
+/**
+ * @brief Get garbage collector statistics of finished script
+ *
+ * Only valid after the script has finished and JsThreadEventDone was delivered.
+ *
+ * @param worker JsThread instance
+ * @param stats pointer to the statistics structure to fill
+ */
+void js_thread_get_gc_stats(JsThread* worker, struct mjs_gc_stats* stats);
+
 void js_thread_stop(JsThread* worker);
 
 #ifdef __cplusplus
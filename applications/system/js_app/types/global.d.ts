@@ -28,6 +28,20 @@ declare function toString(value: number, base?: number): string;
  */
 declare function load(path: string): any;
 
+/**
+ * @brief Returns garbage collector statistics
+ * 
+ * Collection runs in small steps between instructions, so pauses stay short
+ * even with a large heap. Pause durations are in microseconds.
+ */
+declare function gcStats(): {
+    cycles: number,
+    steps: number,
+    lastPause: number,
+    maxPause: number,
+    totalPause: number,
+};
+
 /**
  * @brief mJS Foreign Pointer type
  * 
@@ -340,6 +340,18 @@ void furi_event_loop_subscribe_message_queue(
         instance, message_queue, &furi_message_queue_event_loop_contract, event, callback, context);
 }
 
+void furi_event_loop_subscribe_pointer_queue(
+    FuriEventLoop* instance,
+    FuriPointerQueue* pointer_queue,
+    FuriEventLoopEvent event,
+    FuriEventLoopEventCallback callback,
+    void* context) {
+    extern const FuriEventLoopContract furi_pointer_queue_event_loop_contract;
+
+    furi_event_loop_object_subscribe(
+        instance, pointer_queue, &furi_pointer_queue_event_loop_contract, event, callback, context);
+}
+
 void furi_event_loop_subscribe_stream_buffer(
     FuriEventLoop* instance,
     FuriStreamBuffer* stream_buffer,
@@ -222,6 +222,26 @@ void furi_event_loop_subscribe_message_queue(
     FuriEventLoopEventCallback callback,
     void* context);
 
+/** Opaque pointer queue type */
+typedef struct FuriPointerQueue FuriPointerQueue;
+
+/** Subscribe to pointer queue events
+ *
+ * @warning you can only have one subscription for one event type.
+ *
+ * @param      instance       The Event Loop instance
+ * @param      pointer_queue  The pointer queue to add
+ * @param[in]  event          The Event Loop event to trigger on
+ * @param[in]  callback       The callback to call on event
+ * @param      context        The context for callback
+ */
+void furi_event_loop_subscribe_pointer_queue(
+    FuriEventLoop* instance,
+    FuriPointerQueue* pointer_queue,
+    FuriEventLoopEvent event,
+    FuriEventLoopEventCallback callback,
+    void* context);
+
 /** Opaque stream buffer type */
 typedef struct FuriStreamBuffer FuriStreamBuffer;
 
@@ -0,0 +1,236 @@
+#include "pointer_queue.h"
+
+#include <FreeRTOS.h>
+#include <queue.h>
+
+#include "kernel.h"
+#include "check.h"
+#include "common_defines.h"
+
+#include "event_loop_link_i.h"
+
+#define FURI_POINTER_QUEUE_SLOT_ALIGN (sizeof(uint64_t))
+
+/* Slot pool and two index queues:
+ * - free queue holds indexes of slots that can be acquired
+ * - ready queue holds indexes of posted slots
+ * Every index is always either in one of the queues or owned by a task,
+ * so none of the queues can ever overflow.
+ */
+struct FuriPointerQueue {
+    StaticQueue_t free_container;
+    StaticQueue_t ready_container;
+    FuriEventLoopLink event_loop_link;
+    uint32_t msg_count;
+    uint32_t msg_size;
+    uint32_t slot_size;
+    uint32_t* free_buffer;
+    uint32_t* ready_buffer;
+    uint8_t* slots;
+    uint8_t buffer[];
+};
+
+// IMPORTANT: buffer MUST be the LAST struct member
+static_assert(offsetof(FuriPointerQueue, buffer) == sizeof(FuriPointerQueue));
+
+FuriPointerQueue* furi_pointer_queue_alloc(uint32_t msg_count, uint32_t msg_size) {
+    furi_check((furi_kernel_is_irq_or_masked() == 0U) && (msg_count > 0U) && (msg_size > 0U));
+
+    const uint32_t slot_size = ROUND_UP_TO(msg_size, FURI_POINTER_QUEUE_SLOT_ALIGN) *
+                               FURI_POINTER_QUEUE_SLOT_ALIGN;
+    const size_t index_buffer_size = msg_count * sizeof(uint32_t);
+    // Extra alignment bytes let slot area start on slot alignment boundary
+    const size_t size = sizeof(FuriPointerQueue) + FURI_POINTER_QUEUE_SLOT_ALIGN +
+                        msg_count * slot_size + index_buffer_size * 2;
+
+    FuriPointerQueue* instance = malloc(size);
+
+    instance->msg_count = msg_count;
+    instance->msg_size = msg_size;
+    instance->slot_size = slot_size;
+
+    uintptr_t slots = (uintptr_t)instance->buffer;
+    slots = ROUND_UP_TO(slots, FURI_POINTER_QUEUE_SLOT_ALIGN) * FURI_POINTER_QUEUE_SLOT_ALIGN;
+    instance->slots = (uint8_t*)slots;
+    instance->free_buffer = (uint32_t*)(instance->slots + msg_count * slot_size);
+    instance->ready_buffer = instance->free_buffer + msg_count;
+
+    furi_check(xQueueCreateStatic(
+        msg_count,
+        sizeof(uint32_t),
+        (uint8_t*)instance->free_buffer,
+        &instance->free_container));
+    furi_check(xQueueCreateStatic(
+        msg_count,
+        sizeof(uint32_t),
+        (uint8_t*)instance->ready_buffer,
+        &instance->ready_container));
+
+    for(uint32_t i = 0; i < msg_count; i++) {
+        furi_check(xQueueSendToBack((QueueHandle_t)&instance->free_container, &i, 0) == pdPASS);
+    }
+
+    return instance;
+}
+
+void furi_pointer_queue_free(FuriPointerQueue* instance) {
+    furi_check(furi_kernel_is_irq_or_masked() == 0U);
+    furi_check(instance);
+
+    // Event Loop must be disconnected
+    furi_check(!instance->event_loop_link.item_in);
+    furi_check(!instance->event_loop_link.item_out);
+
+    // All slots must be returned to the pool
+    furi_check(furi_pointer_queue_get_space(instance) == instance->msg_count);
+
+    vQueueDelete((QueueHandle_t)&instance->free_container);
+    vQueueDelete((QueueHandle_t)&instance->ready_container);
+    free(instance);
+}
+
+static uint32_t furi_pointer_queue_get_index(FuriPointerQueue* instance, void* msg_ptr) {
+    furi_check(msg_ptr);
+
+    const uintptr_t offset = (uintptr_t)msg_ptr - (uintptr_t)instance->slots;
+    furi_check((uintptr_t)msg_ptr >= (uintptr_t)instance->slots);
+    furi_check(offset % instance->slot_size == 0);
+
+    const uint32_t index = offset / instance->slot_size;
+    furi_check(index < instance->msg_count);
+
+    return index;
+}
+
+static bool
+    furi_pointer_queue_receive_index(QueueHandle_t hQueue, uint32_t* index, uint32_t timeout) {
+    bool success;
+
+    if(furi_kernel_is_irq_or_masked() != 0U) {
+        furi_check(timeout == 0U);
+
+        BaseType_t yield = pdFALSE;
+        success = xQueueReceiveFromISR(hQueue, index, &yield) == pdPASS;
+        if(success) {
+            portYIELD_FROM_ISR(yield);
+        }
+    } else {
+        success = xQueueReceive(hQueue, index, (TickType_t)timeout) == pdPASS;
+    }
+
+    return success;
+}
+
+static void furi_pointer_queue_send_index(QueueHandle_t hQueue, uint32_t index) {
+    // Queue length equals slot count: send can not fail
+    if(furi_kernel_is_irq_or_masked() != 0U) {
+        BaseType_t yield = pdFALSE;
+        furi_check(xQueueSendToBackFromISR(hQueue, &index, &yield) == pdTRUE);
+        portYIELD_FROM_ISR(yield);
+    } else {
+        furi_check(xQueueSendToBack(hQueue, &index, 0) == pdPASS);
+    }
+}
+
+void* furi_pointer_queue_acquire(FuriPointerQueue* instance, uint32_t timeout) {
+    furi_check(instance);
+
+    uint32_t index;
+    if(!furi_pointer_queue_receive_index(
+           (QueueHandle_t)&instance->free_container, &index, timeout)) {
+        return NULL;
+    }
+
+    return instance->slots + index * instance->slot_size;
+}
+
+void furi_pointer_queue_put(FuriPointerQueue* instance, void* msg_ptr) {
+    furi_check(instance);
+
+    const uint32_t index = furi_pointer_queue_get_index(instance, msg_ptr);
+    furi_pointer_queue_send_index((QueueHandle_t)&instance->ready_container, index);
+
+    furi_event_loop_link_notify(&instance->event_loop_link, FuriEventLoopEventIn);
+}
+
+void* furi_pointer_queue_get(FuriPointerQueue* instance, uint32_t timeout) {
+    furi_check(instance);
+
+    uint32_t index;
+    if(!furi_pointer_queue_receive_index(
+           (QueueHandle_t)&instance->ready_container, &index, timeout)) {
+        return NULL;
+    }
+
+    return instance->slots + index * instance->slot_size;
+}
+
+void furi_pointer_queue_release(FuriPointerQueue* instance, void* msg_ptr) {
+    furi_check(instance);
+
+    const uint32_t index = furi_pointer_queue_get_index(instance, msg_ptr);
+    furi_pointer_queue_send_index((QueueHandle_t)&instance->free_container, index);
+
+    furi_event_loop_link_notify(&instance->event_loop_link, FuriEventLoopEventOut);
+}
+
+uint32_t furi_pointer_queue_get_capacity(FuriPointerQueue* instance) {
+    furi_check(instance);
+
+    return instance->msg_count;
+}
+
+uint32_t furi_pointer_queue_get_message_size(FuriPointerQueue* instance) {
+    furi_check(instance);
+
+    return instance->msg_size;
+}
+
+static uint32_t furi_pointer_queue_get_waiting(StaticQueue_t* container) {
+    UBaseType_t count;
+
+    if(furi_kernel_is_irq_or_masked() != 0U) {
+        count = uxQueueMessagesWaitingFromISR((QueueHandle_t)container);
+    } else {
+        count = uxQueueMessagesWaiting((QueueHandle_t)container);
+    }
+
+    return (uint32_t)count;
+}
+
+uint32_t furi_pointer_queue_get_count(FuriPointerQueue* instance) {
+    furi_check(instance);
+
+    return furi_pointer_queue_get_waiting(&instance->ready_container);
+}
+
+uint32_t furi_pointer_queue_get_space(FuriPointerQueue* instance) {
+    furi_check(instance);
+
+    return furi_pointer_queue_get_waiting(&instance->free_container);
+}
+
+static FuriEventLoopLink* furi_pointer_queue_event_loop_get_link(FuriEventLoopObject* object) {
+    FuriPointerQueue* instance = object;
+    furi_assert(instance);
+    return &instance->event_loop_link;
+}
+
+static uint32_t
+    furi_pointer_queue_event_loop_get_level(FuriEventLoopObject* object, FuriEventLoopEvent event) {
+    FuriPointerQueue* instance = object;
+    furi_assert(instance);
+
+    if(event == FuriEventLoopEventIn) {
+        return furi_pointer_queue_get_count(instance);
+    } else if(event == FuriEventLoopEventOut) {
+        return furi_pointer_queue_get_space(instance);
+    } else {
+        furi_crash();
+    }
+}
+
+const FuriEventLoopContract furi_pointer_queue_event_loop_contract = {
+    .get_link = furi_pointer_queue_event_loop_get_link,
+    .get_level = furi_pointer_queue_event_loop_get_level,
+};
@@ -0,0 +1,110 @@
+/**
+ * @file pointer_queue.h
+ * FuriPointerQueue
+ *
+ * Zero-copy companion of FuriMessageQueue. Messages live in a pool of
+ * fixed-size slots owned by the queue: the sender acquires a free slot,
+ * fills it in place and posts it, the receiver gets the very same slot and
+ * releases it back to the pool once done. Only slot indexes travel through
+ * the underlying RTOS queues, so message size does not affect transfer cost.
+ *
+ * Slot lifecycle: acquire -> put -> get -> release.
+ * A slot that was acquired but not posted may be returned with release.
+ */
+#pragma once
+
+#include "base.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct FuriPointerQueue FuriPointerQueue;
+
+/** Allocate furi pointer queue
+ *
+ * @param[in]  msg_count  The slot count
+ * @param[in]  msg_size   The slot size in bytes
+ *
+ * @return     pointer to FuriPointerQueue instance
+ */
+FuriPointerQueue* furi_pointer_queue_alloc(uint32_t msg_count, uint32_t msg_size);
+
+/** Free pointer queue
+ *
+ * @warning    all slots must be released and event loop must be disconnected
+ *
+ * @param      instance  pointer to FuriPointerQueue instance
+ */
+void furi_pointer_queue_free(FuriPointerQueue* instance);
+
+/** Acquire free slot for writing
+ *
+ * @param      instance  pointer to FuriPointerQueue instance
+ * @param[in]  timeout   The timeout, must be 0 in ISR
+ *
+ * @return     pointer to slot memory or NULL if no free slot became available
+ */
+void* furi_pointer_queue_acquire(FuriPointerQueue* instance, uint32_t timeout);
+
+/** Post previously acquired slot to the receiver
+ *
+ * Never blocks: queue always has room for every slot in the pool.
+ *
+ * @param      instance  pointer to FuriPointerQueue instance
+ * @param      msg_ptr   slot pointer returned by furi_pointer_queue_acquire
+ */
+void furi_pointer_queue_put(FuriPointerQueue* instance, void* msg_ptr);
+
+/** Get posted slot
+ *
+ * @param      instance  pointer to FuriPointerQueue instance
+ * @param[in]  timeout   The timeout, must be 0 in ISR
+ *
+ * @return     pointer to slot memory or NULL if nothing was posted in time
+ */
+void* furi_pointer_queue_get(FuriPointerQueue* instance, uint32_t timeout);
+
+/** Release slot back to the pool
+ *
+ * @param      instance  pointer to FuriPointerQueue instance
+ * @param      msg_ptr   slot pointer returned by furi_pointer_queue_get or
+ *                       furi_pointer_queue_acquire
+ */
+void furi_pointer_queue_release(FuriPointerQueue* instance, void* msg_ptr);
+
+/** Get queue capacity
+ *
+ * @param      instance  pointer to FuriPointerQueue instance
+ *
+ * @return     capacity in slot count
+ */
+uint32_t furi_pointer_queue_get_capacity(FuriPointerQueue* instance);
+
+/** Get message size
+ *
+ * @param      instance  pointer to FuriPointerQueue instance
+ *
+ * @return     Slot size in bytes
+ */
+uint32_t furi_pointer_queue_get_message_size(FuriPointerQueue* instance);
+
+/** Get posted message count
+ *
+ * @param      instance  pointer to FuriPointerQueue instance
+ *
+ * @return     Posted slot count
+ */
+uint32_t furi_pointer_queue_get_count(FuriPointerQueue* instance);
+
+/** Get free slot count
+ *
+ * @param      instance  pointer to FuriPointerQueue instance
+ *
+ * @return     Free slot count
+ */
+uint32_t furi_pointer_queue_get_space(FuriPointerQueue* instance);
+
+#ifdef __cplusplus
+}
+#endif
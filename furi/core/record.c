@@ -3,18 +3,28 @@
 #include "mutex.h"
 #include "event_flag.h"
 
+#include <stdatomic.h>
 #include <m-dict.h>
 #include <toolbox/m_cstr_dup.h>
 
 #define FURI_RECORD_FLAG_READY (0x1)
 
-typedef struct {
-    FuriEventFlag* flags;
-    void* data;
-    size_t holders_count;
-} FuriRecordData;
+// Holders count value used to block new holders while record is destroyed
+#define FURI_RECORD_HOLDERS_LOCKED (SIZE_MAX)
 
-DICT_DEF2(FuriRecordDataDict, const char*, M_CSTR_DUP_OPLIST, FuriRecordData, M_POD_OPLIST)
+struct FuriRecordHandle {
+    FuriEventFlag* flags;
+    void* _Atomic data;
+    atomic_size_t holders_count;
+    bool interned;
+};
+
+DICT_DEF2(
+    FuriRecordDataDict,
+    const char*,
+    M_CSTR_DUP_OPLIST,
+    FuriRecordHandle*,
+    M_PTR_OPLIST) // NOLINT
 
 typedef struct {
     FuriMutex* mutex;
@@ -23,16 +33,14 @@ typedef struct {
 
 static FuriRecord* furi_record = NULL;
 
-static FuriRecordData* furi_record_get(const char* name) {
-    return FuriRecordDataDict_get(furi_record->records, name);
-}
-
-static void furi_record_put(const char* name, FuriRecordData* record_data) {
-    FuriRecordDataDict_set_at(furi_record->records, name, *record_data);
+static FuriRecordHandle* furi_record_get(const char* name) {
+    FuriRecordHandle** record_data = FuriRecordDataDict_get(furi_record->records, name);
+    return record_data ? *record_data : NULL;
 }
 
-static void furi_record_erase(const char* name, FuriRecordData* record_data) {
+static void furi_record_erase(const char* name, FuriRecordHandle* record_data) {
     furi_event_flag_free(record_data->flags);
+    free(record_data);
     FuriRecordDataDict_erase(furi_record->records, name);
 }
 
@@ -42,16 +50,17 @@ void furi_record_init(void) {
     FuriRecordDataDict_init(furi_record->records);
 }
 
-static FuriRecordData* furi_record_data_get_or_create(const char* name) {
+static FuriRecordHandle* furi_record_data_get_or_create(const char* name) {
     furi_check(furi_record);
-    FuriRecordData* record_data = furi_record_get(name);
+    FuriRecordHandle* record_data = furi_record_get(name);
     if(!record_data) {
-        FuriRecordData new_record;
-        new_record.flags = furi_event_flag_alloc();
-        new_record.data = NULL;
-        new_record.holders_count = 0;
-        furi_record_put(name, &new_record);
-        record_data = furi_record_get(name);
+        // Heap allocated: pointer must survive dictionary rehashing
+        record_data = malloc(sizeof(FuriRecordHandle));
+        record_data->flags = furi_event_flag_alloc();
+        atomic_init(&record_data->data, NULL);
+        atomic_init(&record_data->holders_count, 0);
+        record_data->interned = false;
+        FuriRecordDataDict_set_at(furi_record->records, name, record_data);
     }
     return record_data;
 }
@@ -64,6 +73,50 @@ static void furi_record_unlock(void) {
     furi_check(furi_mutex_release(furi_record->mutex) == FuriStatusOk);
 }
 
+static void furi_record_holder_add(FuriRecordHandle* record_data) {
+    size_t holders = atomic_load_explicit(&record_data->holders_count, memory_order_relaxed);
+    while(true) {
+        if(holders == FURI_RECORD_HOLDERS_LOCKED) {
+            // Record is being destroyed right now and destroy holds the registry mutex
+            // until holders count is unlocked: block on it, with priority inheritance.
+            // Name based open holds the mutex already, so it never gets here.
+            furi_record_lock();
+            furi_record_unlock();
+            holders = atomic_load_explicit(&record_data->holders_count, memory_order_relaxed);
+        } else if(atomic_compare_exchange_weak_explicit(
+                      &record_data->holders_count,
+                      &holders,
+                      holders + 1,
+                      memory_order_acquire,
+                      memory_order_relaxed)) {
+            break;
+        }
+    }
+}
+
+static void furi_record_holder_remove(FuriRecordHandle* record_data) {
+    const size_t holders =
+        atomic_fetch_sub_explicit(&record_data->holders_count, 1, memory_order_release);
+    furi_check(holders != 0 && holders != FURI_RECORD_HOLDERS_LOCKED);
+}
+
+static void* furi_record_wait_data(FuriRecordHandle* record_data) {
+    void* data = atomic_load_explicit(&record_data->data, memory_order_acquire);
+
+    if(!data) {
+        // Wait for record to become ready
+        furi_check(
+            furi_event_flag_wait(
+                record_data->flags,
+                FURI_RECORD_FLAG_READY,
+                FuriFlagWaitAny | FuriFlagNoClear,
+                FuriWaitForever) == FURI_RECORD_FLAG_READY);
+        data = atomic_load_explicit(&record_data->data, memory_order_acquire);
+    }
+
+    return data;
+}
+
 bool furi_record_exists(const char* name) {
     furi_check(furi_record);
     furi_check(name);
@@ -71,7 +124,12 @@ bool furi_record_exists(const char* name) {
     bool ret = false;
 
     furi_record_lock();
-    ret = (furi_record_get(name) != NULL);
+    FuriRecordHandle* record_data = furi_record_get(name);
+    if(record_data) {
+        // Interned records are never erased, look at their state instead
+        ret = !record_data->interned || atomic_load(&record_data->data) ||
+              atomic_load(&record_data->holders_count);
+    }
     furi_record_unlock();
 
     return ret;
@@ -84,9 +142,9 @@ void furi_record_create(const char* name, void* data) {
     furi_record_lock();
 
     // Get record data and fill it
-    FuriRecordData* record_data = furi_record_data_get_or_create(name);
-    furi_check(record_data->data == NULL);
-    record_data->data = data;
+    FuriRecordHandle* record_data = furi_record_data_get_or_create(name);
+    furi_check(atomic_load(&record_data->data) == NULL);
+    atomic_store_explicit(&record_data->data, data, memory_order_release);
     furi_event_flag_set(record_data->flags, FURI_RECORD_FLAG_READY);
 
     furi_record_unlock();
@@ -100,10 +158,19 @@ bool furi_record_destroy(const char* name) {
 
     furi_record_lock();
 
-    FuriRecordData* record_data = furi_record_get(name);
+    FuriRecordHandle* record_data = furi_record_get(name);
     furi_check(record_data);
-    if(record_data->holders_count == 0) {
-        furi_record_erase(name, record_data);
+
+    size_t holders = 0;
+    if(atomic_compare_exchange_strong(
+           &record_data->holders_count, &holders, FURI_RECORD_HOLDERS_LOCKED)) {
+        if(record_data->interned) {
+            furi_event_flag_clear(record_data->flags, FURI_RECORD_FLAG_READY);
+            atomic_store(&record_data->data, NULL);
+            atomic_store(&record_data->holders_count, 0);
+        } else {
+            furi_record_erase(name, record_data);
+        }
         ret = true;
     }
 
@@ -118,20 +185,12 @@ void* furi_record_open(const char* name) {
 
     furi_record_lock();
 
-    FuriRecordData* record_data = furi_record_data_get_or_create(name);
-    record_data->holders_count++;
+    FuriRecordHandle* record_data = furi_record_data_get_or_create(name);
+    furi_record_holder_add(record_data);
 
     furi_record_unlock();
 
-    // Wait for record to become ready
-    furi_check(
-        furi_event_flag_wait(
-            record_data->flags,
-            FURI_RECORD_FLAG_READY,
-            FuriFlagWaitAny | FuriFlagNoClear,
-            FuriWaitForever) == FURI_RECORD_FLAG_READY);
-
-    return record_data->data;
+    return furi_record_wait_data(record_data);
 }
 
 void furi_record_close(const char* name) {
@@ -140,9 +199,37 @@ void furi_record_close(const char* name) {
 
     furi_record_lock();
 
-    FuriRecordData* record_data = furi_record_get(name);
+    FuriRecordHandle* record_data = furi_record_get(name);
     furi_check(record_data);
-    record_data->holders_count--;
+    furi_record_holder_remove(record_data);
 
     furi_record_unlock();
 }
+
+FuriRecordHandle* furi_record_get_handle(const char* name) {
+    furi_check(furi_record);
+    furi_check(name);
+
+    furi_record_lock();
+
+    FuriRecordHandle* record_data = furi_record_data_get_or_create(name);
+    record_data->interned = true;
+
+    furi_record_unlock();
+
+    return record_data;
+}
+
+void* furi_record_open_handle(FuriRecordHandle* handle) {
+    furi_check(handle);
+
+    furi_record_holder_add(handle);
+
+    return furi_record_wait_data(handle);
+}
+
+void furi_record_close_handle(FuriRecordHandle* handle) {
+    furi_check(handle);
+
+    furi_record_holder_remove(handle);
+}
@@ -12,6 +12,14 @@
 extern "C" {
 #endif
 
+/** Interned record handle
+ *
+ * Resolved once by name, stays valid for the whole firmware lifetime even if
+ * record is destroyed and created again. Opening and closing record through
+ * the handle takes neither the registry mutex nor string lookup.
+ */
+typedef struct FuriRecordHandle FuriRecordHandle;
+
 /** Initialize record storage For internal use only.
  */
 void furi_record_init(void);
@@ -62,6 +70,31 @@ FURI_RETURNS_NONNULL void* furi_record_open(const char* name);
  */
 void furi_record_close(const char* name);
 
+/** Get interned record handle
+ *
+ * @param      name  record name
+ *
+ * @return     record handle, never freed
+ * @note       Thread safe. Record does not need to exist yet.
+ */
+FURI_RETURNS_NONNULL FuriRecordHandle* furi_record_get_handle(const char* name);
+
+/** Open record by handle
+ *
+ * @param      handle  record handle
+ *
+ * @return     pointer to the record
+ * @note       Thread safe. Suspends caller thread till record is available
+ */
+FURI_RETURNS_NONNULL void* furi_record_open_handle(FuriRecordHandle* handle);
+
+/** Close record by handle
+ *
+ * @param      handle  record handle
+ * @note       Thread safe.
+ */
+void furi_record_close_handle(FuriRecordHandle* handle);
+
 #ifdef __cplusplus
 }
 #endif
@@ -4,6 +4,7 @@
 #include <FreeRTOS-Kernel/include/stream_buffer.h>
 
 #include "check.h"
+#include "kernel.h"
 #include "common_defines.h"
 
 #include "event_loop_link_i.h"
@@ -14,6 +15,7 @@
 struct FuriStreamBuffer {
     StaticStreamBuffer_t container;
     FuriEventLoopLink event_loop_link;
+    size_t item_size;
     uint8_t buffer[];
 };
 
@@ -23,7 +25,13 @@ static_assert(offsetof(FuriStreamBuffer, container) == 0);
 static_assert(offsetof(FuriStreamBuffer, buffer) == sizeof(FuriStreamBuffer));
 
 FuriStreamBuffer* furi_stream_buffer_alloc(size_t size, size_t trigger_level) {
+    return furi_stream_buffer_alloc_ex(size, trigger_level, 1);
+}
+
+FuriStreamBuffer* furi_stream_buffer_alloc_ex(size_t size, size_t trigger_level, size_t item_size) {
     furi_check(size != 0);
+    furi_check(item_size != 0);
+    furi_check(size % item_size == 0);
 
     // Actual FreeRTOS usable buffer size seems to be one less
     const size_t buffer_size = size + 1;
@@ -34,6 +42,8 @@ FuriStreamBuffer* furi_stream_buffer_alloc(size_t size, size_t trigger_level) {
 
     furi_check(hStreamBuffer == (StreamBufferHandle_t)stream_buffer);
 
+    stream_buffer->item_size = item_size;
+
     return stream_buffer;
 }
 
@@ -84,6 +94,43 @@ size_t furi_stream_buffer_send(
     return ret;
 }
 
+size_t furi_stream_buffer_send_batch(
+    FuriStreamBuffer* stream_buffer,
+    const void* items,
+    size_t item_count,
+    uint32_t timeout) {
+    furi_check(stream_buffer);
+    furi_check(items || item_count == 0);
+
+    const size_t item_size = stream_buffer->item_size;
+    const uint8_t* data = items;
+    const uint32_t start = furi_get_tick();
+    size_t sent = 0;
+
+    while(sent < item_count) {
+        // Write as many items as there is space for: one copy, one wakeup
+        const size_t spaces = xStreamBufferSpacesAvailable((StreamBufferHandle_t)stream_buffer);
+        size_t length = MIN(item_count - sent, spaces / item_size) * item_size;
+        uint32_t wait = 0;
+
+        if(length == 0) {
+            const uint32_t elapsed = furi_get_tick() - start;
+            if(FURI_IS_IRQ_MODE() || (timeout != FuriWaitForever && elapsed >= timeout)) break;
+
+            // Buffer is full, block until receiver takes an item
+            wait = (timeout == FuriWaitForever) ? FuriWaitForever : timeout - elapsed;
+            length = item_size;
+        }
+
+        const size_t ret =
+            furi_stream_buffer_send(stream_buffer, &data[sent * item_size], length, wait);
+        sent += ret / item_size;
+        if(ret != length) break;
+    }
+
+    return sent;
+}
+
 size_t furi_stream_buffer_receive(
     FuriStreamBuffer* stream_buffer,
     void* data,
@@ -163,7 +210,11 @@ static uint32_t
     furi_assert(stream_buffer);
 
     if(event == FuriEventLoopEventIn) {
-        return xStreamBufferBytesAvailable((StreamBufferHandle_t)stream_buffer);
+        // Data below trigger level is not reported, same as send notifications
+        const size_t bytes_available =
+            xStreamBufferBytesAvailable((StreamBufferHandle_t)stream_buffer);
+        const size_t trigger_level = stream_buffer->container.xTriggerLevelBytes;
+        return bytes_available >= trigger_level ? bytes_available : 0;
     } else if(event == FuriEventLoopEventOut) {
         return xStreamBufferSpacesAvailable((StreamBufferHandle_t)stream_buffer);
     } else {
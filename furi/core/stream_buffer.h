@@ -34,6 +34,20 @@ typedef struct FuriStreamBuffer FuriStreamBuffer;
  */
 FuriStreamBuffer* furi_stream_buffer_alloc(size_t size, size_t trigger_level);
 
+/**
+ * @brief Allocate stream buffer instance for fixed size items.
+ * Same as furi_stream_buffer_alloc(), size must be a whole number of items.
+ * As long as the receiver takes whole items too, free space is always a whole
+ * number of items, so furi_stream_buffer_send_batch() never writes part of one.
+ * 
+ * @param size The total number of bytes the stream buffer will be able to hold at any one time.
+ * @param trigger_level The number of bytes that must be in the stream buffer 
+ * before a task that is blocked on the stream buffer to wait for data is moved out of the blocked state.
+ * @param item_size The size of one item in bytes.
+ * @return The stream buffer instance.
+ */
+FuriStreamBuffer* furi_stream_buffer_alloc_ex(size_t size, size_t trigger_level, size_t item_size);
+
 /**
  * @brief Free stream buffer instance
  * 
@@ -74,6 +88,27 @@ size_t furi_stream_buffer_send(
     size_t length,
     uint32_t timeout);
 
+/**
+ * @brief Sends a block of fixed size items to a stream buffer.
+ * Items that fit are copied with a single send, so receiver is woken up and
+ * event loop is notified once per call instead of once per item. Item size is
+ * the one the stream buffer was allocated with, see furi_stream_buffer_alloc_ex().
+ * Items are copied, there is no in-place write into the stream buffer storage.
+ * 
+ * @param stream_buffer The stream buffer instance.
+ * @param items A pointer to the items that are to be copied into the stream buffer.
+ * @param item_count The number of items to copy.
+ * @param timeout The maximum amount of time the task should remain in the
+ * Blocked state to wait for space for all items. Items that fit are written on timeout.
+ * Ignored if called from ISR.
+ * @return The number of items written to the stream buffer.
+ */
+size_t furi_stream_buffer_send_batch(
+    FuriStreamBuffer* stream_buffer,
+    const void* items,
+    size_t item_count,
+    uint32_t timeout);
+
 /**
  * @brief Receives bytes from a stream buffer.
  * Wakes up task waiting for space to become available if called from ISR.
@@ -1,8 +1,16 @@
 #include "string.h"
+#include "check.h"
 #include <m-string.h>
 
 struct FuriString {
     string_t string;
+    FuriStringArena* arena;
+};
+
+struct FuriStringArena {
+    size_t count;
+    bool* in_use;
+    FuriString strings[];
 };
 
 #undef furi_string_alloc_set
@@ -26,18 +34,47 @@ struct FuriString {
 FuriString* furi_string_alloc(void) {
     FuriString* string = malloc(sizeof(FuriString));
     string_init(string->string);
+    string->arena = NULL;
     return string;
 }
 
+FuriString* furi_string_alloc_in(FuriStringArena* arena) {
+    if(!arena) return furi_string_alloc();
+
+    for(size_t i = 0; i < arena->count; i++) {
+        if(!arena->in_use[i]) {
+            arena->in_use[i] = true;
+            FuriString* string = &arena->strings[i];
+            // Keeps memory reserved by previous user
+            string_reset(string->string);
+            return string;
+        }
+    }
+
+    return furi_string_alloc();
+}
+
+static void furi_string_release(FuriString* s) {
+    FuriStringArena* arena = s->arena;
+    if(arena) {
+        // String stays initialized and keeps its buffer for the next user
+        arena->in_use[s - arena->strings] = false;
+    } else {
+        free(s);
+    }
+}
+
 FuriString* furi_string_alloc_set(const FuriString* s) {
     FuriString* string = malloc(sizeof(FuriString)); //-V799
     string_init_set(string->string, s->string);
+    string->arena = NULL;
     return string;
 } //-V773
 
 FuriString* furi_string_alloc_set_str(const char cstr[]) {
     FuriString* string = malloc(sizeof(FuriString)); //-V799
     string_init_set(string->string, cstr);
+    string->arena = NULL;
     return string;
 } //-V773
 
@@ -52,19 +89,55 @@ FuriString* furi_string_alloc_printf(const char format[], ...) {
 FuriString* furi_string_alloc_vprintf(const char format[], va_list args) {
     FuriString* string = malloc(sizeof(FuriString));
     string_init_vprintf(string->string, format, args);
+    string->arena = NULL;
     return string;
 }
 
 FuriString* furi_string_alloc_move(FuriString* s) {
     FuriString* string = malloc(sizeof(FuriString));
     string_init_move(string->string, s->string);
-    free(s);
+    string->arena = NULL;
+    if(s->arena) {
+        // Arena strings must always stay initialized
+        string_init(s->string);
+    }
+    furi_string_release(s);
     return string;
 }
 
 void furi_string_free(FuriString* s) {
-    string_clear(s->string);
-    free(s);
+    if(!s->arena) {
+        string_clear(s->string);
+    }
+    furi_string_release(s);
+}
+
+FuriStringArena* furi_string_arena_alloc(size_t count) {
+    furi_check(count > 0);
+
+    FuriStringArena* arena =
+        malloc(sizeof(FuriStringArena) + sizeof(FuriString) * count + sizeof(bool) * count);
+    arena->count = count;
+    arena->in_use = (bool*)&arena->strings[count];
+
+    for(size_t i = 0; i < count; i++) {
+        string_init(arena->strings[i].string);
+        arena->strings[i].arena = arena;
+        arena->in_use[i] = false;
+    }
+
+    return arena;
+}
+
+void furi_string_arena_free(FuriStringArena* arena) {
+    furi_check(arena);
+
+    for(size_t i = 0; i < arena->count; i++) {
+        furi_check(!arena->in_use[i]);
+        string_clear(arena->strings[i].string);
+    }
+
+    free(arena);
 }
 
 void furi_string_reserve(FuriString* s, size_t alloc) {
@@ -83,7 +156,10 @@ void furi_string_swap(FuriString* v1, FuriString* v2) {
 void furi_string_move(FuriString* v1, FuriString* v2) {
     string_clear(v1->string);
     string_init_move(v1->string, v2->string);
-    free(v2);
+    if(v2->arena) {
+        string_init(v2->string);
+    }
+    furi_string_release(v2);
 }
 
 size_t furi_string_hash(const FuriString* v) {
@@ -23,6 +23,9 @@ extern "C" {
 /** Furi string primitive. */
 typedef struct FuriString FuriString;
 
+/** Furi string arena. */
+typedef struct FuriStringArena FuriStringArena;
+
 //---------------------------------------------------------------------------
 //                               Constructors
 //---------------------------------------------------------------------------
@@ -86,6 +89,21 @@ FuriString* furi_string_alloc_vprintf(const char format[], va_list args);
  */
 FuriString* furi_string_alloc_move(FuriString* source);
 
+/** Allocate new FuriString from the arena.
+ *
+ * String instance is taken from the arena and keeps memory reserved by its
+ * previous user, so short-lived strings in parsing loops do not touch the
+ * global heap once the arena is warmed up. Falls back to regular allocation
+ * if all arena strings are in use or arena is NULL.
+ *
+ * @warning    Arena is not thread safe, see furi_string_arena_alloc
+ *
+ * @param      arena  The FuriStringArena instance or NULL
+ *
+ * @return     pointer to the instance of FuriString, release with furi_string_free
+ */
+FuriString* furi_string_alloc_in(FuriStringArena* arena);
+
 //---------------------------------------------------------------------------
 //                               Destructors
 //---------------------------------------------------------------------------
@@ -96,6 +114,36 @@ FuriString* furi_string_alloc_move(FuriString* source);
  */
 void furi_string_free(FuriString* string);
 
+//---------------------------------------------------------------------------
+//                               String arena
+//---------------------------------------------------------------------------
+
+/** Allocate string arena.
+ *
+ * Arena keeps a fixed set of FuriString instances for reuse by
+ * furi_string_alloc_in. Memory of released strings is kept until the arena
+ * is freed.
+ *
+ * @warning    Arena has no locking. Allocating from the arena and freeing its
+ *             strings must be serialized by the owner, e.g. arena belongs to
+ *             an object that is only used from one thread at a time. Once
+ *             taken, arena strings are regular FuriString instances, but
+ *             must not outlive the arena.
+ *
+ * @param      count  Maximum number of simultaneously used arena strings
+ *
+ * @return     pointer to the instance of FuriStringArena
+ */
+FuriStringArena* furi_string_arena_alloc(size_t count);
+
+/** Free string arena.
+ *
+ * @warning    All strings taken from the arena must be freed beforehand
+ *
+ * @param      arena  The FuriStringArena instance
+ */
+void furi_string_arena_free(FuriStringArena* arena);
+
 //---------------------------------------------------------------------------
 //                         String memory management
 //---------------------------------------------------------------------------
@@ -655,6 +655,8 @@ bool furi_thread_enumerate(FuriThreadList* thread_list) {
             item->state = furi_thread_state_name(task[i].eCurrentState);
             item->counter_previous = item->counter_current;
             item->counter_current = task[i].ulRunTimeCounter;
+            item->switches_previous = item->switches_current;
+            item->switches_current = tcb->uxTaskNumber;
             item->tick = tick;
         }
 
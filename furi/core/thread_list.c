@@ -111,6 +111,12 @@ void furi_thread_list_process(FuriThreadList* instance, uint32_t runtime, uint32
                 item->cpu = 0.0f;
             }
 
+            if(item->counter_previous) {
+                item->context_switches = item->switches_current - item->switches_previous;
+            } else {
+                item->context_switches = 0;
+            }
+
             FuriThreadListItemArray_next(it);
         }
     }
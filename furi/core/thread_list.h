@@ -25,6 +25,12 @@ typedef struct {
     uint32_t counter_previous; /**< Thread previous runtime counter */
     uint32_t counter_current; /**< Thread current runtime counter */
     uint32_t tick; /**< Thread last seen tick */
+
+    uint32_t context_switches; /**< Thread context switches since previous enumeration */
+
+    // Service variables
+    uint32_t switches_previous; /**< Thread previous context switch counter */
+    uint32_t switches_current; /**< Thread current context switch counter */
 } FuriThreadListItem;
 
 /** Anonymous FuriThreadList type */
@@ -13,6 +13,7 @@
 #include "core/memmgr_heap.h"
 #include "core/message_queue.h"
 #include "core/mutex.h"
+#include "core/pointer_queue.h"
 #include "core/pubsub.h"
 #include "core/record.h"
 #include "core/semaphore.h"
@@ -1,4 +1,5 @@
 #include "digital_sequence.h"
+#include "digital_sequence_i.h"
 #include "digital_signal_i.h"
 
 #include <furi.h>
@@ -67,9 +68,24 @@ struct DigitalSequence {
     DigitalSequenceSignalBank signals;
     DigitalSequenceState state;
 
+    DigitalSequencePeriodCallback period_callback;
+    void* period_context;
+    bool period_level;
+
     uint8_t data[];
 };
 
+/* Walks the sequence signals and yields timer reload values in transmission order. */
+typedef struct {
+    const DigitalSequence* sequence;
+    const DigitalSignal* signal_current;
+    const DigitalSignal* signal_next;
+    uint32_t next_signal_index;
+    uint32_t period_index;
+    int32_t remainder_ticks;
+    uint32_t reload_value_carry;
+} DigitalSequenceRenderer;
+
 DigitalSequence* digital_sequence_alloc(uint32_t size, const GpioPin* gpio) {
     furi_assert(size);
     furi_assert(gpio);
@@ -171,9 +187,7 @@ static void digital_sequence_stop_timer(void) {
     furi_hal_bus_disable(FuriHalBusTIM2);
 }
 
-static inline void digital_sequence_init_gpio_buffer(
-    DigitalSequence* sequence,
-    const DigitalSignal* first_signal) {
+static inline void digital_sequence_init_gpio_buffer(DigitalSequence* sequence, bool start_level) {
     const uint32_t bit_set = sequence->gpio->pin << GPIO_BSRR_BS0_Pos
 #ifdef DIGITAL_SIGNAL_DEBUG_OUTPUT_PIN
                              | DIGITAL_SIGNAL_DEBUG_OUTPUT_PIN.pin << GPIO_BSRR_BS0_Pos
@@ -186,7 +200,7 @@ static inline void digital_sequence_init_gpio_buffer(
 #endif
         ;
 
-    if(first_signal->start_level) {
+    if(start_level) {
         sequence->gpio_buf[0] = bit_set;
         sequence->gpio_buf[1] = bit_reset;
     } else {
@@ -280,99 +294,222 @@ static inline void digital_sequence_timer_buffer_reset(DigitalSequence* sequence
     sequence->timer_buf.write_pos = 0;
 }
 
-void digital_sequence_transmit(DigitalSequence* sequence) {
-    furi_check(sequence);
-    furi_check(sequence->size);
-    furi_check(sequence->state == DigitalSequenceStateIdle);
+static inline void digital_sequence_renderer_init(
+    DigitalSequenceRenderer* renderer,
+    const DigitalSequence* sequence) {
+    renderer->sequence = sequence;
+    renderer->signal_current = sequence->signals[sequence->data[0]];
+    renderer->signal_next = (sequence->size > 1) ? sequence->signals[sequence->data[1]] : NULL;
+    renderer->next_signal_index = 2;
+    renderer->period_index = 0;
+    renderer->remainder_ticks = 0;
+    renderer->reload_value_carry = 0;
+}
 
-    FURI_CRITICAL_ENTER();
+/* Produces the next timer reload value, returns false after the last one. */
+static inline bool
+    digital_sequence_renderer_next(DigitalSequenceRenderer* renderer, uint32_t* reload_value) {
+    for(;;) {
+        const DigitalSignal* signal_current = renderer->signal_current;
+        const DigitalSignal* signal_next = renderer->signal_next;
+
+        if(renderer->period_index == signal_current->size) {
+            /* No further signals are available */
+            if(signal_next == NULL) return false;
+
+            /* Prevent the rounding error from accumulating by distributing it across multiple periods. */
+            renderer->remainder_ticks += signal_current->remainder;
+            if(renderer->remainder_ticks >= DIGITAL_SIGNAL_T_TIM_DIV2) {
+                renderer->remainder_ticks -= DIGITAL_SIGNAL_T_TIM;
+                renderer->reload_value_carry += 1;
+            }
 
-    furi_hal_gpio_init(sequence->gpio, GpioModeOutputPushPull, GpioPullNo, GpioSpeedVeryHigh);
-#ifdef DIGITAL_SIGNAL_DEBUG_OUTPUT_PIN
-    furi_hal_gpio_init(
-        &DIGITAL_SIGNAL_DEBUG_OUTPUT_PIN, GpioModeOutputPushPull, GpioPullNo, GpioSpeedVeryHigh);
-#endif
+            const DigitalSequence* sequence = renderer->sequence;
+            renderer->signal_current = signal_next;
+            renderer->signal_next =
+                (renderer->next_signal_index < sequence->size) ?
+                    sequence->signals[sequence->data[renderer->next_signal_index++]] :
+                    NULL;
+            renderer->period_index = 0;
+            continue;
+        }
 
-    const DigitalSignal* signal_current = sequence->signals[sequence->data[0]];
+        const uint32_t i = renderer->period_index++;
+        const bool is_last_value = (i == signal_current->size - 1);
+        const uint32_t value = signal_current->data[i] + renderer->reload_value_carry;
 
-    digital_sequence_init_gpio_buffer(sequence, signal_current);
+        renderer->reload_value_carry = 0;
 
-    int32_t remainder_ticks = 0;
-    uint32_t reload_value_carry = 0;
-    uint32_t next_signal_index = 1;
+        if(is_last_value) {
+            if(signal_next != NULL) {
+                /* Special case: signal boundary. Depending on whether the adjacent levels are equal or not,
+                 * they will be combined to a single one or handled separately. */
+                const bool end_level = signal_current->start_level ^
+                                       ((signal_current->size % 2) == 0);
 
-    for(;;) {
-        const DigitalSignal* signal_next =
-            (next_signal_index < sequence->size) ?
-                sequence->signals[sequence->data[next_signal_index++]] :
-                NULL;
-
-        for(uint32_t i = 0; i < signal_current->size; i++) {
-            const bool is_last_value = (i == signal_current->size - 1);
-            const uint32_t reload_value = signal_current->data[i] + reload_value_carry;
-
-            reload_value_carry = 0;
-
-            if(is_last_value) {
-                if(signal_next != NULL) {
-                    /* Special case: signal boundary. Depending on whether the adjacent levels are equal or not,
-                     * they will be combined to a single one or handled separately. */
-                    const bool end_level = signal_current->start_level ^
-                                           ((signal_current->size % 2) == 0);
-
-                    /* If the adjacent levels are equal, carry the current period duration over to the next signal. */
-                    if(end_level == signal_next->start_level) {
-                        reload_value_carry = reload_value;
-                    }
-                } else {
-                    /** Special case: during the last period of the last signal, hold the output level indefinitely.
-                     * @see digital_signal.h
-                     *
-                     * Setting reload_value_carry to a non-zero value will prevent the respective period from being
-                     * added to the DMA ring buffer. */
-                    reload_value_carry = 1;
+                /* If the adjacent levels are equal, carry the current period duration over to the next signal. */
+                if(end_level == signal_next->start_level) {
+                    renderer->reload_value_carry = value;
                 }
+            } else {
+                /** Special case: during the last period of the last signal, hold the output level indefinitely.
+                 * @see digital_signal.h
+                 *
+                 * Setting reload_value_carry to a non-zero value will prevent the respective period from being
+                 * added to the DMA ring buffer. */
+                renderer->reload_value_carry = 1;
             }
+        }
 
-            /* A non-zero reload_value_carry means that the level was the same on the both sides of the signal boundary
-             * and the two respective periods were combined to one. */
-            if(reload_value_carry == 0) {
-                digital_sequence_enqueue_period(sequence, reload_value);
-            }
+        /* A non-zero reload_value_carry means that the level was the same on the both sides of the signal boundary
+         * and the two respective periods were combined to one. */
+        if(renderer->reload_value_carry == 0) {
+            *reload_value = value;
+            return true;
+        }
+    }
+}
 
-            if(sequence->state == DigitalSequenceStateIdle) {
-                const bool is_buffer_filled = sequence->timer_buf.write_pos >=
-                                              (DIGITAL_SEQUENCE_RING_BUFFER_SIZE -
-                                               DIGITAL_SEQUENCE_RING_BUFFER_MIN_FREE_SIZE);
-                const bool is_end_of_data = (signal_next == NULL) && is_last_value;
+static inline void digital_sequence_transmit_begin(DigitalSequence* sequence, bool start_level) {
+    furi_hal_gpio_init(sequence->gpio, GpioModeOutputPushPull, GpioPullNo, GpioSpeedVeryHigh);
+#ifdef DIGITAL_SIGNAL_DEBUG_OUTPUT_PIN
+    furi_hal_gpio_init(
+        &DIGITAL_SIGNAL_DEBUG_OUTPUT_PIN, GpioModeOutputPushPull, GpioPullNo, GpioSpeedVeryHigh);
+#endif
 
-                if(is_buffer_filled || is_end_of_data) {
-                    digital_sequence_start_dma(sequence);
-                    digital_sequence_start_timer();
-                    sequence->state = DigitalSequenceStateActive;
-                }
-            }
-        }
+    digital_sequence_init_gpio_buffer(sequence, start_level);
+    sequence->period_level = start_level;
+}
 
-        /* Exit the loop here when no further signals are available */
-        if(signal_next == NULL) break;
+static inline void digital_sequence_start(DigitalSequence* sequence) {
+    digital_sequence_start_dma(sequence);
+    digital_sequence_start_timer();
+    sequence->state = DigitalSequenceStateActive;
+}
 
-        /* Prevent the rounding error from accumulating by distributing it across multiple periods. */
-        remainder_ticks += signal_current->remainder;
-        if(remainder_ticks >= DIGITAL_SIGNAL_T_TIM_DIV2) {
-            remainder_ticks -= DIGITAL_SIGNAL_T_TIM;
-            reload_value_carry += 1;
+static inline void digital_sequence_transmit_period(DigitalSequence* sequence, uint32_t length) {
+    if(sequence->period_callback) {
+        sequence->period_callback(sequence->period_level, length, sequence->period_context);
+        sequence->period_level = !sequence->period_level;
+    }
+
+    digital_sequence_enqueue_period(sequence, length);
+
+    if(sequence->state == DigitalSequenceStateIdle) {
+        const bool is_buffer_filled =
+            sequence->timer_buf.write_pos >=
+            (DIGITAL_SEQUENCE_RING_BUFFER_SIZE - DIGITAL_SEQUENCE_RING_BUFFER_MIN_FREE_SIZE);
+
+        if(is_buffer_filled) {
+            digital_sequence_start(sequence);
         }
+    }
+}
 
-        signal_current = signal_next;
-    };
+static inline void digital_sequence_transmit_end(DigitalSequence* sequence) {
+    /* End of data: start the transmission if the buffer has never been filled */
+    if(sequence->state == DigitalSequenceStateIdle) {
+        digital_sequence_start(sequence);
+    }
 
     digital_sequence_finish(sequence);
     digital_sequence_timer_buffer_reset(sequence);
+}
+
+void digital_sequence_transmit(DigitalSequence* sequence) {
+    furi_check(sequence);
+    furi_check(sequence->size);
+    furi_check(sequence->state == DigitalSequenceStateIdle);
+
+    FURI_CRITICAL_ENTER();
+
+    DigitalSequenceRenderer renderer;
+    digital_sequence_renderer_init(&renderer, sequence);
+    digital_sequence_transmit_begin(sequence, renderer.signal_current->start_level);
+
+    uint32_t reload_value;
+    while(digital_sequence_renderer_next(&renderer, &reload_value)) {
+        digital_sequence_transmit_period(sequence, reload_value);
+    }
+
+    digital_sequence_transmit_end(sequence);
+
+    FURI_CRITICAL_EXIT();
+
+    sequence->state = DigitalSequenceStateIdle;
+}
+
+uint32_t digital_sequence_transmit_record(
+    DigitalSequence* sequence,
+    bool* start_level,
+    uint16_t* periods,
+    uint32_t max_count) {
+    furi_check(sequence);
+    furi_check(sequence->size);
+    furi_check(sequence->state == DigitalSequenceStateIdle);
+    furi_check(start_level);
+    furi_check(periods || max_count == 0);
+
+    FURI_CRITICAL_ENTER();
+
+    DigitalSequenceRenderer renderer;
+    digital_sequence_renderer_init(&renderer, sequence);
+    *start_level = renderer.signal_current->start_level;
+    digital_sequence_transmit_begin(sequence, *start_level);
+
+    uint32_t count = 0;
+    bool is_recorded = true;
+    uint32_t reload_value;
+    while(digital_sequence_renderer_next(&renderer, &reload_value)) {
+        digital_sequence_transmit_period(sequence, reload_value);
+
+        if(count < max_count) periods[count] = reload_value;
+        is_recorded &= (reload_value <= UINT16_MAX);
+        count++;
+    }
+
+    digital_sequence_transmit_end(sequence);
 
     FURI_CRITICAL_EXIT();
 
     sequence->state = DigitalSequenceStateIdle;
+
+    return is_recorded ? count : 0;
+}
+
+void digital_sequence_transmit_rendered(
+    DigitalSequence* sequence,
+    bool start_level,
+    const uint16_t* periods,
+    uint32_t count) {
+    furi_check(sequence);
+    furi_check(periods);
+    furi_check(sequence->state == DigitalSequenceStateIdle);
+
+    FURI_CRITICAL_ENTER();
+
+    digital_sequence_transmit_begin(sequence, start_level);
+
+    for(uint32_t i = 0; i < count; i++) {
+        digital_sequence_transmit_period(sequence, periods[i]);
+    }
+
+    digital_sequence_transmit_end(sequence);
+
+    FURI_CRITICAL_EXIT();
+
+    sequence->state = DigitalSequenceStateIdle;
+}
+
+void digital_sequence_set_period_callback(
+    DigitalSequence* sequence,
+    DigitalSequencePeriodCallback callback,
+    void* context) {
+    furi_check(sequence);
+    furi_check(sequence->state == DigitalSequenceStateIdle);
+
+    sequence->period_callback = callback;
+    sequence->period_context = context;
 }
 
 void digital_sequence_clear(DigitalSequence* sequence) {
@@ -97,6 +97,43 @@ void digital_sequence_add_signal(DigitalSequence* sequence, uint8_t signal_index
  */
 void digital_sequence_transmit(DigitalSequence* sequence);
 
+/**
+ * @brief Transmit the sequence contained in the DigitalSequence instance and record its periods.
+ *
+ * Same as digital_sequence_transmit(), except that the timer periods are also stored,
+ * so that they can be sent again later with digital_sequence_transmit_rendered()
+ * without walking the signals. Nothing is allocated, so it is safe to call from
+ * a critical section.
+ *
+ * @param[in,out] sequence pointer to the sequence to be transmitted.
+ * @param[out] start_level pointer to store the level of the first period.
+ * @param[out] periods pointer to the period array, may be NULL if max_count is zero.
+ * @param[in] max_count capacity of the period array.
+ * @returns total period count (may exceed max_count), 0 if some period does not fit in 16 bits.
+ */
+uint32_t digital_sequence_transmit_record(
+    DigitalSequence* sequence,
+    bool* start_level,
+    uint16_t* periods,
+    uint32_t max_count);
+
+/**
+ * @brief Transmit periods previously obtained with digital_sequence_transmit_record().
+ *
+ * The registered signals and signal indices are not used, so the sequence may contain anything.
+ * Same GPIO NOTE as for digital_sequence_transmit() applies.
+ *
+ * @param[in] sequence pointer to the instance to transmit with.
+ * @param[in] start_level level of the first period.
+ * @param[in] periods pointer to the period array.
+ * @param[in] count period count.
+ */
+void digital_sequence_transmit_rendered(
+    DigitalSequence* sequence,
+    bool start_level,
+    const uint16_t* periods,
+    uint32_t count);
+
 /**
  * @brief Clear the signal sequence in a DigitalSequence instance.
  *
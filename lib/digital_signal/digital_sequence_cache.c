@@ -0,0 +1,236 @@
+#include "digital_sequence_cache.h"
+
+#include <furi.h>
+
+/* Number of recently offered keys remembered for admission. */
+#define DIGITAL_SEQUENCE_CACHE_SEEN_SIZE 8
+
+typedef struct {
+    uint32_t hash;
+    uint32_t last_used;
+    uint32_t period_offset;
+    uint32_t period_count; /* Zero if the entry is free. */
+    uint16_t key_size;
+    bool start_level;
+} DigitalSequenceCacheEntry;
+
+struct DigitalSequenceCache {
+    size_t max_entries;
+    size_t max_periods;
+    size_t max_key_size;
+    size_t used_periods;
+    uint32_t tick;
+
+    uint32_t seen[DIGITAL_SEQUENCE_CACHE_SEEN_SIZE];
+    size_t seen_pos;
+
+    uint16_t* periods; /* Periods of all entries packed together, followed by free space. */
+    uint8_t* keys; /* max_key_size bytes per entry. */
+
+    DigitalSequenceCacheEntry entries[];
+};
+
+static inline uint32_t digital_sequence_cache_hash(const uint8_t* key, size_t key_size) {
+    /* FNV-1a */
+    uint32_t hash = 2166136261UL;
+    for(size_t i = 0; i < key_size; i++) {
+        hash ^= key[i];
+        hash *= 16777619UL;
+    }
+    return hash;
+}
+
+static inline uint8_t*
+    digital_sequence_cache_get_key(DigitalSequenceCache* cache, DigitalSequenceCacheEntry* entry) {
+    return &cache->keys[(entry - cache->entries) * cache->max_key_size];
+}
+
+static DigitalSequenceCacheEntry* digital_sequence_cache_find(
+    DigitalSequenceCache* cache,
+    uint32_t hash,
+    const uint8_t* key,
+    size_t key_size) {
+    for(size_t i = 0; i < cache->max_entries; i++) {
+        DigitalSequenceCacheEntry* entry = &cache->entries[i];
+        if(entry->period_count && entry->hash == hash && entry->key_size == key_size &&
+           memcmp(digital_sequence_cache_get_key(cache, entry), key, key_size) == 0) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static DigitalSequenceCacheEntry* digital_sequence_cache_find_free(DigitalSequenceCache* cache) {
+    for(size_t i = 0; i < cache->max_entries; i++) {
+        if(!cache->entries[i].period_count) {
+            return &cache->entries[i];
+        }
+    }
+    return NULL;
+}
+
+static DigitalSequenceCacheEntry* digital_sequence_cache_find_lru(DigitalSequenceCache* cache) {
+    DigitalSequenceCacheEntry* lru_entry = NULL;
+
+    for(size_t i = 0; i < cache->max_entries; i++) {
+        DigitalSequenceCacheEntry* entry = &cache->entries[i];
+        if(!entry->period_count) continue;
+        if(!lru_entry || (cache->tick - entry->last_used) > (cache->tick - lru_entry->last_used)) {
+            lru_entry = entry;
+        }
+    }
+
+    return lru_entry;
+}
+
+/* Drops the entry and packs the periods behind it, including pending_count periods
+ * recorded past the used space. */
+static void digital_sequence_cache_release(
+    DigitalSequenceCache* cache,
+    DigitalSequenceCacheEntry* entry,
+    size_t pending_count) {
+    const uint32_t offset = entry->period_offset;
+    const uint32_t count = entry->period_count;
+
+    memmove(
+        &cache->periods[offset],
+        &cache->periods[offset + count],
+        (cache->used_periods + pending_count - offset - count) * sizeof(uint16_t));
+
+    for(size_t i = 0; i < cache->max_entries; i++) {
+        DigitalSequenceCacheEntry* other = &cache->entries[i];
+        if(other->period_count && other->period_offset > offset) {
+            other->period_offset -= count;
+        }
+    }
+
+    cache->used_periods -= count;
+    entry->period_count = 0;
+}
+
+/* Returns true if the key has been offered recently, otherwise remembers it. */
+static bool digital_sequence_cache_admit(DigitalSequenceCache* cache, uint32_t hash) {
+    for(size_t i = 0; i < DIGITAL_SEQUENCE_CACHE_SEEN_SIZE; i++) {
+        if(cache->seen[i] == hash) {
+            cache->seen[i] = 0;
+            return true;
+        }
+    }
+
+    cache->seen[cache->seen_pos] = hash;
+    cache->seen_pos = (cache->seen_pos + 1) % DIGITAL_SEQUENCE_CACHE_SEEN_SIZE;
+
+    return false;
+}
+
+DigitalSequenceCache*
+    digital_sequence_cache_alloc(size_t max_entries, size_t max_periods, size_t max_key_size) {
+    furi_check(max_entries);
+    furi_check(max_periods);
+    furi_check(max_key_size && max_key_size <= UINT16_MAX);
+
+    DigitalSequenceCache* cache =
+        malloc(sizeof(DigitalSequenceCache) + max_entries * sizeof(DigitalSequenceCacheEntry));
+
+    cache->max_entries = max_entries;
+    cache->max_periods = max_periods;
+    cache->max_key_size = max_key_size;
+    cache->periods = malloc(max_periods * sizeof(uint16_t));
+    cache->keys = malloc(max_entries * max_key_size);
+
+    return cache;
+}
+
+void digital_sequence_cache_free(DigitalSequenceCache* cache) {
+    furi_check(cache);
+
+    free(cache->keys);
+    free(cache->periods);
+    free(cache);
+}
+
+void digital_sequence_cache_reset(DigitalSequenceCache* cache) {
+    furi_check(cache);
+
+    for(size_t i = 0; i < cache->max_entries; i++) {
+        cache->entries[i].period_count = 0;
+    }
+    cache->used_periods = 0;
+
+    memset(cache->seen, 0, sizeof(cache->seen));
+    cache->seen_pos = 0;
+}
+
+bool digital_sequence_cache_transmit(
+    DigitalSequenceCache* cache,
+    DigitalSequence* sequence,
+    const uint8_t* key,
+    size_t key_size) {
+    furi_check(cache);
+    furi_check(sequence);
+    furi_check(key);
+
+    const uint32_t hash = digital_sequence_cache_hash(key, key_size);
+    DigitalSequenceCacheEntry* entry = digital_sequence_cache_find(cache, hash, key, key_size);
+
+    if(!entry) return false;
+
+    entry->last_used = ++cache->tick;
+    digital_sequence_transmit_rendered(
+        sequence,
+        entry->start_level,
+        &cache->periods[entry->period_offset],
+        entry->period_count);
+
+    return true;
+}
+
+void digital_sequence_cache_transmit_add(
+    DigitalSequenceCache* cache,
+    DigitalSequence* sequence,
+    const uint8_t* key,
+    size_t key_size) {
+    furi_check(cache);
+    furi_check(sequence);
+    furi_check(key);
+
+    const uint32_t hash = digital_sequence_cache_hash(key, key_size);
+
+    if(key_size > cache->max_key_size || !digital_sequence_cache_admit(cache, hash)) {
+        digital_sequence_transmit(sequence);
+        return;
+    }
+
+    /* Periods are recorded straight into the free space while transmitting */
+    const size_t free_count = cache->max_periods - cache->used_periods;
+    bool start_level;
+    const uint32_t period_count = digital_sequence_transmit_record(
+        sequence, &start_level, &cache->periods[cache->used_periods], free_count);
+
+    if(period_count == 0 || period_count > cache->max_periods) return;
+
+    if(period_count > free_count) {
+        /* Did not fit, make room for the next time the key is seen */
+        while(cache->max_periods - cache->used_periods < period_count) {
+            digital_sequence_cache_release(cache, digital_sequence_cache_find_lru(cache), 0);
+        }
+        digital_sequence_cache_admit(cache, hash);
+        return;
+    }
+
+    DigitalSequenceCacheEntry* entry = digital_sequence_cache_find_free(cache);
+    if(!entry) {
+        entry = digital_sequence_cache_find_lru(cache);
+        digital_sequence_cache_release(cache, entry, period_count);
+    }
+
+    entry->hash = hash;
+    entry->last_used = ++cache->tick;
+    entry->period_offset = cache->used_periods;
+    entry->period_count = period_count;
+    entry->key_size = key_size;
+    entry->start_level = start_level;
+    memcpy(digital_sequence_cache_get_key(cache, entry), key, key_size);
+
+    cache->used_periods += period_count;
+}
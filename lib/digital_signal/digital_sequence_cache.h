@@ -0,0 +1,93 @@
+/**
+ * @file digital_sequence_cache.h
+ * @brief Cache of pre-rendered DigitalSequence transmissions.
+ *
+ * Listeners keep answering the same few frames over and over (UIDs, inventory responses,
+ * static page reads). Instead of walking the signal bank for every one of them, the cache
+ * keeps the timer periods recorded by digital_sequence_transmit_record() and sends them as they
+ * are.
+ *
+ * Entries are looked up by the caller provided key, which must uniquely describe the encoded
+ * sequence (e.g. data rate and frame bytes). Since the key is the content itself, changing
+ * the data being transmitted can never hit a stale entry.
+ *
+ * A key is admitted to the cache only when it is seen for the second time, so that one-off frames
+ * (encrypted or counter driven) do not push out the repeating ones.
+ * Least recently used entries are evicted when the entry or period budget is exceeded.
+ *
+ * All memory is allocated up front, so both transmit functions can be called from a critical
+ * section. The cache is not thread safe and is meant to be used from the transmitting thread only.
+ */
+#pragma once
+
+#include <digital_signal/digital_sequence.h>
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct DigitalSequenceCache DigitalSequenceCache;
+
+/**
+ * @brief Allocate a DigitalSequenceCache instance.
+ *
+ * @param[in] max_entries maximum number of cached frames.
+ * @param[in] max_periods maximum total number of cached periods, 2 bytes each.
+ * @param[in] max_key_size maximum key size in bytes, longer keys are never cached.
+ * @returns pointer to the allocated instance.
+ */
+DigitalSequenceCache*
+    digital_sequence_cache_alloc(size_t max_entries, size_t max_periods, size_t max_key_size);
+
+/**
+ * @brief Delete a DigitalSequenceCache instance along with all of its entries.
+ *
+ * @param[in,out] cache pointer to the instance to be deleted.
+ */
+void digital_sequence_cache_free(DigitalSequenceCache* cache);
+
+/**
+ * @brief Drop all cached entries and admission history.
+ *
+ * @param[in,out] cache pointer to the instance to be reset.
+ */
+void digital_sequence_cache_reset(DigitalSequenceCache* cache);
+
+/**
+ * @brief Transmit the cached rendering for a given key, if there is one.
+ *
+ * @param[in,out] cache pointer to the cache instance.
+ * @param[in] sequence pointer to the sequence to transmit with.
+ * @param[in] key pointer to the key.
+ * @param[in] key_size key size in bytes.
+ * @returns true if the entry was found and transmitted, false otherwise.
+ */
+bool digital_sequence_cache_transmit(
+    DigitalSequenceCache* cache,
+    DigitalSequence* sequence,
+    const uint8_t* key,
+    size_t key_size);
+
+/**
+ * @brief Transmit the encoded sequence and offer it for caching under a given key.
+ *
+ * The periods are recorded while transmitting and stored only if the key has been offered
+ * recently, otherwise the key is just remembered. Entries are evicted only after the transmission,
+ * so a frame that did not fit in the remaining space is stored the next time it is sent.
+ *
+ * @param[in,out] cache pointer to the cache instance.
+ * @param[in,out] sequence pointer to the sequence holding the encoded frame.
+ * @param[in] key pointer to the key.
+ * @param[in] key_size key size in bytes.
+ */
+void digital_sequence_cache_transmit_add(
+    DigitalSequenceCache* cache,
+    DigitalSequence* sequence,
+    const uint8_t* key,
+    size_t key_size);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,33 @@
+/**
+ * @file digital_sequence_i.h
+ * @brief DigitalSequence private definitions.
+ *
+ * This file is an implementation detail. It must not be included in
+ * any public API-related headers.
+ */
+#pragma once
+
+#include "digital_sequence.h"
+
+/**
+ * @brief Callback invoked for every period queued for transmission.
+ *
+ * Called from a critical section, must return quickly.
+ *
+ * @param[in] level output level during the period.
+ * @param[in] period timer reload value of the period.
+ * @param[in,out] context pointer to the user-defined context.
+ */
+typedef void (*DigitalSequencePeriodCallback)(bool level, uint32_t period, void* context);
+
+/**
+ * @brief Observe the periods queued by all transmit functions, meant for testing.
+ *
+ * @param[in,out] sequence pointer to the instance to be observed.
+ * @param[in] callback pointer to the callback function, NULL to stop observing.
+ * @param[in] context pointer to the user-defined context.
+ */
+void digital_sequence_set_period_callback(
+    DigitalSequence* sequence,
+    DigitalSequencePeriodCallback callback,
+    void* context);
@@ -1,6 +1,7 @@
 #include "iso14443_3a_signal.h"
 
 #include <digital_signal/digital_sequence.h>
+#include <digital_signal/digital_sequence_cache.h>
 
 #define BITS_IN_BYTE (8)
 
@@ -10,6 +11,16 @@
 #define ISO14443_3A_SIGNAL_SEQUENCE_SIZE \
     (ISO14443_3A_SIGNAL_MAX_EDGES / (ISO14443_3A_SIGNAL_BIT_MAX_EDGES - 2))
 
+/* Longest frame the sequence can hold, each byte takes 8 data bits and parity */
+#define ISO14443_3A_SIGNAL_FRAME_SIZE_MAX (ISO14443_3A_SIGNAL_SEQUENCE_SIZE / (BITS_IN_BYTE + 1))
+
+/* Bit count, data and parity bits */
+#define ISO14443_3A_SIGNAL_CACHE_KEY_SIZE_MAX \
+    (2 + ISO14443_3A_SIGNAL_FRAME_SIZE_MAX + (ISO14443_3A_SIGNAL_FRAME_SIZE_MAX + 7) / 8)
+
+#define ISO14443_3A_SIGNAL_CACHE_ENTRIES (8)
+#define ISO14443_3A_SIGNAL_CACHE_PERIODS (2048)
+
 #define ISO14443_3A_SIGNAL_F_SIG       (13560000.0)
 #define ISO14443_3A_SIGNAL_T_SIG       7374 //73.746ns*100
 #define ISO14443_3A_SIGNAL_T_SIG_X8    58992 //T_SIG*8
@@ -26,6 +37,7 @@ typedef DigitalSignal* Iso14443_3aSignalBank[Iso14443_3aSignalIndexCount];
 
 struct Iso14443_3aSignal {
     DigitalSequence* tx_sequence;
+    DigitalSequenceCache* tx_cache;
     Iso14443_3aSignalBank signals;
 };
 
@@ -65,6 +77,26 @@ static void iso14443_3a_signal_encode(
     }
 }
 
+// Cache key is the frame itself: bit count, data and parity
+static size_t iso14443_3a_signal_get_cache_key(
+    uint8_t* key,
+    const uint8_t* tx_data,
+    const uint8_t* tx_parity,
+    size_t tx_bits) {
+    const size_t data_size = tx_bits < BITS_IN_BYTE ? 1 : tx_bits / BITS_IN_BYTE;
+    const size_t parity_size =
+        tx_bits < BITS_IN_BYTE ? 0 : (data_size + BITS_IN_BYTE - 1) / BITS_IN_BYTE;
+
+    furi_check(data_size <= ISO14443_3A_SIGNAL_FRAME_SIZE_MAX);
+
+    key[0] = tx_bits & 0xFF;
+    key[1] = tx_bits >> 8;
+    memcpy(&key[2], tx_data, data_size);
+    memcpy(&key[2 + data_size], tx_parity, parity_size);
+
+    return 2 + data_size + parity_size;
+}
+
 static inline void iso14443_3a_signal_set_bit(DigitalSignal* signal, bool bit) {
     digital_signal_set_start_level(signal, bit);
 
@@ -106,6 +138,10 @@ Iso14443_3aSignal* iso14443_3a_signal_alloc(const GpioPin* pin) {
 
     Iso14443_3aSignal* instance = malloc(sizeof(Iso14443_3aSignal));
     instance->tx_sequence = digital_sequence_alloc(ISO14443_3A_SIGNAL_SEQUENCE_SIZE, pin);
+    instance->tx_cache = digital_sequence_cache_alloc(
+        ISO14443_3A_SIGNAL_CACHE_ENTRIES,
+        ISO14443_3A_SIGNAL_CACHE_PERIODS,
+        ISO14443_3A_SIGNAL_CACHE_KEY_SIZE_MAX);
 
     iso14443_3a_signal_bank_fill(instance->signals);
     iso14443_3a_signal_bank_register(instance->signals, instance->tx_sequence);
@@ -118,6 +154,7 @@ void iso14443_3a_signal_free(Iso14443_3aSignal* instance) {
     furi_assert(instance->tx_sequence);
 
     iso14443_3a_signal_bank_clear(instance->signals);
+    digital_sequence_cache_free(instance->tx_cache);
     digital_sequence_free(instance->tx_sequence);
     free(instance);
 }
@@ -131,9 +168,16 @@ void iso14443_3a_signal_tx(
     furi_assert(tx_data);
     furi_assert(tx_parity);
 
+    uint8_t key[ISO14443_3A_SIGNAL_CACHE_KEY_SIZE_MAX];
+    const size_t key_size = iso14443_3a_signal_get_cache_key(key, tx_data, tx_parity, tx_bits);
+
     FURI_CRITICAL_ENTER();
-    digital_sequence_clear(instance->tx_sequence);
-    iso14443_3a_signal_encode(instance, tx_data, tx_parity, tx_bits);
-    digital_sequence_transmit(instance->tx_sequence);
+    if(!digital_sequence_cache_transmit(
+           instance->tx_cache, instance->tx_sequence, key, key_size)) {
+        digital_sequence_clear(instance->tx_sequence);
+        iso14443_3a_signal_encode(instance, tx_data, tx_parity, tx_bits);
+        digital_sequence_cache_transmit_add(
+            instance->tx_cache, instance->tx_sequence, key, key_size);
+    }
     FURI_CRITICAL_EXIT();
 }
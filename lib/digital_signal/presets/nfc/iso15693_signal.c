@@ -1,6 +1,7 @@
 #include "iso15693_signal.h"
 
 #include <digital_signal/digital_sequence.h>
+#include <digital_signal/digital_sequence_cache.h>
 
 #define BITS_IN_BYTE (8U)
 
@@ -13,6 +14,12 @@
 #define ISO15693_SIGNAL_SOF_EDGES  (ISO15693_SIGNAL_EOF_EDGES + 1U)
 #define ISO15693_SIGNAL_EDGES      (1350U)
 
+/* Frames up to this size are recorded once and replayed from cache when repeated */
+#define ISO15693_SIGNAL_CACHE_FRAME_SIZE_MAX (32U)
+#define ISO15693_SIGNAL_CACHE_KEY_SIZE_MAX   (2U + ISO15693_SIGNAL_CACHE_FRAME_SIZE_MAX)
+#define ISO15693_SIGNAL_CACHE_ENTRIES        (8U)
+#define ISO15693_SIGNAL_CACHE_PERIODS        (4096U)
+
 #define ISO15693_SIGNAL_FC     (13.56e6)
 #define ISO15693_SIGNAL_FC_16  (16.0e11 / ISO15693_SIGNAL_FC)
 #define ISO15693_SIGNAL_FC_256 (256.0e11 / ISO15693_SIGNAL_FC)
@@ -30,6 +37,7 @@ typedef DigitalSignal* Iso15693SignalBank[Iso15693SignalIndexNum];
 
 struct Iso15693Signal {
     DigitalSequence* tx_sequence;
+    DigitalSequenceCache* tx_cache;
     Iso15693SignalBank banks[Iso15693SignalDataRateNum];
 };
 
@@ -111,6 +119,22 @@ static inline void iso15693_signal_encode(
         instance->tx_sequence, iso15693_get_sequence_index(Iso15693SignalIndexEof, data_rate));
 }
 
+// Cache key is data rate, frame kind (SOF only or full frame) and data. Returns 0 if too long
+static size_t iso15693_signal_get_cache_key(
+    uint8_t* key,
+    Iso15693SignalDataRate data_rate,
+    bool is_sof_only,
+    const uint8_t* tx_data,
+    size_t tx_data_size) {
+    if(tx_data_size > ISO15693_SIGNAL_CACHE_FRAME_SIZE_MAX) return 0;
+
+    key[0] = data_rate;
+    key[1] = is_sof_only;
+    if(tx_data_size) memcpy(&key[2], tx_data, tx_data_size);
+
+    return 2 + tx_data_size;
+}
+
 static void iso15693_signal_bank_fill(Iso15693Signal* instance, Iso15693SignalDataRate data_rate) {
     const uint32_t k = data_rate == Iso15693SignalDataRateHi ? ISO15693_SIGNAL_COEFF_HI :
                                                                ISO15693_SIGNAL_COEFF_LO;
@@ -152,6 +176,10 @@ Iso15693Signal* iso15693_signal_alloc(const GpioPin* pin) {
     Iso15693Signal* instance = malloc(sizeof(Iso15693Signal));
 
     instance->tx_sequence = digital_sequence_alloc(BITS_IN_BYTE * 255 + 2, pin);
+    instance->tx_cache = digital_sequence_cache_alloc(
+        ISO15693_SIGNAL_CACHE_ENTRIES,
+        ISO15693_SIGNAL_CACHE_PERIODS,
+        ISO15693_SIGNAL_CACHE_KEY_SIZE_MAX);
 
     for(uint32_t i = 0; i < Iso15693SignalDataRateNum; ++i) {
         iso15693_signal_bank_fill(instance, i);
@@ -164,6 +192,7 @@ Iso15693Signal* iso15693_signal_alloc(const GpioPin* pin) {
 void iso15693_signal_free(Iso15693Signal* instance) {
     furi_assert(instance);
 
+    digital_sequence_cache_free(instance->tx_cache);
     digital_sequence_free(instance->tx_sequence);
 
     for(uint32_t i = 0; i < Iso15693SignalDataRateNum; ++i) {
@@ -182,10 +211,25 @@ void iso15693_signal_tx(
     furi_assert(data_rate < Iso15693SignalDataRateNum);
     furi_assert(tx_data);
 
+    uint8_t key[ISO15693_SIGNAL_CACHE_KEY_SIZE_MAX];
+    const size_t key_size =
+        iso15693_signal_get_cache_key(key, data_rate, false, tx_data, tx_data_size);
+
     FURI_CRITICAL_ENTER();
-    digital_sequence_clear(instance->tx_sequence);
-    iso15693_signal_encode(instance, data_rate, tx_data, tx_data_size);
-    digital_sequence_transmit(instance->tx_sequence);
+    const bool is_cached =
+        key_size &&
+        digital_sequence_cache_transmit(instance->tx_cache, instance->tx_sequence, key, key_size);
+
+    if(!is_cached) {
+        digital_sequence_clear(instance->tx_sequence);
+        iso15693_signal_encode(instance, data_rate, tx_data, tx_data_size);
+        if(key_size) {
+            digital_sequence_cache_transmit_add(
+                instance->tx_cache, instance->tx_sequence, key, key_size);
+        } else {
+            digital_sequence_transmit(instance->tx_sequence);
+        }
+    }
 
     FURI_CRITICAL_EXIT();
 }
@@ -194,11 +238,19 @@ void iso15693_signal_tx_sof(Iso15693Signal* instance, Iso15693SignalDataRate dat
     furi_assert(instance);
     furi_assert(data_rate < Iso15693SignalDataRateNum);
 
+    uint8_t key[ISO15693_SIGNAL_CACHE_KEY_SIZE_MAX];
+    const size_t key_size = iso15693_signal_get_cache_key(key, data_rate, true, NULL, 0);
+
     FURI_CRITICAL_ENTER();
-    digital_sequence_clear(instance->tx_sequence);
-    digital_sequence_add_signal(
-        instance->tx_sequence, iso15693_get_sequence_index(Iso15693SignalIndexSof, data_rate));
-    digital_sequence_transmit(instance->tx_sequence);
+    if(!digital_sequence_cache_transmit(
+           instance->tx_cache, instance->tx_sequence, key, key_size)) {
+        digital_sequence_clear(instance->tx_sequence);
+        digital_sequence_add_signal(
+            instance->tx_sequence,
+            iso15693_get_sequence_index(Iso15693SignalIndexSof, data_rate));
+        digital_sequence_cache_transmit_add(
+            instance->tx_cache, instance->tx_sequence, key, key_size);
+    }
 
     FURI_CRITICAL_EXIT();
 }
@@ -36,6 +36,32 @@ bool elf_resolve_from_hashtable(
     return result;
 }
 
+bool elf_resolve_from_perfect_hashtable(
+    const ElfApiInterface* interface,
+    uint32_t hash,
+    Elf32_Addr* address) {
+    furi_check(interface);
+    furi_check(address);
+
+    const PerfectHashtableApiInterface* hashtable_interface =
+        static_cast<const PerfectHashtableApiInterface*>(interface);
+
+    const sym_entry* entry = perfect_hashtable_find(
+        hashtable_interface->table,
+        hashtable_interface->table_size,
+        hashtable_interface->seeds,
+        hashtable_interface->seed_count,
+        hash);
+
+    if(!entry) {
+        FURI_LOG_T(TAG, "Can't find symbol with hash %lx @ %p!", hash, hashtable_interface->table);
+        return false;
+    }
+
+    *address = entry->address;
+    return true;
+}
+
 uint32_t elf_symbolname_hash(const char* s) {
     furi_check(s);
     return elf_gnu_hash(s);
@@ -28,6 +28,18 @@ bool elf_resolve_from_hashtable(
     uint32_t hash,
     Elf32_Addr* address);
 
+/**
+ * @brief Resolver for API entries using a minimal perfect hash table
+ * @param interface pointer to PerfectHashtableApiInterface
+ * @param hash gnu hash of function name
+ * @param address output for function address
+ * @return true if the table contains a function
+ */
+bool elf_resolve_from_perfect_hashtable(
+    const ElfApiInterface* interface,
+    uint32_t hash,
+    Elf32_Addr* address);
+
 uint32_t elf_symbolname_hash(const char* s);
 
 #ifdef __cplusplus
@@ -72,6 +84,199 @@ constexpr uint32_t elf_gnu_hash(const char* s) {
     return h;
 }
 
+/**
+ * @brief Average number of entries per perfect hash table bucket.
+ * Each bucket costs 2 bytes of seed storage.
+ */
+#define PERFECT_HASH_BUCKET_SIZE (4)
+
+/**
+ * @brief Maximum seed value tried for a perfect hash table bucket
+ */
+#define PERFECT_HASH_SEED_MAX (UINT16_MAX)
+
+/**
+ * @brief Minimal perfect hash table over API entries, built at compile time.
+ * Entries are split into buckets, each bucket gets a displacement seed
+ * that moves all of its entries into free slots, so lookup takes one probe.
+ */
+template <std::size_t N, std::size_t B>
+struct PerfectHashtable {
+    std::array<sym_entry, N> table;
+    std::array<uint16_t, B> seeds;
+    bool valid;
+};
+
+/**
+ * @brief  PerfectHashtableApiInterface is an implementation of ElfApiInterface
+ * that uses a minimal perfect hash table to resolve function addresses.
+ * table and seeds must come from make_perfect_hashtable
+ */
+struct PerfectHashtableApiInterface : public ElfApiInterface {
+    const sym_entry* table;
+    const uint16_t* seeds;
+    uint32_t table_size;
+    uint32_t seed_count;
+};
+
+/**
+ * @brief Mix symbol hash, murmur3 finalizer
+ * @param hash symbol hash
+ * @param seed 0 to select bucket, 1 to select slot
+ * @return mixed value
+ */
+constexpr uint32_t perfect_hash_mix(uint32_t hash, uint32_t seed) {
+    uint32_t h = hash ^ (seed * 0x9E3779B9U);
+    h ^= h >> 16;
+    h *= 0x85EBCA6BU;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35U;
+    h ^= h >> 16;
+    return h;
+}
+
+/**
+ * @brief Get slot for symbol hash with given bucket seed
+ * Seed is split into displacement pair (d0, d1): slot = (h1 + d0 * h2 + d1) % size
+ * @param hash symbol hash
+ * @param seed bucket seed
+ * @param size number of slots
+ * @return slot index
+ */
+constexpr std::size_t perfect_hash_slot(uint32_t hash, uint32_t seed, std::size_t size) {
+    const uint32_t h = perfect_hash_mix(hash, 1);
+    const std::size_t h1 = h % size;
+    const std::size_t h2 = (h >> 16) % size;
+    return (h1 + (seed / size) * h2 + seed % size) % size;
+}
+
+constexpr std::size_t perfect_hash_bucket_count(std::size_t n) {
+    return std::max<std::size_t>((n + PERFECT_HASH_BUCKET_SIZE - 1) / PERFECT_HASH_BUCKET_SIZE, 1);
+}
+
+/**
+ * @brief Build minimal perfect hash table from API entries.
+ * Usage: static constexpr auto table = make_perfect_hashtable(api_methods);
+ *        static_assert(table.valid, "Can't build perfect hash table");
+ * @param entries API entries with unique hashes, in any order
+ * @return PerfectHashtable, valid is false if construction failed
+ */
+template <std::size_t N, std::size_t B = perfect_hash_bucket_count(N)>
+constexpr auto make_perfect_hashtable(const std::array<sym_entry, N>& entries) {
+    PerfectHashtable<N, B> result{};
+    result.valid = true;
+
+    // Group entries by bucket, precompute displacement pairs
+    uint16_t bucket_start[B + 1] = {};
+    uint16_t bucket[N] = {};
+    uint32_t h1[N] = {};
+    uint32_t h2[N] = {};
+    for(std::size_t i = 0; i < N; i++) {
+        bucket[i] = perfect_hash_mix(entries[i].hash, 0) % B;
+        bucket_start[bucket[i] + 1]++;
+
+        const uint32_t h = perfect_hash_mix(entries[i].hash, 1);
+        h1[i] = h % N;
+        h2[i] = (h >> 16) % N;
+    }
+
+    std::size_t bucket_size_max = 0;
+    for(std::size_t b = 0; b < B; b++) {
+        bucket_size_max = std::max<std::size_t>(bucket_size_max, bucket_start[b + 1]);
+        bucket_start[b + 1] += bucket_start[b];
+    }
+
+    uint16_t members[N] = {};
+    uint16_t fill[B] = {};
+    for(std::size_t i = 0; i < N; i++) {
+        members[bucket_start[bucket[i]] + fill[bucket[i]]++] = i;
+    }
+
+    // Place largest buckets first, while most slots are still free
+    bool taken[N] = {};
+    std::size_t base[N] = {};
+    std::size_t slots[N] = {};
+    for(std::size_t size = bucket_size_max; size > 0; size--) {
+        for(std::size_t b = 0; b < B; b++) {
+            if(std::size_t(bucket_start[b + 1] - bucket_start[b]) != size) continue;
+            const uint16_t* bucket_members = &members[bucket_start[b]];
+
+            bool placed = false;
+            for(std::size_t d0 = 0; d0 * N <= PERFECT_HASH_SEED_MAX && !placed; d0++) {
+                for(std::size_t i = 0; i < size; i++) {
+                    base[i] = (h1[bucket_members[i]] + d0 * h2[bucket_members[i]]) % N;
+                }
+
+                for(std::size_t d1 = 0; d1 < N && d0 * N + d1 <= PERFECT_HASH_SEED_MAX; d1++) {
+                    placed = true;
+                    for(std::size_t i = 0; i < size && placed; i++) {
+                        slots[i] = base[i] + d1;
+                        if(slots[i] >= N) slots[i] -= N;
+                        placed = !taken[slots[i]];
+                        for(std::size_t j = 0; j < i && placed; j++) {
+                            placed = slots[i] != slots[j];
+                        }
+                    }
+
+                    if(placed) {
+                        result.seeds[b] = d0 * N + d1;
+                        for(std::size_t i = 0; i < size; i++) {
+                            taken[slots[i]] = true;
+                            result.table[slots[i]] = entries[bucket_members[i]];
+                        }
+                        break;
+                    }
+                }
+            }
+
+            if(!placed) {
+                result.valid = false;
+                return result;
+            }
+        }
+    }
+
+    return result;
+}
+
+/**
+ * @brief Find API entry in perfect hash table
+ * @param table table slots
+ * @param table_size number of slots
+ * @param seeds bucket seeds
+ * @param seed_count number of buckets
+ * @param hash gnu hash of function name
+ * @return pointer to entry or nullptr if not found
+ */
+constexpr const sym_entry* perfect_hashtable_find(
+    const sym_entry* table,
+    std::size_t table_size,
+    const uint16_t* seeds,
+    std::size_t seed_count,
+    uint32_t hash) {
+    if(table_size == 0) return nullptr;
+
+    const uint16_t seed = seeds[perfect_hash_mix(hash, 0) % seed_count];
+    const sym_entry* entry = &table[perfect_hash_slot(hash, seed, table_size)];
+    return (entry->hash == hash) ? entry : nullptr;
+}
+
+/* Compile-time check that every API entry is found in perfect hash table.
+ * Usage: static_assert(perfect_hashtable_contains_all(table, api_methods), "Lookup failed");
+ */
+template <std::size_t N, std::size_t B>
+constexpr bool perfect_hashtable_contains_all(
+    const PerfectHashtable<N, B>& table,
+    const std::array<sym_entry, N>& entries) {
+    for(const sym_entry& entry : entries) {
+        if(!perfect_hashtable_find(table.table.data(), N, table.seeds.data(), B, entry.hash)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
 /* Compile-time check for hash collisions in API table.
  * Usage: static_assert(!has_hash_collisions(api_methods), "Hash collision detected"); 
  */
@@ -0,0 +1,433 @@
+#include "application_catalog.h"
+#include <loader/firmware_api/firmware_api.h>
+
+#include <m-array.h>
+
+#define TAG "AppCatalog"
+
+#define APPLICATION_CATALOG_DIR      EXT_PATH(".cache")
+#define APPLICATION_CATALOG_PATH     APPLICATION_CATALOG_DIR "/apps.idx"
+#define APPLICATION_CATALOG_TMP_PATH APPLICATION_CATALOG_DIR "/apps.tmp"
+
+#define APPLICATION_CATALOG_MAGIC       (0x54414346U) // "FCAT", little endian
+#define APPLICATION_CATALOG_VERSION     (1U)
+#define APPLICATION_CATALOG_MAX_ENTRIES (1024U)
+
+#define APPLICATION_CATALOG_HASH_BASIS  (0x811C9DC5U) // FNV-1a offset basis
+#define APPLICATION_CATALOG_CHECK_BASIS (0x5BD1E995U)
+
+/* Index file layout:
+ * [ApplicationCatalogHeader][ApplicationCatalogKey * count][ApplicationCatalogRecord * count]
+ *
+ * Keys are sorted by path hash. They are loaded to RAM on alloc, so lookup is
+ * a binary search followed by a single record read.
+ */
+
+typedef struct FURI_PACKED {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t record_size;
+    uint32_t seed; /**< Firmware API table, entries are dropped when it changes */
+    uint32_t count;
+} ApplicationCatalogHeader;
+
+typedef struct {
+    uint32_t path_hash;
+    uint32_t timestamp;
+} ApplicationCatalogKey;
+
+typedef struct FURI_PACKED {
+    uint32_t path_check; /**< Second path hash, guards against key collisions */
+    uint8_t status; /**< FlipperApplicationPreloadStatus */
+    FlipperApplicationManifest manifest;
+} ApplicationCatalogRecord;
+
+typedef struct {
+    ApplicationCatalogKey key;
+    ApplicationCatalogRecord record;
+} ApplicationCatalogEntry;
+
+ARRAY_DEF(ApplicationCatalogEntryList, ApplicationCatalogEntry, M_POD_OPLIST) // NOLINT
+
+struct ApplicationCatalog {
+    Storage* storage;
+    uint32_t seed;
+    File* file; /**< Index file, NULL if there is none */
+    size_t count; /**< Number of entries in index file */
+    ApplicationCatalogKey* keys;
+    uint32_t* used; /**< Bit per index file entry, set when entry was looked up */
+    ApplicationCatalogEntryList_t entries; /**< Entries added since load, sorted by path hash */
+};
+
+static uint32_t application_catalog_hash(const char* str, uint32_t hash) {
+    // FNV-1a
+    while(*str) {
+        hash ^= (uint8_t)*str++;
+        hash *= 16777619U;
+    }
+    return hash;
+}
+
+static size_t application_catalog_records_offset(size_t count) {
+    return sizeof(ApplicationCatalogHeader) + sizeof(ApplicationCatalogKey) * count;
+}
+
+static void application_catalog_load(ApplicationCatalog* catalog) {
+    File* file = storage_file_alloc(catalog->storage);
+    ApplicationCatalogHeader header;
+    bool success = false;
+
+    do {
+        if(!storage_file_open(file, APPLICATION_CATALOG_PATH, FSAM_READ, FSOM_OPEN_EXISTING)) {
+            break;
+        }
+
+        if(storage_file_read(file, &header, sizeof(header)) != sizeof(header)) break;
+        if(header.magic != APPLICATION_CATALOG_MAGIC ||
+           header.version != APPLICATION_CATALOG_VERSION ||
+           header.record_size != sizeof(ApplicationCatalogRecord) ||
+           header.seed != catalog->seed || header.count == 0 ||
+           header.count > APPLICATION_CATALOG_MAX_ENTRIES) {
+            break;
+        }
+
+        if(storage_file_size(file) != application_catalog_records_offset(header.count) +
+                                          sizeof(ApplicationCatalogRecord) * header.count) {
+            break;
+        }
+
+        const size_t keys_size = sizeof(ApplicationCatalogKey) * header.count;
+        catalog->keys = malloc(keys_size);
+        if(storage_file_read(file, catalog->keys, keys_size) != keys_size) {
+            free(catalog->keys);
+            catalog->keys = NULL;
+            break;
+        }
+
+        success = true;
+    } while(false);
+
+    if(success) {
+        catalog->file = file;
+        catalog->count = header.count;
+        catalog->used = malloc(sizeof(uint32_t) * ((header.count + 31) / 32));
+        memset(catalog->used, 0, sizeof(uint32_t) * ((header.count + 31) / 32));
+    } else {
+        storage_file_free(file);
+    }
+}
+
+static void application_catalog_unload(ApplicationCatalog* catalog) {
+    if(catalog->file) {
+        storage_file_free(catalog->file);
+        free(catalog->keys);
+        free(catalog->used);
+        catalog->file = NULL;
+        catalog->keys = NULL;
+        catalog->used = NULL;
+        catalog->count = 0;
+    }
+}
+
+ApplicationCatalog* application_catalog_alloc(Storage* storage) {
+    furi_check(storage);
+
+    ApplicationCatalog* catalog = malloc(sizeof(ApplicationCatalog));
+    catalog->storage = storage;
+    catalog->file = NULL;
+    catalog->count = 0;
+    catalog->keys = NULL;
+    catalog->used = NULL;
+    ApplicationCatalogEntryList_init(catalog->entries);
+
+    // API compatibility of entries depends on firmware API table
+    catalog->seed = firmware_api_get_hash();
+
+    application_catalog_load(catalog);
+
+    return catalog;
+}
+
+void application_catalog_free(ApplicationCatalog* catalog) {
+    furi_check(catalog);
+
+    application_catalog_save(catalog);
+    application_catalog_unload(catalog);
+    ApplicationCatalogEntryList_clear(catalog->entries);
+    free(catalog);
+}
+
+static bool application_catalog_find_in_file(
+    ApplicationCatalog* catalog,
+    const ApplicationCatalogKey* key,
+    ApplicationCatalogRecord* record) {
+    size_t low = 0;
+    size_t high = catalog->count;
+    while(low < high) {
+        const size_t middle = low + (high - low) / 2;
+        if(catalog->keys[middle].path_hash < key->path_hash) {
+            low = middle + 1;
+        } else {
+            high = middle;
+        }
+    }
+
+    if(low == catalog->count || catalog->keys[low].path_hash != key->path_hash ||
+       catalog->keys[low].timestamp != key->timestamp) {
+        return false;
+    }
+
+    const size_t offset = application_catalog_records_offset(catalog->count) +
+                          sizeof(ApplicationCatalogRecord) * low;
+    if(!storage_file_seek(catalog->file, offset, true) ||
+       storage_file_read(catalog->file, record, sizeof(ApplicationCatalogRecord)) !=
+           sizeof(ApplicationCatalogRecord)) {
+        return false;
+    }
+
+    catalog->used[low / 32] |= 1UL << (low % 32);
+    return true;
+}
+
+static bool application_catalog_find(
+    ApplicationCatalog* catalog,
+    const ApplicationCatalogKey* key,
+    uint32_t path_check,
+    ApplicationCatalogRecord* record) {
+    // Entries added in this session replace ones from the file
+    const size_t size = ApplicationCatalogEntryList_size(catalog->entries);
+    for(size_t i = 0; i < size; i++) {
+        const ApplicationCatalogEntry* entry =
+            ApplicationCatalogEntryList_cget(catalog->entries, i);
+        if(entry->key.path_hash == key->path_hash) {
+            *record = entry->record;
+            return entry->key.timestamp == key->timestamp && record->path_check == path_check;
+        }
+    }
+
+    bool found = false;
+    if(catalog->file) {
+        found = application_catalog_find_in_file(catalog, key, record);
+    }
+
+    return found && record->path_check == path_check;
+}
+
+static void application_catalog_add(
+    ApplicationCatalog* catalog,
+    const ApplicationCatalogKey* key,
+    const ApplicationCatalogRecord* record) {
+    const ApplicationCatalogEntry new_entry = {.key = *key, .record = *record};
+
+    size_t index = 0;
+    const size_t size = ApplicationCatalogEntryList_size(catalog->entries);
+    while(index < size) {
+        ApplicationCatalogEntry* entry = ApplicationCatalogEntryList_get(catalog->entries, index);
+        if(entry->key.path_hash == key->path_hash) {
+            *entry = new_entry;
+            return;
+        } else if(entry->key.path_hash > key->path_hash) {
+            break;
+        }
+        index++;
+    }
+
+    ApplicationCatalogEntryList_push_at(catalog->entries, index, new_entry);
+}
+
+FlipperApplicationPreloadStatus application_catalog_get_manifest(
+    ApplicationCatalog* catalog,
+    const char* path,
+    FlipperApplicationManifest* manifest) {
+    furi_check(catalog);
+    furi_check(path);
+    furi_check(manifest);
+
+    ApplicationCatalogKey key = {
+        .path_hash = application_catalog_hash(path, APPLICATION_CATALOG_HASH_BASIS),
+    };
+    if(storage_common_timestamp(catalog->storage, path, &key.timestamp) != FSE_OK) {
+        return FlipperApplicationPreloadStatusInvalidFile;
+    }
+
+    ApplicationCatalogRecord record;
+    const uint32_t path_check = application_catalog_hash(path, APPLICATION_CATALOG_CHECK_BASIS);
+    if(application_catalog_find(catalog, &key, path_check, &record)) {
+        memcpy(manifest, &record.manifest, sizeof(FlipperApplicationManifest));
+        return record.status;
+    }
+
+    FlipperApplication* app = flipper_application_alloc(catalog->storage, firmware_api_interface);
+    const FlipperApplicationPreloadStatus status =
+        flipper_application_preload_manifest(app, path);
+
+    // Read errors may be temporary, don't remember them
+    if(status != FlipperApplicationPreloadStatusInvalidFile &&
+       status != FlipperApplicationPreloadStatusNotEnoughMemory) {
+        record.path_check = path_check;
+        record.status = status;
+        memcpy(
+            &record.manifest,
+            flipper_application_get_manifest(app),
+            sizeof(FlipperApplicationManifest));
+        memcpy(manifest, &record.manifest, sizeof(FlipperApplicationManifest));
+        application_catalog_add(catalog, &key, &record);
+    }
+
+    flipper_application_free(app);
+    return status;
+}
+
+bool application_catalog_load_name_and_icon(
+    ApplicationCatalog* catalog,
+    FuriString* path,
+    uint8_t** icon_ptr,
+    FuriString* item_name) {
+    furi_check(catalog);
+    furi_check(path);
+    furi_check(icon_ptr);
+    furi_check(item_name);
+
+    FlipperApplicationManifest* manifest = malloc(sizeof(FlipperApplicationManifest));
+    const FlipperApplicationPreloadStatus status =
+        application_catalog_get_manifest(catalog, furi_string_get_cstr(path), manifest);
+
+    const bool load_success = status == FlipperApplicationPreloadStatusSuccess;
+    if(load_success) {
+        if(manifest->has_icon) {
+            memcpy(*icon_ptr, manifest->icon, FAP_MANIFEST_MAX_ICON_SIZE);
+        }
+        furi_string_set(item_name, manifest->name);
+    } else {
+        FURI_LOG_E(TAG, "Failed to preload %s", furi_string_get_cstr(path));
+    }
+
+    free(manifest);
+    return load_success;
+}
+
+static bool application_catalog_is_used(ApplicationCatalog* catalog, size_t index) {
+    return catalog->used[index / 32] & (1UL << (index % 32));
+}
+
+/* Merge index file entries with the ones added in this session.
+ * Values below catalog->count refer to index file entries, others to added entries.
+ */
+static size_t application_catalog_merge(ApplicationCatalog* catalog, uint32_t* sources) {
+    const size_t added = ApplicationCatalogEntryList_size(catalog->entries);
+    size_t total = 0;
+    size_t i = 0, j = 0;
+
+    while(i < catalog->count || j < added) {
+        const ApplicationCatalogEntry* entry =
+            j < added ? ApplicationCatalogEntryList_cget(catalog->entries, j) : NULL;
+        if(entry && (i == catalog->count || entry->key.path_hash <= catalog->keys[i].path_hash)) {
+            // Updated entry replaces the one from the file
+            if(i < catalog->count && catalog->keys[i].path_hash == entry->key.path_hash) i++;
+            sources[total++] = catalog->count + j++;
+        } else {
+            sources[total++] = i++;
+        }
+    }
+
+    // Apps were removed or renamed, forget entries nobody asked for
+    if(total > APPLICATION_CATALOG_MAX_ENTRIES) {
+        size_t kept = 0;
+        for(size_t k = 0; k < total; k++) {
+            if(sources[k] >= catalog->count || application_catalog_is_used(catalog, sources[k])) {
+                sources[kept++] = sources[k];
+            }
+        }
+        total = MIN(kept, (size_t)APPLICATION_CATALOG_MAX_ENTRIES);
+    }
+
+    return total;
+}
+
+static bool application_catalog_write(
+    ApplicationCatalog* catalog,
+    File* file,
+    const uint32_t* sources,
+    size_t total) {
+    const ApplicationCatalogHeader header = {
+        .magic = APPLICATION_CATALOG_MAGIC,
+        .version = APPLICATION_CATALOG_VERSION,
+        .record_size = sizeof(ApplicationCatalogRecord),
+        .seed = catalog->seed,
+        .count = total,
+    };
+    if(storage_file_write(file, &header, sizeof(header)) != sizeof(header)) return false;
+
+    for(size_t k = 0; k < total; k++) {
+        const ApplicationCatalogKey* key =
+            sources[k] < catalog->count ?
+                &catalog->keys[sources[k]] :
+                &ApplicationCatalogEntryList_cget(catalog->entries, sources[k] - catalog->count)
+                     ->key;
+        if(storage_file_write(file, key, sizeof(ApplicationCatalogKey)) !=
+           sizeof(ApplicationCatalogKey)) {
+            return false;
+        }
+    }
+
+    ApplicationCatalogRecord record;
+    for(size_t k = 0; k < total; k++) {
+        if(sources[k] < catalog->count) {
+            const size_t offset = application_catalog_records_offset(catalog->count) +
+                                  sizeof(ApplicationCatalogRecord) * sources[k];
+            if(!storage_file_seek(catalog->file, offset, true) ||
+               storage_file_read(catalog->file, &record, sizeof(record)) != sizeof(record)) {
+                return false;
+            }
+        } else {
+            record =
+                ApplicationCatalogEntryList_cget(catalog->entries, sources[k] - catalog->count)
+                    ->record;
+        }
+
+        if(storage_file_write(file, &record, sizeof(record)) != sizeof(record)) return false;
+    }
+
+    return true;
+}
+
+bool application_catalog_save(ApplicationCatalog* catalog) {
+    furi_check(catalog);
+
+    const size_t added = ApplicationCatalogEntryList_size(catalog->entries);
+    if(added == 0) return true;
+
+    if(!storage_simply_mkdir(catalog->storage, APPLICATION_CATALOG_DIR)) return false;
+
+    uint32_t* sources = malloc(sizeof(uint32_t) * (catalog->count + added));
+    const size_t total = application_catalog_merge(catalog, sources);
+
+    File* file = storage_file_alloc(catalog->storage);
+    bool success =
+        storage_file_open(file, APPLICATION_CATALOG_TMP_PATH, FSAM_WRITE, FSOM_CREATE_ALWAYS) &&
+        application_catalog_write(catalog, file, sources, total);
+    storage_file_free(file);
+    free(sources);
+
+    // Index file must be closed before it is replaced
+    application_catalog_unload(catalog);
+
+    if(success) {
+        storage_common_remove(catalog->storage, APPLICATION_CATALOG_PATH);
+        success = storage_common_rename(
+                      catalog->storage, APPLICATION_CATALOG_TMP_PATH, APPLICATION_CATALOG_PATH) ==
+                  FSE_OK;
+    } else {
+        FURI_LOG_W(TAG, "Can't save application catalogue");
+        storage_common_remove(catalog->storage, APPLICATION_CATALOG_TMP_PATH);
+    }
+
+    if(success) {
+        FURI_LOG_D(TAG, "Saved %zu entries, %zu new", total, added);
+    }
+
+    ApplicationCatalogEntryList_reset(catalog->entries);
+    application_catalog_load(catalog);
+
+    return success;
+}
@@ -0,0 +1,77 @@
+/**
+ * @file application_catalog.h
+ * Flipper application catalogue
+ *
+ * Persistent index of application manifests, stored on SD card.
+ * Lets file browsers show application names and icons without opening every .fap.
+ * Entries are keyed on file path and timestamp, changed applications are parsed
+ * again on first access and the index is updated incrementally.
+ */
+#pragma once
+
+#include "flipper_application.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct ApplicationCatalog ApplicationCatalog;
+
+/** Allocate ApplicationCatalog instance and load index from SD card
+ *
+ * Instance is not thread safe, use it from one thread at a time.
+ *
+ * @param storage Storage instance
+ * @return ApplicationCatalog instance
+ */
+ApplicationCatalog* application_catalog_alloc(Storage* storage);
+
+/** Save pending changes and free ApplicationCatalog instance
+ *
+ * @param catalog ApplicationCatalog instance
+ */
+void application_catalog_free(ApplicationCatalog* catalog);
+
+/** Write new and updated entries to SD card
+ *
+ * Called automatically by application_catalog_free.
+ *
+ * @param catalog ApplicationCatalog instance
+ * @return true if index is up to date on SD card
+ */
+bool application_catalog_save(ApplicationCatalog* catalog);
+
+/** Get application manifest and its compatibility with current firmware
+ *
+ * Manifest is taken from the index if application file is unchanged,
+ * otherwise it is parsed from the file and added to the index.
+ *
+ * @param catalog ApplicationCatalog instance
+ * @param path Path to FAP file
+ * @param manifest Manifest, valid unless status is InvalidFile or NotEnoughMemory
+ * @return Preload status, same as flipper_application_preload_manifest would return
+ */
+FlipperApplicationPreloadStatus application_catalog_get_manifest(
+    ApplicationCatalog* catalog,
+    const char* path,
+    FlipperApplicationManifest* manifest);
+
+/** Load name and icon from FAP file, using the index when possible
+ *
+ * Same as flipper_application_load_name_and_icon.
+ *
+ * @param catalog ApplicationCatalog instance
+ * @param path Path to FAP file.
+ * @param icon_ptr Icon pointer.
+ * @param item_name Application name.
+ * @return true if icon and name were loaded successfully.
+ */
+bool application_catalog_load_name_and_icon(
+    ApplicationCatalog* catalog,
+    FuriString* path,
+    uint8_t** icon_ptr,
+    FuriString* item_name);
+
+#ifdef __cplusplus
+}
+#endif
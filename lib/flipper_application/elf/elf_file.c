@@ -6,6 +6,10 @@
 #include "elf_api_interface.h"
 #include "../api_hashtable/api_hashtable.h"
 
+#include <toolbox/crc32_calc.h>
+
+#include <m-array.h>
+
 #define TAG "Elf"
 
 #define ELF_NAME_BUFFER_LEN 32
@@ -13,6 +17,14 @@
 #define IS_FLAGS_SET(v, m) (((v) & (m)) == (m))
 #define RESOLVER_THREAD_YIELD_STEP 30
 #define FAST_RELOCATION_VERSION 1
+#define FAST_RELOCATION_RESOLVED_VERSION (FAST_RELOCATION_VERSION | 0x80)
+#define FAST_RELOCATION_OFFSET_MAX 0x00FFFFFF
+
+#define RELOCATION_CACHE_MAGIC 0x43524C45 // "ELRC", little endian
+#define RELOCATION_CACHE_VERSION 2
+#define RELOCATION_CACHE_TMP_SUFFIX ".tmp"
+#define RELOCATION_CACHE_HASH_SEED 0x811C9DC5
+#define RELOCATION_CACHE_HASH_PRIME 0x01000193
 
 // #define ELF_DEBUG_LOG 1
 
@@ -55,6 +67,62 @@ static void address_cache_put(AddressCache_t cache, int symEntry, Elf32_Addr sym
     AddressCache_set_at(cache, symEntry, symAddr);
 }
 
+/* Relocation cache file layout, all fields are little endian:
+ * [RelocationCacheHeader][RelocationCacheSection][records] * section_count
+ *
+ * Records use .fast.rel layout, but symbol hashes are replaced with resolved addresses.
+ * Section relative records are kept as is, so cache doesn't depend on load address.
+ * Sections go in the same order as in ELFFile::sections.
+ * Checksum is CRC32 of everything after the header.
+ */
+
+typedef struct FURI_PACKED {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t section_count;
+    uint32_t key;
+    uint32_t payload_size;
+    uint32_t checksum;
+} RelocationCacheHeader;
+
+typedef struct FURI_PACKED {
+    uint16_t sec_idx;
+    uint16_t reserved;
+    uint32_t size;
+} RelocationCacheSection;
+
+typedef enum {
+    RelocationCacheResultMiss, /**< No usable cache, sections are untouched */
+    RelocationCacheResultHit, /**< Sections are relocated from cache */
+    RelocationCacheResultError, /**< Replay failed and sections can't be restored */
+} RelocationCacheResult;
+
+typedef struct {
+    uint16_t shndx; /**< SHN_UNDEF for API symbols */
+    Elf32_Addr value; /**< Resolved address for API symbols, offset in section otherwise */
+} RelocationCacheSymbol;
+
+DICT_DEF2(RelocationCacheSymbols, int, M_DEFAULT_OPLIST, RelocationCacheSymbol, M_POD_OPLIST)
+
+ARRAY_DEF(RelocationCacheOffsets, uint32_t, M_DEFAULT_OPLIST)
+#define M_OPL_RelocationCacheOffsets_t() ARRAY_OPLIST(RelocationCacheOffsets, M_DEFAULT_OPLIST)
+
+/* Key is symbol index and relocation type: (symEntry << 8) | type */
+DICT_DEF2(
+    RelocationCacheGroups,
+    uint32_t,
+    M_DEFAULT_OPLIST,
+    RelocationCacheOffsets_t,
+    M_OPL_RelocationCacheOffsets_t())
+
+typedef struct {
+    File* file;
+    RelocationCacheHeader header;
+    RelocationCacheSymbols_t symbols;
+    RelocationCacheGroups_t groups;
+    bool failed;
+} RelocationCacheWriter;
+
 /**************************************************************************************************/
 /********************************************** ELF ***********************************************/
 /**************************************************************************************************/
@@ -356,7 +424,116 @@ static bool elf_relocate_symbol(ELFFile* elf, Elf32_Addr relAddr, int type, Elf3
     return true;
 }
 
-static bool elf_relocate(ELFFile* elf, ELFSection* s) {
+static uint8_t* relocation_cache_put_u32(uint8_t* data, uint32_t value) {
+    memcpy(data, &value, sizeof(uint32_t));
+    return data + sizeof(uint32_t);
+}
+
+static void relocation_cache_writer_put_section(
+    RelocationCacheWriter* writer,
+    ELFSection* s,
+    const uint8_t* data,
+    size_t size) {
+    RelocationCacheSection entry = {
+        .sec_idx = s->sec_idx,
+        .reserved = 0,
+        .size = size,
+    };
+
+    if(storage_file_write(writer->file, &entry, sizeof(entry)) != sizeof(entry) ||
+       storage_file_write(writer->file, data, size) != size) {
+        FURI_LOG_W(TAG, "Relocation cache write failed");
+        writer->failed = true;
+    }
+
+    writer->header.checksum = crc32_calc_buffer(writer->header.checksum, &entry, sizeof(entry));
+    writer->header.checksum = crc32_calc_buffer(writer->header.checksum, data, size);
+    writer->header.payload_size += sizeof(entry) + size;
+}
+
+static void relocation_cache_writer_add_symbol(
+    RelocationCacheWriter* writer,
+    int symEntry,
+    const Elf32_Sym* sym,
+    Elf32_Addr symAddr) {
+    RelocationCacheSymbol symbol = {
+        .shndx = sym->st_shndx,
+        .value = (sym->st_shndx == SHN_UNDEF) ? symAddr : sym->st_value,
+    };
+    RelocationCacheSymbols_set_at(writer->symbols, symEntry, symbol);
+}
+
+static void relocation_cache_writer_add_offset(
+    RelocationCacheWriter* writer,
+    int symEntry,
+    int type,
+    Elf32_Addr offset) {
+    if(offset > FAST_RELOCATION_OFFSET_MAX || type > 0x7F) {
+        writer->failed = true;
+        return;
+    }
+
+    RelocationCacheOffsets_t* offsets =
+        RelocationCacheGroups_safe_get(writer->groups, ((uint32_t)symEntry << 8) | type);
+    RelocationCacheOffsets_push_back(*offsets, offset);
+}
+
+/* Pack offsets collected for section into resolved .fast.rel records */
+static void relocation_cache_writer_flush_section(RelocationCacheWriter* writer, ELFSection* s) {
+    RelocationCacheGroups_it_t it;
+
+    size_t size = 1 + sizeof(uint32_t);
+    for(RelocationCacheGroups_it(it, writer->groups); !RelocationCacheGroups_end_p(it);
+        RelocationCacheGroups_next(it)) {
+        const RelocationCacheGroups_itref_t* itref = RelocationCacheGroups_cref(it);
+        const RelocationCacheSymbol* symbol =
+            RelocationCacheSymbols_cget(writer->symbols, itref->key >> 8);
+        furi_check(symbol);
+
+        size += 1 + sizeof(uint32_t) * 2 + 3 * RelocationCacheOffsets_size(itref->value);
+        if(symbol->shndx != SHN_UNDEF) {
+            size += sizeof(uint32_t);
+        }
+    }
+
+    // Extra byte, offsets are read as 32 bit words
+    uint8_t* data = malloc(size + 1);
+    uint8_t* p = data;
+
+    *p++ = FAST_RELOCATION_RESOLVED_VERSION;
+    p = relocation_cache_put_u32(p, RelocationCacheGroups_size(writer->groups));
+
+    for(RelocationCacheGroups_it(it, writer->groups); !RelocationCacheGroups_end_p(it);
+        RelocationCacheGroups_next(it)) {
+        const RelocationCacheGroups_itref_t* itref = RelocationCacheGroups_cref(it);
+        const RelocationCacheSymbol* symbol =
+            RelocationCacheSymbols_cget(writer->symbols, itref->key >> 8);
+        const bool is_section = symbol->shndx != SHN_UNDEF;
+
+        *p++ = (itref->key & 0x7F) | (is_section ? (0x1 << 7) : 0);
+        if(is_section) {
+            p = relocation_cache_put_u32(p, symbol->shndx);
+        }
+        p = relocation_cache_put_u32(p, symbol->value);
+        p = relocation_cache_put_u32(p, RelocationCacheOffsets_size(itref->value));
+
+        RelocationCacheOffsets_it_t offset_it;
+        for(RelocationCacheOffsets_it(offset_it, itref->value);
+            !RelocationCacheOffsets_end_p(offset_it);
+            RelocationCacheOffsets_next(offset_it)) {
+            const uint32_t offset = *RelocationCacheOffsets_cref(offset_it);
+            memcpy(p, &offset, 3);
+            p += 3;
+        }
+    }
+
+    relocation_cache_writer_put_section(writer, s, data, size);
+    free(data);
+
+    RelocationCacheGroups_reset(writer->groups);
+}
+
+static bool elf_relocate(ELFFile* elf, ELFSection* s, RelocationCacheWriter* writer) {
     if(s->data) {
         Elf32_Rel rel;
         size_t relEntries = s->rel_count;
@@ -405,6 +582,10 @@ static bool elf_relocate(ELFFile* elf, ELFSection* s) {
 
                 symAddr = elf_address_of(elf, &sym, furi_string_get_cstr(symbol_name));
                 address_cache_put(elf->relocation_cache, symEntry, symAddr);
+
+                if(writer) {
+                    relocation_cache_writer_add_symbol(writer, symEntry, &sym, symAddr);
+                }
             }
 
             if(symAddr != ELF_INVALID_ADDRESS) {
@@ -415,6 +596,8 @@ static bool elf_relocate(ELFFile* elf, ELFSection* s) {
                     (unsigned int)relAddr);
                 if(!elf_relocate_symbol(elf, relAddr, relType, symAddr)) {
                     relocate_result = false;
+                } else if(writer) {
+                    relocation_cache_writer_add_offset(writer, symEntry, relType, rel.r_offset);
                 }
             } else {
                 FURI_LOG_E(TAG, "  No symbol address of %s", furi_string_get_cstr(symbol_name));
@@ -423,6 +606,10 @@ static bool elf_relocate(ELFFile* elf, ELFSection* s) {
         }
         furi_string_free(symbol_name);
 
+        if(relocate_result && writer && !writer->failed) {
+            relocation_cache_writer_flush_section(writer, s);
+        }
+
         return relocate_result;
     } else {
         FURI_LOG_D(TAG, "Section not loaded");
@@ -685,16 +872,27 @@ static bool elf_file_find_string_by_hash(ELFFile* elf, uint32_t hash, FuriString
     return result;
 }
 
-static bool elf_relocate_fast(ELFFile* elf, ELFSection* s) {
-    UNUSED(elf);
-    const uint8_t* start = s->fast_rel->data;
+static void elf_section_free_fast_rel(ELFSection* s) {
+    if(s->fast_rel) {
+        aligned_free(s->fast_rel->data);
+        free(s->fast_rel);
+        s->fast_rel = NULL;
+    }
+}
+
+/* Apply .fast.rel records, either with symbol hashes or with resolved addresses.
+ * If resolve_in_place is set, hashes are replaced with resolved addresses on success. */
+static bool
+    elf_relocate_records(ELFFile* elf, ELFSection* s, uint8_t* data, bool resolve_in_place) {
+    uint8_t* start = data;
     const uint8_t version = *start;
     bool no_errors = true;
 
-    if(version != FAST_RELOCATION_VERSION) {
+    if(version != FAST_RELOCATION_VERSION && version != FAST_RELOCATION_RESOLVED_VERSION) {
         FURI_LOG_E(TAG, "Unsupported fast relocation version %d", version);
         return false;
     }
+    const bool is_resolved = (version == FAST_RELOCATION_RESOLVED_VERSION);
     start += 1;
 
     const uint32_t records_count = *((uint32_t*)start);
@@ -705,6 +903,7 @@ static bool elf_relocate_fast(ELFFile* elf, ELFSection* s) {
         bool is_section = (*start & (0x1 << 7)) ? true : false;
         uint8_t type = *start & 0x7F;
         start += 1;
+        uint8_t* hash_or_section_index_p = start;
         uint32_t hash_or_section_index = *((uint32_t*)start);
         start += 4;
 
@@ -732,8 +931,13 @@ static bool elf_relocate_fast(ELFFile* elf, ELFSection* s) {
             if(symSec) {
                 address = ((Elf32_Addr)symSec->data) + section_value;
             }
+        } else if(is_resolved) {
+            address = hash_or_section_index;
         } else {
             address = elf_address_of_by_hash(elf, hash_or_section_index);
+            if(resolve_in_place) {
+                memcpy(hash_or_section_index_p, &address, sizeof(uint32_t));
+            }
         }
 
         if(address == ELF_INVALID_ADDRESS) {
@@ -764,20 +968,41 @@ static bool elf_relocate_fast(ELFFile* elf, ELFSection* s) {
         }
     }
 
-    aligned_free(s->fast_rel->data);
-    free(s->fast_rel);
-    s->fast_rel = NULL;
+    if(no_errors && resolve_in_place) {
+        data[0] = FAST_RELOCATION_RESOLVED_VERSION;
+    }
+
+    return no_errors;
+}
+
+static bool elf_relocate_fast(ELFFile* elf, ELFSection* s, RelocationCacheWriter* writer) {
+    bool no_errors = elf_relocate_records(elf, s, s->fast_rel->data, writer != NULL);
+
+    if(no_errors && writer && !writer->failed) {
+        relocation_cache_writer_put_section(writer, s, s->fast_rel->data, s->fast_rel->size);
+    }
+
+    elf_section_free_fast_rel(s);
 
     return no_errors;
 }
 
-static bool elf_relocate_section(ELFFile* elf, ELFSection* section) {
+static bool elf_section_has_relocations(const ELFSection* section) {
+    return section->fast_rel || section->rel_count;
+}
+
+static bool
+    elf_relocate_section(ELFFile* elf, ELFSection* section, RelocationCacheWriter* writer) {
     if(section->fast_rel) {
         FURI_LOG_D(TAG, "Fast relocating section");
-        return elf_relocate_fast(elf, section);
+        return elf_relocate_fast(elf, section, writer);
     } else if(section->rel_count) {
         FURI_LOG_D(TAG, "Relocating section");
-        return elf_relocate(elf, section);
+        if(writer && memmgr_heap_get_max_free_block() < section->rel_count * 16 + 1024) {
+            FURI_LOG_W(TAG, "Not enough memory for relocation cache");
+            writer->failed = true;
+        }
+        return elf_relocate(elf, section, (writer && !writer->failed) ? writer : NULL);
     } else {
         FURI_LOG_D(TAG, "No relocation index"); /* Not an error */
     }
@@ -803,12 +1028,313 @@ static void elf_file_call_section_list(ELFSection* section, bool reverse_order)
     }
 }
 
+static uint32_t relocation_cache_hash(uint32_t hash, const void* data, size_t size) {
+    const uint8_t* p = data;
+    for(size_t i = 0; i < size; i++) {
+        hash = (hash ^ p[i]) * RELOCATION_CACHE_HASH_PRIME;
+    }
+    return hash;
+}
+
+/* Key covers API version and the seed: firmware API table, file path, size and timestamp.
+ * Section contents are not hashed, cache replay is validated record by record instead. */
+static uint32_t elf_relocation_cache_key(ELFFile* elf) {
+    uint32_t hash = RELOCATION_CACHE_HASH_SEED;
+    hash = relocation_cache_hash(hash, &elf->relocation_cache_seed, sizeof(uint32_t));
+    hash = relocation_cache_hash(hash, &elf->api_interface->api_version_major, sizeof(uint16_t));
+    hash = relocation_cache_hash(hash, &elf->api_interface->api_version_minor, sizeof(uint16_t));
+    return hash;
+}
+
+static bool elf_relocation_type_supported(uint8_t type) {
+    switch(type) {
+    case R_ARM_TARGET1:
+    case R_ARM_ABS32:
+    case R_ARM_REL32:
+    case R_ARM_THM_PC22:
+    case R_ARM_CALL:
+    case R_ARM_THM_JUMP24:
+    case R_ARM_THM_MOVW_ABS_NC:
+    case R_ARM_THM_MOVT_ABS:
+        return true;
+    default:
+        return false;
+    }
+}
+
+/* Check cached records without applying them: layout, types and that every
+ * patched word and every referenced section are inside loaded data */
+static bool elf_relocation_cache_check_records(
+    ELFFile* elf,
+    const ELFSection* s,
+    const uint8_t* data,
+    size_t size) {
+    const uint8_t* p = data;
+    const uint8_t* end = data + size;
+    uint32_t value;
+
+    if(size < 1 + sizeof(uint32_t) || *p != FAST_RELOCATION_RESOLVED_VERSION) return false;
+    p += 1;
+
+    uint32_t records_count;
+    memcpy(&records_count, p, sizeof(uint32_t));
+    p += sizeof(uint32_t);
+
+    for(uint32_t i = 0; i < records_count; i++) {
+        if((size_t)(end - p) < 1 + sizeof(uint32_t) * 2) return false;
+
+        const bool is_section = (*p & (0x1 << 7)) ? true : false;
+        if(!elf_relocation_type_supported(*p & 0x7F)) return false;
+        p += 1;
+
+        memcpy(&value, p, sizeof(uint32_t));
+        p += sizeof(uint32_t);
+        if(is_section) {
+            const ELFSection* symSec = elf_section_of(elf, value);
+            if(!symSec || !symSec->data) return false;
+            if((size_t)(end - p) < sizeof(uint32_t) * 2) return false;
+            p += sizeof(uint32_t);
+        } else if(value == ELF_INVALID_ADDRESS) {
+            return false;
+        }
+
+        uint32_t offsets_count;
+        memcpy(&offsets_count, p, sizeof(uint32_t));
+        p += sizeof(uint32_t);
+        if(offsets_count > (size_t)(end - p) / 3) return false;
+
+        for(uint32_t j = 0; j < offsets_count; j++) {
+            const uint32_t offset = p[0] | (p[1] << 8) | (p[2] << 16);
+            if(offset + sizeof(uint32_t) > s->size) return false;
+            p += 3;
+        }
+    }
+
+    return p == end;
+}
+
+/* Reload relocatable sections from ELF file, undoing partially applied relocations */
+static bool elf_relocation_cache_restore_sections(ELFFile* elf) {
+    ELFSectionDict_it_t it;
+    for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it); ELFSectionDict_next(it)) {
+        ELFSection* section = &ELFSectionDict_ref(it)->value;
+        if(!elf_section_has_relocations(section) || !section->data) continue;
+
+        Elf32_Shdr section_header;
+        if(!elf_read_section_header(elf, section->sec_idx, &section_header) ||
+           section_header.sh_size != section->size) {
+            return false;
+        }
+        if(section_header.sh_type == SHT_NOBITS) continue;
+
+        if(!storage_file_seek(elf->fd, section_header.sh_offset, true) ||
+           storage_file_read(elf->fd, section->data, section->size) != section->size) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/* Read section entry and its records into buffer, growing it as needed */
+static bool elf_relocation_cache_read_section(
+    File* file,
+    RelocationCacheSection* entry,
+    uint8_t** buffer,
+    size_t* buffer_size,
+    size_t size_left) {
+    if(storage_file_read(file, entry, sizeof(RelocationCacheSection)) !=
+           sizeof(RelocationCacheSection) ||
+       size_left < sizeof(RelocationCacheSection) ||
+       entry->size > size_left - sizeof(RelocationCacheSection)) {
+        return false;
+    }
+
+    if(entry->size > *buffer_size) {
+        free(*buffer);
+        *buffer = NULL;
+        *buffer_size = 0;
+        if(memmgr_heap_get_max_free_block() < entry->size + 1024) {
+            FURI_LOG_W(TAG, "Not enough memory for relocation cache");
+            return false;
+        }
+        // Extra byte, offsets are read as 32 bit words
+        *buffer = malloc(entry->size + 1);
+        *buffer_size = entry->size;
+    }
+
+    return storage_file_read(file, *buffer, entry->size) == entry->size;
+}
+
+static RelocationCacheResult elf_relocation_cache_load(ELFFile* elf, uint32_t key) {
+    const char* path = furi_string_get_cstr(elf->relocation_cache_path);
+    File* file = storage_file_alloc(elf->storage);
+    RelocationCacheResult result = RelocationCacheResultMiss;
+    bool remove = false;
+    uint8_t* buffer = NULL;
+    size_t buffer_size = 0;
+    ELFSectionDict_it_t it;
+
+    do {
+        if(!storage_file_open(file, path, FSAM_READ, FSOM_OPEN_EXISTING)) break;
+        remove = true;
+
+        RelocationCacheHeader header;
+        if(storage_file_read(file, &header, sizeof(header)) != sizeof(header)) break;
+        if(header.magic != RELOCATION_CACHE_MAGIC || header.version != RELOCATION_CACHE_VERSION ||
+           header.key != key) {
+            FURI_LOG_D(TAG, "Relocation cache is stale");
+            break;
+        }
+
+        // Verify checksum and every record first: nothing is applied from a bad cache
+        bool valid = true;
+        size_t section_count = 0;
+        size_t size_left = header.payload_size;
+        uint32_t checksum = 0;
+        for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it);
+            ELFSectionDict_next(it)) {
+            const ELFSection* section = &ELFSectionDict_cref(it)->value;
+            if(!elf_section_has_relocations(section)) continue;
+
+            RelocationCacheSection entry;
+            if(!elf_relocation_cache_read_section(
+                   file, &entry, &buffer, &buffer_size, size_left) ||
+               entry.sec_idx != section->sec_idx || !section->data ||
+               !elf_relocation_cache_check_records(elf, section, buffer, entry.size)) {
+                valid = false;
+                break;
+            }
+
+            checksum = crc32_calc_buffer(checksum, &entry, sizeof(entry));
+            checksum = crc32_calc_buffer(checksum, buffer, entry.size);
+            size_left -= sizeof(entry) + entry.size;
+            section_count++;
+        }
+
+        if(!valid || section_count != header.section_count || size_left != 0 ||
+           checksum != header.checksum || !storage_file_eof(file)) {
+            FURI_LOG_W(TAG, "Relocation cache is invalid");
+            break;
+        }
+
+        if(!storage_file_seek(file, sizeof(header), true)) break;
+
+        for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it);
+            ELFSectionDict_next(it)) {
+            ELFSection* section = &ELFSectionDict_ref(it)->value;
+            if(!elf_section_has_relocations(section)) continue;
+
+            RelocationCacheSection entry;
+            if(!elf_relocation_cache_read_section(
+                   file, &entry, &buffer, &buffer_size, header.payload_size) ||
+               !elf_relocate_records(elf, section, buffer, false)) {
+                valid = false;
+                break;
+            }
+        }
+
+        if(!valid) {
+            FURI_LOG_E(TAG, "Relocation cache replay failed");
+            if(!elf_relocation_cache_restore_sections(elf)) {
+                result = RelocationCacheResultError;
+            }
+            break;
+        }
+
+        // Fast relocation data is not needed anymore
+        for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it);
+            ELFSectionDict_next(it)) {
+            elf_section_free_fast_rel(&ELFSectionDict_ref(it)->value);
+        }
+
+        result = RelocationCacheResultHit;
+    } while(false);
+
+    free(buffer);
+    storage_file_free(file);
+
+    if(result != RelocationCacheResultHit && remove) {
+        storage_common_remove(elf->storage, path);
+    }
+
+    return result;
+}
+
+static RelocationCacheWriter* elf_relocation_cache_writer_alloc(ELFFile* elf, uint32_t key) {
+    RelocationCacheHeader header = {
+        .magic = RELOCATION_CACHE_MAGIC,
+        .version = RELOCATION_CACHE_VERSION,
+        .section_count = 0,
+        .key = key,
+        .payload_size = 0,
+        .checksum = 0,
+    };
+
+    ELFSectionDict_it_t it;
+    for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it); ELFSectionDict_next(it)) {
+        if(elf_section_has_relocations(&ELFSectionDict_cref(it)->value)) {
+            header.section_count++;
+        }
+    }
+
+    FuriString* tmp_path = furi_string_alloc_printf(
+        "%s" RELOCATION_CACHE_TMP_SUFFIX, furi_string_get_cstr(elf->relocation_cache_path));
+    File* file = storage_file_alloc(elf->storage);
+
+    RelocationCacheWriter* writer = NULL;
+    if(storage_file_open(file, furi_string_get_cstr(tmp_path), FSAM_WRITE, FSOM_CREATE_ALWAYS) &&
+       storage_file_write(file, &header, sizeof(header)) == sizeof(header)) {
+        writer = malloc(sizeof(RelocationCacheWriter));
+        writer->file = file;
+        writer->header = header;
+        RelocationCacheSymbols_init(writer->symbols);
+        RelocationCacheGroups_init(writer->groups);
+    } else {
+        FURI_LOG_W(TAG, "Can't create relocation cache");
+        storage_file_free(file);
+    }
+
+    furi_string_free(tmp_path);
+    return writer;
+}
+
+static void
+    elf_relocation_cache_writer_free(ELFFile* elf, RelocationCacheWriter* writer, bool commit) {
+    // Header is rewritten with the checksum of everything written so far
+    if(commit && !writer->failed &&
+       (!storage_file_seek(writer->file, 0, true) ||
+        storage_file_write(writer->file, &writer->header, sizeof(RelocationCacheHeader)) !=
+            sizeof(RelocationCacheHeader))) {
+        writer->failed = true;
+    }
+    storage_file_free(writer->file);
+    RelocationCacheSymbols_clear(writer->symbols);
+    RelocationCacheGroups_clear(writer->groups);
+
+    FuriString* tmp_path = furi_string_alloc_printf(
+        "%s" RELOCATION_CACHE_TMP_SUFFIX, furi_string_get_cstr(elf->relocation_cache_path));
+
+    if(commit && !writer->failed) {
+        storage_common_rename(
+            elf->storage,
+            furi_string_get_cstr(tmp_path),
+            furi_string_get_cstr(elf->relocation_cache_path));
+    } else {
+        storage_common_remove(elf->storage, furi_string_get_cstr(tmp_path));
+    }
+
+    furi_string_free(tmp_path);
+    free(writer);
+}
+
 /**************************************************************************************************/
 /********************************************* Public *********************************************/
 /**************************************************************************************************/
 
 ELFFile* elf_file_alloc(Storage* storage, const ElfApiInterface* api_interface) {
     ELFFile* elf = malloc(sizeof(ELFFile));
+    elf->storage = storage;
     elf->fd = storage_file_alloc(storage);
     elf->api_interface = api_interface;
     ELFSectionDict_init(elf->sections);
@@ -859,6 +1385,10 @@ void elf_file_free(ELFFile* elf) {
         free(elf->debug_link_info.debug_link);
     }
 
+    if(elf->relocation_cache_path) {
+        furi_string_free(elf->relocation_cache_path);
+    }
+
     elf_file_maybe_release_fd(elf);
     free(elf);
 }
@@ -970,6 +1500,18 @@ ElfProcessSectionResult elf_process_section(
     return result;
 }
 
+void elf_file_set_relocation_cache(ELFFile* elf, const char* cache_path, uint32_t seed) {
+    furi_check(elf);
+    furi_check(cache_path);
+
+    if(elf->relocation_cache_path) {
+        furi_string_set(elf->relocation_cache_path, cache_path);
+    } else {
+        elf->relocation_cache_path = furi_string_alloc_set(cache_path);
+    }
+    elf->relocation_cache_seed = seed;
+}
+
 ELFFileLoadStatus elf_file_load_sections(ELFFile* elf) {
     furi_check(elf->fd != NULL);
     ELFFileLoadStatus status = ELFFileLoadStatusSuccess;
@@ -977,12 +1519,34 @@ ELFFileLoadStatus elf_file_load_sections(ELFFile* elf) {
 
     AddressCache_init(elf->relocation_cache);
 
-    for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it); ELFSectionDict_next(it)) {
-        ELFSectionDict_itref_t* itref = ELFSectionDict_ref(it);
-        FURI_LOG_D(TAG, "Relocating section '%s'", itref->key);
-        if(!elf_relocate_section(elf, &itref->value)) {
-            FURI_LOG_E(TAG, "Error relocating section '%s'", itref->key);
-            status = ELFFileLoadStatusMissingImports;
+    RelocationCacheResult cache_result = RelocationCacheResultMiss;
+    uint32_t cache_key = 0;
+    if(elf->relocation_cache_path) {
+        cache_key = elf_relocation_cache_key(elf);
+        cache_result = elf_relocation_cache_load(elf, cache_key);
+    }
+
+    if(cache_result == RelocationCacheResultHit) {
+        FURI_LOG_I(TAG, "Relocated from cache");
+    } else if(cache_result == RelocationCacheResultError) {
+        FURI_LOG_E(TAG, "Can't restore sections after relocation cache failure");
+        status = ELFFileLoadStatusUnspecifiedError;
+    } else {
+        RelocationCacheWriter* writer =
+            elf->relocation_cache_path ? elf_relocation_cache_writer_alloc(elf, cache_key) : NULL;
+
+        for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it);
+            ELFSectionDict_next(it)) {
+            ELFSectionDict_itref_t* itref = ELFSectionDict_ref(it);
+            FURI_LOG_D(TAG, "Relocating section '%s'", itref->key);
+            if(!elf_relocate_section(elf, &itref->value, writer)) {
+                FURI_LOG_E(TAG, "Error relocating section '%s'", itref->key);
+                status = ELFFileLoadStatusMissingImports;
+            }
+        }
+
+        if(writer) {
+            elf_relocation_cache_writer_free(elf, writer, status == ELFFileLoadStatusSuccess);
         }
     }
 
@@ -1027,6 +1591,26 @@ bool elf_file_is_init_complete(ELFFile* elf) {
     return elf->init_array_called;
 }
 
+bool elf_file_has_init_hooks(ELFFile* elf) {
+    return (elf->preinit_array && elf->preinit_array->size) ||
+           (elf->init_array && elf->init_array->size) ||
+           (elf->fini_array && elf->fini_array->size);
+}
+
+bool elf_file_contains_address(ELFFile* elf, const void* address) {
+    ELFSectionDict_it_t it;
+    for(ELFSectionDict_it(it, elf->sections); !ELFSectionDict_end_p(it); ELFSectionDict_next(it)) {
+        const ELFSection* section = &ELFSectionDict_cref(it)->value;
+        const uint8_t* data = section->data;
+        if(data && (const uint8_t*)address >= data &&
+           (const uint8_t*)address < data + section->size) {
+            return true;
+        }
+    }
+
+    return false;
+}
+
 void* elf_file_get_entry_point(ELFFile* elf) {
     furi_check(elf->init_array_called);
     return (void*)elf->entry;
@@ -79,6 +79,23 @@ bool elf_file_open(ELFFile* elf_file, const char* path);
  */
 ElfLoadSectionTableResult elf_file_load_section_table(ELFFile* elf_file);
 
+/**
+ * @brief Enable persistent relocation cache for ELF file
+ *
+ * Resolved relocations are saved to the cache file after first successful load
+ * and replayed on next loads, skipping symbol lookup entirely.
+ * Cache is position independent, so sections can be loaded at any address.
+ * Only use with API interfaces that always resolve symbols to the same addresses.
+ * Cache is checksummed and validated before use, a bad cache is removed and
+ * sections are relocated as usual.
+ * Must be called before elf_file_load_sections.
+ *
+ * @param elf_file
+ * @param cache_path cache file path
+ * @param seed value identifying firmware API table and file: path, size and modification time
+ */
+void elf_file_set_relocation_cache(ELFFile* elf_file, const char* cache_path, uint32_t seed);
+
 /**
  * @brief Load and relocate ELF file sections (load stage #2)
  * @param elf_file 
@@ -100,6 +117,21 @@ void elf_file_call_init(ELFFile* elf);
  */
 bool elf_file_is_init_complete(ELFFile* elf);
 
+/**
+ * @brief Check if ELF file has static constructors or destructors
+ * @param elf 
+ * @return true if pre-run or post-run stage calls anything
+ */
+bool elf_file_has_init_hooks(ELFFile* elf);
+
+/**
+ * @brief Check if address belongs to one of loaded ELF file sections
+ * @param elf 
+ * @param address 
+ * @return true if address is inside loaded code or data
+ */
+bool elf_file_contains_address(ELFFile* elf, const void* address);
+
 /**
  * @brief Get actual entry point for ELF file
  * @param elf_file 
@@ -42,6 +42,7 @@ struct ELFFile {
     AddressCache_t relocation_cache;
     AddressCache_t trampoline_cache;
 
+    Storage* storage;
     File* fd;
     const ElfApiInterface* api_interface;
     ELFDebugLinkInfo debug_link_info;
@@ -51,6 +52,9 @@ struct ELFFile {
     ELFSection* fini_array;
 
     bool init_array_called;
+
+    FuriString* relocation_cache_path;
+    uint32_t relocation_cache_seed;
 };
 
 #ifdef __cplusplus
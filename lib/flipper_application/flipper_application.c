@@ -1,4 +1,4 @@
-#include "flipper_application.h"
+#include "flipper_application_i.h"
 #include "elf/elf_file.h"
 #include <notification/notification_messages.h>
 #include "application_assets.h"
@@ -8,10 +8,14 @@
 
 #define TAG "Fap"
 
+#define FAP_CACHE_PATH            EXT_PATH(".cache")
+#define FAP_RELOCATION_CACHE_PATH FAP_CACHE_PATH "/fap"
+
 struct FlipperApplication {
     ELFDebugInfo state;
     FlipperApplicationManifest manifest;
     ELFFile* elf;
+    Storage* storage;
     FuriThread* thread;
     void* ep_thread_args;
 };
@@ -57,6 +61,7 @@ FlipperApplication*
 
     FlipperApplication* app = malloc(sizeof(FlipperApplication));
     app->elf = elf_file_alloc(storage, api_interface);
+    app->storage = storage;
     app->thread = NULL;
     app->ep_thread_args = NULL;
 
@@ -152,6 +157,39 @@ static bool flipper_application_process_assets_section(
     return flipper_application_assets_load(file, preload_context->path, offset, size);
 }
 
+static void
+    flipper_application_enable_relocation_cache(FlipperApplication* app, const char* path) {
+    // Only firmware API symbols are guaranteed to stay at the same address
+    if(elf_file_get_api_interface(app->elf) != firmware_api_interface) return;
+
+    FileInfo file_info;
+    uint32_t timestamp = 0;
+    if(storage_common_stat(app->storage, path, &file_info) != FSE_OK ||
+       storage_common_timestamp(app->storage, path, &timestamp) != FSE_OK) {
+        return;
+    }
+
+    if(!storage_simply_mkdir(app->storage, FAP_CACHE_PATH) ||
+       !storage_simply_mkdir(app->storage, FAP_RELOCATION_CACHE_PATH)) {
+        return;
+    }
+
+    // Seed identifies firmware API table and file: path, size and modification time
+    FuriString* seed = furi_string_alloc_printf(
+        "%08lX %s %llu %lu", firmware_api_get_hash(), path, file_info.size, timestamp);
+
+    // Cache file is named after application path
+    FuriString* cache_path = furi_string_alloc_set(path);
+    const size_t path_hash = furi_string_hash(cache_path);
+    furi_string_printf(cache_path, "%s/%08zX", FAP_RELOCATION_CACHE_PATH, path_hash);
+
+    elf_file_set_relocation_cache(
+        app->elf, furi_string_get_cstr(cache_path), furi_string_hash(seed));
+
+    furi_string_free(cache_path);
+    furi_string_free(seed);
+}
+
 static FlipperApplicationPreloadStatus
     flipper_application_load(FlipperApplication* app, const char* path, bool load_full) {
     if(!elf_file_open(app->elf, path)) {
@@ -168,6 +206,8 @@ static FlipperApplicationPreloadStatus
             return FlipperApplicationPreloadStatusNotEnoughMemory;
         }
 
+        flipper_application_enable_relocation_cache(app, path);
+
         // load assets section
         FlipperApplicationPreloadAssetsContext preload_context = {.path = path};
         if(elf_process_section(
@@ -334,6 +374,16 @@ const FlipperAppPluginDescriptor*
     return lib_descriptor;
 }
 
+bool flipper_application_has_init_hooks(FlipperApplication* app) {
+    furi_check(app);
+    return elf_file_has_init_hooks(app->elf);
+}
+
+bool flipper_application_contains_address(FlipperApplication* app, const void* address) {
+    furi_check(app);
+    return elf_file_contains_address(app->elf, address);
+}
+
 bool flipper_application_load_name_and_icon(
     FuriString* path,
     Storage* storage,
@@ -0,0 +1,26 @@
+#pragma once
+
+#include "flipper_application.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Check if loaded application has static constructors or destructors
+ * @param app Application pointer
+ * @return true if application runs code on init or deinit
+ */
+bool flipper_application_has_init_hooks(FlipperApplication* app);
+
+/**
+ * @brief Check if address belongs to loaded application code or data
+ * @param app Application pointer
+ * @param address Address to check
+ * @return true if address is inside application memory
+ */
+bool flipper_application_contains_address(FlipperApplication* app, const void* address);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,4 +1,4 @@
-#include "composite_resolver.h"
+#include "composite_resolver_i.h"
 
 #include <furi.h>
 #include <m-list.h>
@@ -59,3 +59,26 @@ const ElfApiInterface* composite_api_resolver_get(CompositeApiResolver* resolver
     furi_check(resolver);
     return &resolver->api_interface;
 }
+
+bool composite_api_resolver_is_composite(const ElfApiInterface* interface) {
+    furi_check(interface);
+    return interface->resolver_callback == &composite_api_resolver_callback;
+}
+
+size_t composite_api_resolver_get_interfaces(
+    const ElfApiInterface* interface,
+    const ElfApiInterface** interfaces,
+    size_t max) {
+    furi_check(composite_api_resolver_is_composite(interface));
+
+    CompositeApiResolver* resolver = (CompositeApiResolver*)interface;
+    size_t count = 0;
+    for
+        M_EACH(item, resolver->interfaces, ElfApiInterfaceList_t) {
+            if(count < max) {
+                interfaces[count] = *item;
+            }
+            count++;
+        }
+    return count;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include "composite_resolver.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Check if API interface is a composite resolver
+ * @param interface API interface
+ * @return true if interface was obtained with composite_api_resolver_get
+ */
+bool composite_api_resolver_is_composite(const ElfApiInterface* interface);
+
+/**
+ * @brief Get API interfaces used by composite resolver, in resolution order
+ * @param interface composite resolver API interface
+ * @param interfaces output array
+ * @param max output array size
+ * @return total number of interfaces, can be larger than max
+ */
+size_t composite_api_resolver_get_interfaces(
+    const ElfApiInterface* interface,
+    const ElfApiInterface** interfaces,
+    size_t max);
+
+#ifdef __cplusplus
+}
+#endif
@@ -1,4 +1,6 @@
 #include "plugin_manager.h"
+#include "composite_resolver_i.h"
+#include "../flipper_application_i.h"
 
 #include <loader/firmware_api/firmware_api.h>
 #include <storage/storage.h>
@@ -11,49 +13,183 @@
 
 #define TAG "PluginManager"
 
-ARRAY_DEF(FlipperApplicationList, FlipperApplication*, M_PTR_OPLIST) // NOLINT
-#define M_OPL_FlipperApplicationList_t() ARRAY_OPLIST(FlipperApplicationList, M_PTR_OPLIST)
+#define PLUGIN_CACHE_API_COUNT_MAX  (8)
+#define PLUGIN_CACHE_IDLE_COUNT_MAX (16)
+#define PLUGIN_CACHE_FREE_HEAP_MIN  (24 * 1024)
+
+/* Loaded plugin. Cached plugins are reused by later shared PluginManager instances,
+ * but only by one at a time, so plugins' .data and .bss are never shared by live managers */
+typedef struct {
+    FuriString* path;
+    uint32_t timestamp;
+    const ElfApiInterface* apis[PLUGIN_CACHE_API_COUNT_MAX];
+    size_t api_count;
+    bool apis_known;
+    FlipperApplication* lib;
+    const FlipperAppPluginDescriptor* descriptor;
+    bool in_use;
+    uint32_t last_use;
+    bool cached;
+} PluginCacheEntry;
+
+ARRAY_DEF(PluginCacheEntryList, PluginCacheEntry*, M_PTR_OPLIST) // NOLINT
+#define M_OPL_PluginCacheEntryList_t() ARRAY_OPLIST(PluginCacheEntryList, M_PTR_OPLIST)
+
+typedef struct {
+    FuriMutex* mutex;
+    // All loaded plugins, cached and private: needed to track API dependencies
+    PluginCacheEntryList_t entries;
+    uint32_t use_counter;
+} PluginCache;
+
+static PluginCache* plugin_cache = NULL;
 
 struct PluginManager {
     const char* application_id;
     uint32_t api_version;
     Storage* storage;
-    FlipperApplicationList_t libs;
+    PluginCacheEntryList_t libs;
     const ElfApiInterface* api_interface;
+    bool shared;
 };
 
-PluginManager* plugin_manager_alloc(
-    const char* application_id,
-    uint32_t api_version,
+/**************************************************************************************************/
+/****************************************** Plugin cache ******************************************/
+/**************************************************************************************************/
+
+static PluginCache* plugin_cache_get(void) {
+    if(!plugin_cache) {
+        furi_kernel_lock();
+        if(!plugin_cache) {
+            PluginCache* cache = malloc(sizeof(PluginCache));
+            // Recursive: evicted plugins are freed with the lock held
+            cache->mutex = furi_mutex_alloc(FuriMutexTypeRecursive);
+            PluginCacheEntryList_init(cache->entries);
+            plugin_cache = cache;
+        }
+        furi_kernel_unlock();
+    }
+
+    return plugin_cache;
+}
+
+static void plugin_cache_entry_free(PluginCacheEntry* entry) {
+    flipper_application_free(entry->lib);
+    furi_string_free(entry->path);
+    free(entry);
+}
+
+/* Collect API interfaces used for relocation. Returns false if they are not all known. */
+static bool plugin_cache_entry_set_apis(
+    PluginCacheEntry* entry,
     const ElfApiInterface* api_interface) {
-    PluginManager* manager = malloc(sizeof(PluginManager));
-    manager->application_id = application_id;
-    manager->api_version = api_version;
-    manager->api_interface = api_interface ? api_interface : firmware_api_interface;
-    manager->storage = furi_record_open(RECORD_STORAGE);
-    FlipperApplicationList_init(manager->libs);
-    return manager;
+    // Composite resolvers are allocated per user, compare what's inside
+    if(composite_api_resolver_is_composite(api_interface)) {
+        entry->api_count = composite_api_resolver_get_interfaces(
+            api_interface, entry->apis, PLUGIN_CACHE_API_COUNT_MAX);
+        if(entry->api_count > PLUGIN_CACHE_API_COUNT_MAX) {
+            entry->api_count = PLUGIN_CACHE_API_COUNT_MAX;
+            return false;
+        }
+
+        for(size_t i = 0; i < entry->api_count; i++) {
+            if(composite_api_resolver_is_composite(entry->apis[i])) {
+                return false;
+            }
+        }
+    } else {
+        entry->apis[0] = api_interface;
+        entry->api_count = 1;
+    }
+
+    return true;
 }
 
-void plugin_manager_free(PluginManager* manager) {
-    furi_check(manager);
+static bool plugin_cache_entry_match(const PluginCacheEntry* entry, const PluginCacheEntry* key) {
+    return entry->timestamp == key->timestamp && entry->api_count == key->api_count &&
+           memcmp(entry->apis, key->apis, sizeof(entry->apis[0]) * key->api_count) == 0 &&
+           furi_string_equal(entry->path, key->path);
+}
+
+/* Check if entry was relocated against API interface that lives in app memory */
+static bool plugin_cache_entry_uses(const PluginCacheEntry* entry, FlipperApplication* app) {
+    // Plugin with unknown interfaces may use anything
+    if(!entry->apis_known) return true;
+
+    for(size_t i = 0; i < entry->api_count; i++) {
+        if(flipper_application_contains_address(app, entry->apis[i])) return true;
+    }
 
+    return false;
+}
+
+/* Check if other loaded plugins use API interface provided by entry */
+static bool plugin_cache_entry_is_used(PluginCache* cache, const PluginCacheEntry* entry) {
     for
-        M_EACH(loaded_lib, manager->libs, FlipperApplicationList_t) {
-            flipper_application_free(*loaded_lib);
+        M_EACH(other, cache->entries, PluginCacheEntryList_t) {
+            if(*other != entry && plugin_cache_entry_uses(*other, entry->lib)) return true;
         }
-    FlipperApplicationList_clear(manager->libs);
-    furi_record_close(RECORD_STORAGE);
-    free(manager);
+
+    return false;
 }
 
-PluginManagerError plugin_manager_load_single(PluginManager* manager, const char* path) {
-    furi_check(manager);
-    FlipperApplication* lib = flipper_application_alloc(manager->storage, manager->api_interface);
+static void plugin_cache_remove(PluginCache* cache, PluginCacheEntry* entry) {
+    PluginCacheEntryList_it_t it;
+    for(PluginCacheEntryList_it(it, cache->entries); !PluginCacheEntryList_end_p(it);
+        PluginCacheEntryList_next(it)) {
+        if(*PluginCacheEntryList_ref(it) == entry) {
+            PluginCacheEntryList_remove(cache->entries, it);
+            break;
+        }
+    }
+
+    plugin_cache_entry_free(entry);
+}
+
+/* Free idle private plugins, and least recently used idle cached plugins while memory is low
+ * or there are too many of them. Plugins that others depend on are freed after them. */
+static void plugin_cache_trim(PluginCache* cache, bool flush) {
+    while(true) {
+        size_t idle_count = 0;
+        PluginCacheEntry* lru = NULL;
+
+        PluginCacheEntryList_it_t it;
+        for(PluginCacheEntryList_it(it, cache->entries); !PluginCacheEntryList_end_p(it);
+            PluginCacheEntryList_next(it)) {
+            PluginCacheEntry* entry = *PluginCacheEntryList_ref(it);
+            if(entry->in_use) continue;
+
+            idle_count++;
+            if(plugin_cache_entry_is_used(cache, entry)) continue;
+
+            if(!entry->cached) {
+                lru = entry;
+                break;
+            }
+
+            if(!lru || (int32_t)(entry->last_use - lru->last_use) < 0) {
+                lru = entry;
+            }
+        }
+
+        if(!lru) break;
+        if(!flush && lru->cached && idle_count <= PLUGIN_CACHE_IDLE_COUNT_MAX &&
+           memmgr_get_free_heap() >= PLUGIN_CACHE_FREE_HEAP_MIN) {
+            break;
+        }
+
+        FURI_LOG_D(TAG, "Evicting %s", furi_string_get_cstr(lru->path));
+        plugin_cache_remove(cache, lru);
+    }
+}
+
+static PluginManagerError plugin_cache_load(PluginCacheEntry* entry) {
+    const char* path = furi_string_get_cstr(entry->path);
 
     PluginManagerError error = PluginManagerErrorNone;
     do {
-        FlipperApplicationPreloadStatus preload_res = flipper_application_preload(lib, path);
+        FlipperApplicationPreloadStatus preload_res =
+            flipper_application_preload(entry->lib, path);
 
         if(preload_res != FlipperApplicationPreloadStatusSuccess) {
             FURI_LOG_E(TAG, "Failed to preload %s", path);
@@ -61,45 +197,242 @@ PluginManagerError plugin_manager_load_single(PluginManager* manager, const char
             break;
         }
 
-        if(!flipper_application_is_plugin(lib)) {
+        if(!flipper_application_is_plugin(entry->lib)) {
             FURI_LOG_E(TAG, "Not a plugin %s", path);
             error = PluginManagerErrorLoaderError;
             break;
         }
 
-        FlipperApplicationLoadStatus load_status = flipper_application_map_to_memory(lib);
+        FlipperApplicationLoadStatus load_status = flipper_application_map_to_memory(entry->lib);
         if(load_status != FlipperApplicationLoadStatusSuccess) {
             FURI_LOG_E(TAG, "Failed to load %s", path);
             error = PluginManagerErrorLoaderError;
             break;
         }
 
-        const FlipperAppPluginDescriptor* app_descriptor =
-            flipper_application_plugin_get_descriptor(lib);
-
-        if(!app_descriptor) {
+        entry->descriptor = flipper_application_plugin_get_descriptor(entry->lib);
+        if(!entry->descriptor) {
             FURI_LOG_E(TAG, "Failed to get descriptor %s", path);
             error = PluginManagerErrorLoaderError;
             break;
         }
 
-        if(strcmp(app_descriptor->appid, manager->application_id) != 0) {
+        // Constructors run only once per load, so their state can't be reused
+        if(flipper_application_has_init_hooks(entry->lib)) {
+            entry->cached = false;
+        }
+    } while(false);
+
+    return error;
+}
+
+/* Find idle cached plugin for key */
+static PluginCacheEntry* plugin_cache_find(PluginCache* cache, const PluginCacheEntry* key) {
+    for
+        M_EACH(cached_entry, cache->entries, PluginCacheEntryList_t) {
+            if((*cached_entry)->cached && !(*cached_entry)->in_use &&
+               plugin_cache_entry_match(*cached_entry, key)) {
+                return *cached_entry;
+            }
+        }
+
+    return NULL;
+}
+
+static PluginCacheEntry* plugin_cache_acquire(
+    PluginManager* manager,
+    const char* path,
+    PluginManagerError* error) {
+    PluginCache* cache = plugin_cache_get();
+
+    PluginCacheEntry* entry = malloc(sizeof(PluginCacheEntry));
+    entry->path = furi_string_alloc_set_str(path);
+    entry->in_use = false;
+    entry->apis_known = plugin_cache_entry_set_apis(entry, manager->api_interface);
+    entry->cached = manager->shared && entry->apis_known &&
+                    storage_common_timestamp(manager->storage, path, &entry->timestamp) ==
+                        FSE_OK;
+
+    furi_check(furi_mutex_acquire(cache->mutex, FuriWaitForever) == FuriStatusOk);
+
+    PluginCacheEntry* cached_entry = entry->cached ? plugin_cache_find(cache, entry) : NULL;
+
+    if(cached_entry) {
+        FURI_LOG_D(TAG, "Reusing %s", path);
+        furi_string_free(entry->path);
+        free(entry);
+        entry = cached_entry;
+        *error = PluginManagerErrorNone;
+    } else {
+        // Make room for new plugin
+        plugin_cache_trim(cache, false);
+
+        entry->lib = flipper_application_alloc(manager->storage, manager->api_interface);
+        *error = plugin_cache_load(entry);
+        if(*error != PluginManagerErrorNone) {
+            plugin_cache_entry_free(entry);
+            entry = NULL;
+        } else {
+            PluginCacheEntryList_push_back(cache->entries, entry);
+        }
+    }
+
+    if(entry) {
+        entry->in_use = true;
+        entry->last_use = ++cache->use_counter;
+    }
+
+    furi_check(furi_mutex_release(cache->mutex) == FuriStatusOk);
+
+    return entry;
+}
+
+/* Return plugin to the cache, evict: nobody is going to ask for it again */
+static void plugin_cache_release(PluginCache* cache, PluginCacheEntry* entry, bool evict) {
+    furi_check(entry->in_use);
+    entry->in_use = false;
+
+    if(evict) {
+        entry->cached = false;
+    }
+
+    plugin_cache_trim(cache, false);
+}
+
+void plugin_manager_flush_cache(void) {
+    PluginCache* cache = plugin_cache_get();
+
+    furi_check(furi_mutex_acquire(cache->mutex, FuriWaitForever) == FuriStatusOk);
+    plugin_cache_trim(cache, true);
+    furi_check(furi_mutex_release(cache->mutex) == FuriStatusOk);
+}
+
+/* Check if entry uses API of the app directly or through other plugins */
+static bool plugin_cache_entry_depends_on(
+    PluginCache* cache,
+    const PluginCacheEntry* entry,
+    FlipperApplication* app,
+    size_t depth) {
+    if(plugin_cache_entry_uses(entry, app)) return true;
+    if(depth == 0) return false;
+
+    for
+        M_EACH(other, cache->entries, PluginCacheEntryList_t) {
+            if(*other != entry && plugin_cache_entry_uses(entry, (*other)->lib) &&
+               plugin_cache_entry_depends_on(cache, *other, app, depth - 1)) {
+                return true;
+            }
+        }
+
+    return false;
+}
+
+void plugin_manager_flush_application(FlipperApplication* app) {
+    furi_check(app);
+
+    PluginCache* cache = plugin_cache_get();
+    furi_check(furi_mutex_acquire(cache->mutex, FuriWaitForever) == FuriStatusOk);
+
+    // Dependent plugins go first, so restart after every eviction
+    bool evicted = true;
+    while(evicted) {
+        evicted = false;
+        const size_t depth = PluginCacheEntryList_size(cache->entries);
+
+        PluginCacheEntryList_it_t it;
+        for(PluginCacheEntryList_it(it, cache->entries); !PluginCacheEntryList_end_p(it);
+            PluginCacheEntryList_next(it)) {
+            PluginCacheEntry* entry = *PluginCacheEntryList_ref(it);
+            if(!plugin_cache_entry_depends_on(cache, entry, app, depth)) continue;
+
+            if(entry->in_use) {
+                FURI_LOG_E(TAG, "%s outlives its API", furi_string_get_cstr(entry->path));
+            } else if(!plugin_cache_entry_is_used(cache, entry)) {
+                FURI_LOG_D(TAG, "Evicting %s", furi_string_get_cstr(entry->path));
+                plugin_cache_remove(cache, entry);
+                evicted = true;
+                break;
+            }
+        }
+    }
+
+    furi_check(furi_mutex_release(cache->mutex) == FuriStatusOk);
+}
+
+/**************************************************************************************************/
+/***************************************** Plugin manager *****************************************/
+/**************************************************************************************************/
+
+PluginManager* plugin_manager_alloc(
+    const char* application_id,
+    uint32_t api_version,
+    const ElfApiInterface* api_interface) {
+    PluginManager* manager = malloc(sizeof(PluginManager));
+    manager->application_id = application_id;
+    manager->api_version = api_version;
+    manager->api_interface = api_interface ? api_interface : firmware_api_interface;
+    manager->storage = furi_record_open(RECORD_STORAGE);
+    manager->shared = false;
+    PluginCacheEntryList_init(manager->libs);
+    return manager;
+}
+
+void plugin_manager_free(PluginManager* manager) {
+    furi_check(manager);
+
+    PluginCache* cache = plugin_cache_get();
+    furi_check(furi_mutex_acquire(cache->mutex, FuriWaitForever) == FuriStatusOk);
+
+    // Later plugins may use API of earlier ones, release them first
+    for(size_t i = PluginCacheEntryList_size(manager->libs); i-- > 0;) {
+        plugin_cache_release(cache, *PluginCacheEntryList_get(manager->libs, i), false);
+    }
+    PluginCacheEntryList_clear(manager->libs);
+
+    furi_check(furi_mutex_release(cache->mutex) == FuriStatusOk);
+
+    furi_record_close(RECORD_STORAGE);
+    free(manager);
+}
+
+void plugin_manager_set_shared(PluginManager* manager, bool shared) {
+    furi_check(manager);
+    furi_check(PluginCacheEntryList_empty_p(manager->libs));
+
+    manager->shared = shared;
+}
+
+PluginManagerError plugin_manager_load_single(PluginManager* manager, const char* path) {
+    furi_check(manager);
+
+    PluginManagerError error = PluginManagerErrorNone;
+    PluginCacheEntry* entry = plugin_cache_acquire(manager, path, &error);
+    if(!entry) {
+        return error;
+    }
+
+    do {
+        if(strcmp(entry->descriptor->appid, manager->application_id) != 0) {
             FURI_LOG_E(TAG, "Application id mismatch %s", path);
             error = PluginManagerErrorApplicationIdMismatch;
             break;
         }
 
-        if(app_descriptor->ep_api_version != manager->api_version) {
+        if(entry->descriptor->ep_api_version != manager->api_version) {
             FURI_LOG_E(TAG, "API version mismatch %s", path);
             error = PluginManagerErrorAPIVersionMismatch;
             break;
         }
 
-        FlipperApplicationList_push_back(manager->libs, lib);
+        PluginCacheEntryList_push_back(manager->libs, entry);
     } while(false);
 
     if(error != PluginManagerErrorNone) {
-        flipper_application_free(lib);
+        // Nobody is going to ask for a plugin that doesn't match
+        PluginCache* cache = plugin_cache_get();
+        furi_check(furi_mutex_acquire(cache->mutex, FuriWaitForever) == FuriStatusOk);
+        plugin_cache_release(cache, entry, true);
+        furi_check(furi_mutex_release(cache->mutex) == FuriStatusOk);
     }
 
     return error;
@@ -145,14 +478,14 @@ PluginManagerError plugin_manager_load_all(PluginManager* manager, const char* p
 uint32_t plugin_manager_get_count(PluginManager* manager) {
     furi_check(manager);
 
-    return FlipperApplicationList_size(manager->libs);
+    return PluginCacheEntryList_size(manager->libs);
 }
 
 const FlipperAppPluginDescriptor* plugin_manager_get(PluginManager* manager, uint32_t index) {
     furi_check(manager);
 
-    FlipperApplication* app = *FlipperApplicationList_get(manager->libs, index);
-    return flipper_application_plugin_get_descriptor(app);
+    PluginCacheEntry* entry = *PluginCacheEntryList_get(manager->libs, index);
+    return entry->descriptor;
 }
 
 const void* plugin_manager_get_ep(PluginManager* manager, uint32_t index) {
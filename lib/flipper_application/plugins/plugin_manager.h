@@ -38,6 +38,21 @@ PluginManager* plugin_manager_alloc(
  */
 void plugin_manager_free(PluginManager* manager);
 
+/**
+ * @brief Enables plugin sharing for PluginManager
+ * Plugins loaded by a shared PluginManager stay in memory after it is freed,
+ * so next shared PluginManager loading the same file with the same API interfaces
+ * gets them without reading and relocating the file again.
+ * Cached plugin is used by one PluginManager at a time, concurrent users get their own copy.
+ * Plugins with static constructors or destructors are never shared.
+ * Only enable sharing if plugins don't rely on initial values of their global
+ * variables: state left by previous user is kept.
+ * Must be called before any plugin is loaded.
+ * @param manager PluginManager instance
+ * @param shared true to share plugins
+ */
+void plugin_manager_set_shared(PluginManager* manager, bool shared);
+
 /**
  * @brief Loads single plugin by full path
  * @param manager PluginManager instance
@@ -77,6 +92,20 @@ const FlipperAppPluginDescriptor* plugin_manager_get(PluginManager* manager, uin
  */
 const void* plugin_manager_get_ep(PluginManager* manager, uint32_t index);
 
+/**
+ * @brief Frees plugins that are not used by any PluginManager
+ * Idle shared plugins are otherwise only evicted, least recently used first,
+ * when memory is low or there are too many of them.
+ */
+void plugin_manager_flush_cache(void);
+
+/**
+ * @brief Frees idle plugins that use API interfaces of the application
+ * Must be called before application is freed, loader does it for every external application.
+ * @param app Application that is going to be freed
+ */
+void plugin_manager_flush_application(FlipperApplication* app);
+
 #ifdef __cplusplus
 }
 #endif
@@ -9,9 +9,14 @@
 #include "flipper_format_stream_i.h"
 
 /********************************** Private **********************************/
+// Value and key strings of a single read are held at the same time
+#define FLIPPER_FORMAT_ARENA_SIZE (2)
+
 struct FlipperFormat {
     Stream* stream;
     bool strict_mode;
+    // Reused by reads, FlipperFormat is not thread safe anyway
+    FuriStringArena* arena;
 };
 
 static const char* const flipper_format_filetype_key = "Filetype";
@@ -27,6 +32,7 @@ FlipperFormat* flipper_format_string_alloc(void) {
     FlipperFormat* flipper_format = malloc(sizeof(FlipperFormat));
     flipper_format->stream = string_stream_alloc();
     flipper_format->strict_mode = false;
+    flipper_format->arena = furi_string_arena_alloc(FLIPPER_FORMAT_ARENA_SIZE);
     return flipper_format;
 }
 
@@ -34,6 +40,7 @@ FlipperFormat* flipper_format_file_alloc(Storage* storage) {
     FlipperFormat* flipper_format = malloc(sizeof(FlipperFormat));
     flipper_format->stream = file_stream_alloc(storage);
     flipper_format->strict_mode = false;
+    flipper_format->arena = furi_string_arena_alloc(FLIPPER_FORMAT_ARENA_SIZE);
     return flipper_format;
 }
 
@@ -41,6 +48,7 @@ FlipperFormat* flipper_format_buffered_file_alloc(Storage* storage) {
     FlipperFormat* flipper_format = malloc(sizeof(FlipperFormat));
     flipper_format->stream = buffered_file_stream_alloc(storage);
     flipper_format->strict_mode = false;
+    flipper_format->arena = furi_string_arena_alloc(FLIPPER_FORMAT_ARENA_SIZE);
     return flipper_format;
 }
 
@@ -115,6 +123,7 @@ bool flipper_format_buffered_file_close(FlipperFormat* flipper_format) {
 void flipper_format_free(FlipperFormat* flipper_format) {
     furi_check(flipper_format);
     stream_free(flipper_format->stream);
+    furi_string_arena_free(flipper_format->arena);
     free(flipper_format);
 }
 
@@ -135,7 +144,8 @@ bool flipper_format_seek_to_end(FlipperFormat* flipper_format) {
 bool flipper_format_key_exist(FlipperFormat* flipper_format, const char* key) {
     size_t pos = stream_tell(flipper_format->stream);
     stream_seek(flipper_format->stream, 0, StreamOffsetFromStart);
-    bool result = flipper_format_stream_seek_to_key(flipper_format->stream, key, false);
+    bool result = flipper_format_stream_seek_to_key_ex(
+        flipper_format->stream, flipper_format->arena, key, false);
     stream_seek(flipper_format->stream, pos, StreamOffsetFromStart);
 
     return result;
@@ -174,14 +184,20 @@ bool flipper_format_get_value_count(
     const char* key,
     uint32_t* count) {
     furi_check(flipper_format);
-    return flipper_format_stream_get_value_count(
-        flipper_format->stream, key, count, flipper_format->strict_mode);
+    return flipper_format_stream_get_value_count_ex(
+        flipper_format->stream, flipper_format->arena, key, count, flipper_format->strict_mode);
 }
 
 bool flipper_format_read_string(FlipperFormat* flipper_format, const char* key, FuriString* data) {
     furi_check(flipper_format);
-    return flipper_format_stream_read_value_line(
-        flipper_format->stream, key, FlipperStreamValueStr, data, 1, flipper_format->strict_mode);
+    return flipper_format_stream_read_value_line_ex(
+        flipper_format->stream,
+        flipper_format->arena,
+        key,
+        FlipperStreamValueStr,
+        data,
+        1,
+        flipper_format->strict_mode);
 }
 
 bool flipper_format_write_string(FlipperFormat* flipper_format, const char* key, FuriString* data) {
@@ -217,8 +233,9 @@ bool flipper_format_read_hex_uint64(
     uint64_t* data,
     const uint16_t data_size) {
     furi_check(flipper_format);
-    return flipper_format_stream_read_value_line(
+    return flipper_format_stream_read_value_line_ex(
         flipper_format->stream,
+        flipper_format->arena,
         key,
         FlipperStreamValueHexUint64,
         data,
@@ -248,8 +265,9 @@ bool flipper_format_read_uint32(
     uint32_t* data,
     const uint16_t data_size) {
     furi_check(flipper_format);
-    return flipper_format_stream_read_value_line(
+    return flipper_format_stream_read_value_line_ex(
         flipper_format->stream,
+        flipper_format->arena,
         key,
         FlipperStreamValueUint32,
         data,
@@ -278,8 +296,9 @@ bool flipper_format_read_int32(
     const char* key,
     int32_t* data,
     const uint16_t data_size) {
-    return flipper_format_stream_read_value_line(
+    return flipper_format_stream_read_value_line_ex(
         flipper_format->stream,
+        flipper_format->arena,
         key,
         FlipperStreamValueInt32,
         data,
@@ -308,8 +327,9 @@ bool flipper_format_read_bool(
     const char* key,
     bool* data,
     const uint16_t data_size) {
-    return flipper_format_stream_read_value_line(
+    return flipper_format_stream_read_value_line_ex(
         flipper_format->stream,
+        flipper_format->arena,
         key,
         FlipperStreamValueBool,
         data,
@@ -338,8 +358,9 @@ bool flipper_format_read_float(
     const char* key,
     float* data,
     const uint16_t data_size) {
-    return flipper_format_stream_read_value_line(
+    return flipper_format_stream_read_value_line_ex(
         flipper_format->stream,
+        flipper_format->arena,
         key,
         FlipperStreamValueFloat,
         data,
@@ -368,8 +389,9 @@ bool flipper_format_read_hex(
     const char* key,
     uint8_t* data,
     const uint16_t data_size) {
-    return flipper_format_stream_read_value_line(
+    return flipper_format_stream_read_value_line_ex(
         flipper_format->stream,
+        flipper_format->arena,
         key,
         FlipperStreamValueHex,
         data,
@@ -32,7 +32,8 @@ bool flipper_format_stream_write_eol(Stream* stream) {
 }
 
 static bool flipper_format_stream_read_valid_key(Stream* stream, FuriString* key) {
-    furi_string_reset(key);
+    // Truncate instead of reset: key buffer is reused for every line
+    furi_string_left(key, 0);
     const size_t buffer_size = 32;
     uint8_t buffer[buffer_size];
 
@@ -49,7 +50,7 @@ static bool flipper_format_stream_read_valid_key(Stream* stream, FuriString* key
             uint8_t data = buffer[i];
             if(data == flipper_format_eoln) {
                 // EOL found, clean data, start accumulating data and set the new_line flag
-                furi_string_reset(key);
+                furi_string_left(key, 0);
                 accumulate = true;
                 new_line = true;
             } else if(data == flipper_format_eolr) {
@@ -65,7 +66,7 @@ static bool flipper_format_stream_read_valid_key(Stream* stream, FuriString* key
                     // this can only be if we have previously found some kind of key, so
                     // clear the data, set the flag that we no longer want to accumulate data
                     // and reset the new_line flag
-                    furi_string_reset(key);
+                    furi_string_left(key, 0);
                     accumulate = false;
                     new_line = false;
                 } else {
@@ -99,10 +100,18 @@ static bool flipper_format_stream_read_valid_key(Stream* stream, FuriString* key
 }
 
 bool flipper_format_stream_seek_to_key(Stream* stream, const char* key, bool strict_mode) {
+    return flipper_format_stream_seek_to_key_ex(stream, NULL, key, strict_mode);
+}
+
+bool flipper_format_stream_seek_to_key_ex(
+    Stream* stream,
+    FuriStringArena* arena,
+    const char* key,
+    bool strict_mode) {
     bool found = false;
     FuriString* read_key;
 
-    read_key = furi_string_alloc();
+    read_key = furi_string_alloc_in(arena);
 
     while(!stream_eof(stream)) {
         if(flipper_format_stream_read_valid_key(stream, read_key)) {
@@ -347,10 +356,22 @@ bool flipper_format_stream_read_value_line(
     void* _data,
     size_t data_size,
     bool strict_mode) {
+    return flipper_format_stream_read_value_line_ex(
+        stream, NULL, key, type, _data, data_size, strict_mode);
+}
+
+bool flipper_format_stream_read_value_line_ex(
+    Stream* stream,
+    FuriStringArena* arena,
+    const char* key,
+    FlipperStreamValue type,
+    void* _data,
+    size_t data_size,
+    bool strict_mode) {
     bool result = false;
 
     do {
-        if(!flipper_format_stream_seek_to_key(stream, key, strict_mode)) break;
+        if(!flipper_format_stream_seek_to_key_ex(stream, arena, key, strict_mode)) break;
 
         if(type == FlipperStreamValueStr) {
             FuriString* data = (FuriString*)_data;
@@ -361,7 +382,7 @@ bool flipper_format_stream_read_value_line(
         } else {
             result = true;
             FuriString* value;
-            value = furi_string_alloc();
+            value = furi_string_alloc_in(arena);
 
             for(size_t i = 0; i < data_size; i++) {
                 bool last = false;
@@ -452,15 +473,24 @@ bool flipper_format_stream_get_value_count(
     const char* key,
     uint32_t* count,
     bool strict_mode) {
+    return flipper_format_stream_get_value_count_ex(stream, NULL, key, count, strict_mode);
+}
+
+bool flipper_format_stream_get_value_count_ex(
+    Stream* stream,
+    FuriStringArena* arena,
+    const char* key,
+    uint32_t* count,
+    bool strict_mode) {
     bool result = false;
     bool last = false;
 
     FuriString* value;
-    value = furi_string_alloc();
+    value = furi_string_alloc_in(arena);
 
     uint32_t position = stream_tell(stream);
     do {
-        if(!flipper_format_stream_seek_to_key(stream, key, strict_mode)) break;
+        if(!flipper_format_stream_seek_to_key_ex(stream, arena, key, strict_mode)) break;
         *count = 0;
 
         result = true;
@@ -1,4 +1,5 @@
 #pragma once
+#include <core/string.h>
 #include "flipper_format_stream.h"
 
 static const char flipper_format_delimiter = ':';
@@ -29,6 +30,59 @@ bool flipper_format_stream_write_eol(Stream* stream);
  */
 bool flipper_format_stream_seek_to_key(Stream* stream, const char* key, bool strict_mode);
 
+/**
+ * Same as flipper_format_stream_seek_to_key, key buffer is taken from the arena.
+ * @param stream 
+ * @param arena string arena or NULL
+ * @param key 
+ * @param strict_mode 
+ * @return true key is found
+ * @return false key is not found
+ */
+bool flipper_format_stream_seek_to_key_ex(
+    Stream* stream,
+    FuriStringArena* arena,
+    const char* key,
+    bool strict_mode);
+
+/**
+ * Same as flipper_format_stream_read_value_line, temporary strings are taken from the arena.
+ * @param stream 
+ * @param arena string arena or NULL
+ * @param key 
+ * @param type 
+ * @param _data 
+ * @param data_size 
+ * @param strict_mode 
+ * @return true 
+ * @return false 
+ */
+bool flipper_format_stream_read_value_line_ex(
+    Stream* stream,
+    FuriStringArena* arena,
+    const char* key,
+    FlipperStreamValue type,
+    void* _data,
+    size_t data_size,
+    bool strict_mode);
+
+/**
+ * Same as flipper_format_stream_get_value_count, temporary strings are taken from the arena.
+ * @param stream 
+ * @param arena string arena or NULL
+ * @param key 
+ * @param count 
+ * @param strict_mode 
+ * @return true 
+ * @return false 
+ */
+bool flipper_format_stream_get_value_count_ex(
+    Stream* stream,
+    FuriStringArena* arena,
+    const char* key,
+    uint32_t* count,
+    bool strict_mode);
+
 #ifdef __cplusplus
 }
 #endif
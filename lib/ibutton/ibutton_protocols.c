@@ -160,6 +160,42 @@ bool ibutton_protocols_read(iButtonProtocols* protocols, iButtonKey* key) {
     return id != iButtonProtocolIdInvalid;
 }
 
+void ibutton_protocols_read_start(iButtonProtocols* protocols) {
+    furi_check(protocols);
+
+    for(iButtonProtocolGroupId i = 0; i < iButtonProtocolGroupMax; ++i) {
+        ibutton_protocol_groups[i]->read_start(protocols->group_datas[i]);
+    }
+}
+
+bool ibutton_protocols_read_poll(iButtonProtocols* protocols, iButtonKey* key) {
+    furi_check(protocols);
+    furi_check(key);
+
+    iButtonProtocolLocalId id = iButtonProtocolIdInvalid;
+    iButtonProtocolData* data = ibutton_key_get_protocol_data(key);
+
+    iButtonProtocolLocalId offset = 0;
+    for(iButtonProtocolGroupId i = 0; i < iButtonProtocolGroupMax; ++i) {
+        if(ibutton_protocol_groups[i]->read_poll(protocols->group_datas[i], data, &id)) {
+            id += offset;
+            break;
+        }
+        offset += ibutton_protocol_groups[i]->protocol_count;
+    }
+
+    ibutton_key_set_protocol_id(key, id);
+    return id != iButtonProtocolIdInvalid;
+}
+
+void ibutton_protocols_read_stop(iButtonProtocols* protocols) {
+    furi_check(protocols);
+
+    for(iButtonProtocolGroupId i = 0; i < iButtonProtocolGroupMax; ++i) {
+        ibutton_protocol_groups[i]->read_stop(protocols->group_datas[i]);
+    }
+}
+
 bool ibutton_protocols_write_id(iButtonProtocols* protocols, iButtonKey* key) {
     furi_check(protocols);
     furi_check(key);
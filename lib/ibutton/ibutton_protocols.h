@@ -82,6 +82,35 @@ uint32_t ibutton_protocols_get_features(iButtonProtocols* protocols, iButtonProt
  */
 bool ibutton_protocols_read(iButtonProtocols* protocols, iButtonKey* key);
 
+/**
+ * Start listening for all key types at once
+ *
+ * Cyfral and Metakom decoders receive comparator edges while 1-Wire presence
+ * is checked periodically on the same contact. Call ibutton_protocols_read_poll()
+ * often enough for the edge buffer not to overflow, about every 10 ms.
+ *
+ * @param [in] protocols pointer to an iButtonProtocols object
+ */
+void ibutton_protocols_read_start(iButtonProtocols* protocols);
+
+/**
+ * Check whether any key was read since the last call
+ *
+ * 1-Wire presence is checked periodically, every key that answers
+ * is read in full, including its memory.
+ *
+ * @param [in] protocols pointer to an iButtonProtocols object
+ * @param [out] key pointer to the key to read into (must be allocated before)
+ * @return true if a key was read, false otherwise
+ */
+bool ibutton_protocols_read_poll(iButtonProtocols* protocols, iButtonKey* key);
+
+/**
+ * Stop listening started by ibutton_protocols_read_start()
+ * @param [in] protocols pointer to an iButtonProtocols object
+ */
+void ibutton_protocols_read_stop(iButtonProtocols* protocols);
+
 /**
  * Write the key to a blank
  * @param [in] protocols pointer to an iButtonProtocols object
@@ -7,6 +7,7 @@ typedef enum {
     iButtonMessageEnd,
     iButtonMessageStop,
     iButtonMessageRead,
+    iButtonMessageReadParallel,
     iButtonMessageWriteId,
     iButtonMessageWriteCopy,
     iButtonMessageEmulate,
@@ -78,6 +79,15 @@ void ibutton_worker_read_start(iButtonWorker* worker, iButtonKey* key) {
         furi_message_queue_put(worker->messages, &message, FuriWaitForever) == FuriStatusOk);
 }
 
+void ibutton_worker_read_parallel_start(iButtonWorker* worker, iButtonKey* key) {
+    furi_check(worker);
+
+    iButtonMessage message = {.type = iButtonMessageReadParallel, .data.key = key};
+
+    furi_check(
+        furi_message_queue_put(worker->messages, &message, FuriWaitForever) == FuriStatusOk);
+}
+
 void ibutton_worker_write_id_start(iButtonWorker* worker, iButtonKey* key) {
     furi_check(worker);
     furi_check(key);
@@ -185,6 +195,10 @@ static int32_t ibutton_worker_thread(void* thread_context) {
                 ibutton_worker_set_key_p(worker, message.data.key);
                 ibutton_worker_switch_mode(worker, iButtonWorkerModeRead);
                 break;
+            case iButtonMessageReadParallel:
+                ibutton_worker_set_key_p(worker, message.data.key);
+                ibutton_worker_switch_mode(worker, iButtonWorkerModeReadParallel);
+                break;
             case iButtonMessageWriteId:
                 ibutton_worker_set_key_p(worker, message.data.key);
                 ibutton_worker_switch_mode(worker, iButtonWorkerModeWriteId);
@@ -68,6 +68,18 @@ void ibutton_worker_read_set_callback(
  */
 void ibutton_worker_read_start(iButtonWorker* worker, iButtonKey* key);
 
+/**
+ * Start read mode listening for all key types at once
+ *
+ * Faster than ibutton_worker_read_start(), 1-Wire keys are still
+ * read in full on every presence.
+ * Uses the same "read success" callback.
+ *
+ * @param worker 
+ * @param key 
+ */
+void ibutton_worker_read_parallel_start(iButtonWorker* worker, iButtonKey* key);
+
 /**
  * Set "write event" callback
  * @param worker 
@@ -28,6 +28,7 @@ typedef enum {
     iButtonWorkerModeWriteId,
     iButtonWorkerModeWriteCopy,
     iButtonWorkerModeEmulate,
+    iButtonWorkerModeReadParallel,
 } iButtonWorkerMode;
 
 struct iButtonWorker {
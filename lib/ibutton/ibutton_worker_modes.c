@@ -19,6 +19,10 @@ static void ibutton_worker_mode_read_start(iButtonWorker* worker);
 static void ibutton_worker_mode_read_tick(iButtonWorker* worker);
 static void ibutton_worker_mode_read_stop(iButtonWorker* worker);
 
+static void ibutton_worker_mode_read_parallel_start(iButtonWorker* worker);
+static void ibutton_worker_mode_read_parallel_tick(iButtonWorker* worker);
+static void ibutton_worker_mode_read_parallel_stop(iButtonWorker* worker);
+
 static void ibutton_worker_mode_write_common_start(iButtonWorker* worker);
 static void ibutton_worker_mode_write_id_tick(iButtonWorker* worker);
 static void ibutton_worker_mode_write_copy_tick(iButtonWorker* worker);
@@ -55,6 +59,12 @@ const iButtonWorkerModeType ibutton_worker_modes[] = {
         .tick = ibutton_worker_mode_emulate_tick,
         .stop = ibutton_worker_mode_emulate_stop,
     },
+    {
+        .quant = 10,
+        .start = ibutton_worker_mode_read_parallel_start,
+        .tick = ibutton_worker_mode_read_parallel_tick,
+        .stop = ibutton_worker_mode_read_parallel_stop,
+    },
 };
 
 /*********************** IDLE ***********************/
@@ -93,6 +103,28 @@ void ibutton_worker_mode_read_stop(iButtonWorker* worker) {
     furi_hal_power_disable_otg();
 }
 
+/*********************** READ PARALLEL ***********************/
+
+void ibutton_worker_mode_read_parallel_start(iButtonWorker* worker) {
+    furi_hal_power_enable_otg();
+    ibutton_protocols_read_start(worker->protocols);
+}
+
+void ibutton_worker_mode_read_parallel_tick(iButtonWorker* worker) {
+    if(ibutton_protocols_read_poll(worker->protocols, worker->key)) {
+        if(worker->read_cb != NULL) {
+            worker->read_cb(worker->cb_ctx);
+        }
+
+        ibutton_worker_switch_mode(worker, iButtonWorkerModeIdle);
+    }
+}
+
+void ibutton_worker_mode_read_parallel_stop(iButtonWorker* worker) {
+    ibutton_protocols_read_stop(worker->protocols);
+    furi_hal_power_disable_otg();
+}
+
 /*********************** EMULATE ***********************/
 
 void ibutton_worker_mode_emulate_start(iButtonWorker* worker) {
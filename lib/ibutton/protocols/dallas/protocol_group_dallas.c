@@ -3,12 +3,18 @@
 #include <furi_hal_resources.h>
 
 #include "protocol_group_dallas_defs.h"
+#include "dallas_common.h"
 
 #define IBUTTON_ONEWIRE_ROM_SIZE 8U
 
+/* Presence is checked this often while other groups are listening */
+#define IBUTTON_DALLAS_READ_POLL_PERIOD 25U
+
 typedef struct {
     OneWireHost* host;
     OneWireSlave* bus;
+
+    uint32_t read_poll_tick;
 } iButtonProtocolGroupDallas;
 
 static iButtonProtocolGroupDallas* ibutton_protocol_group_dallas_alloc(void) {
@@ -133,6 +139,51 @@ static bool ibutton_protocol_group_dallas_read(
     return success;
 }
 
+static void ibutton_protocol_group_dallas_read_start(iButtonProtocolGroupDallas* group) {
+    onewire_host_start(group->host);
+    group->read_poll_tick = furi_get_tick();
+}
+
+static void ibutton_protocol_group_dallas_read_stop(iButtonProtocolGroupDallas* group) {
+    onewire_host_stop(group->host);
+}
+
+static bool ibutton_protocol_group_dallas_read_poll(
+    iButtonProtocolGroupDallas* group,
+    iButtonProtocolData* data,
+    iButtonProtocolLocalId* id) {
+    OneWireHost* host = group->host;
+
+    const uint32_t tick = furi_get_tick();
+    if(tick - group->read_poll_tick < IBUTTON_DALLAS_READ_POLL_PERIOD) {
+        return false;
+    }
+    group->read_poll_tick = tick;
+
+    /* Presence check is short and not timing critical,
+     * other groups keep receiving their interrupts meanwhile. */
+    if(!onewire_host_reset(host)) {
+        return false;
+    }
+
+    bool success = false;
+    DallasCommonRomData rom_data;
+
+    FURI_CRITICAL_ENTER();
+
+    /* There is only one key on the probe, Read ROM is faster than Search ROM.
+     * CRC and family code filter out anything else that answered the reset,
+     * same as onewire_host_search() does. */
+    if(dallas_common_read_rom(host, &rom_data) && rom_data.fields.family_code != 0) {
+        *id = ibutton_protocol_group_dallas_get_id_by_family_code(rom_data.fields.family_code);
+        success = ibutton_protocols_dallas[*id]->read(host, data);
+    }
+
+    FURI_CRITICAL_EXIT();
+
+    return success;
+}
+
 static bool ibutton_protocol_group_dallas_write_id(
     iButtonProtocolGroupDallas* group,
     iButtonProtocolData* data,
@@ -307,6 +358,9 @@ const iButtonProtocolGroupBase ibutton_protocol_group_dallas = {
     .get_name = (iButtonProtocolGroupGetStringFunc)ibutton_protocol_group_dallas_get_name,
 
     .read = (iButtonProtocolGroupReadFunc)ibutton_protocol_group_dallas_read,
+    .read_start = (iButtonProtocolGroupReadControlFunc)ibutton_protocol_group_dallas_read_start,
+    .read_poll = (iButtonProtocolGroupReadFunc)ibutton_protocol_group_dallas_read_poll,
+    .read_stop = (iButtonProtocolGroupReadControlFunc)ibutton_protocol_group_dallas_read_stop,
     .write_id = (iButtonProtocolGroupWriteFunc)ibutton_protocol_group_dallas_write_id,
     .write_copy = (iButtonProtocolGroupWriteFunc)ibutton_protocol_group_dallas_write_copy,
 
@@ -8,12 +8,19 @@
 #include "protocol_group_misc_defs.h"
 
 #define IBUTTON_MISC_READ_TIMEOUT 100
+#define IBUTTON_MISC_READ_BATCH   64
 
 #define IBUTTON_MISC_DATA_KEY_KEY_COMMON "Data"
 
+typedef struct {
+    uint32_t last_dwt_value;
+    FuriStreamBuffer* stream;
+} iButtonReadContext;
+
 typedef struct {
     ProtocolDict* dict;
     ProtocolId emulate_id;
+    iButtonReadContext read_context;
 } iButtonProtocolGroupMisc;
 
 static iButtonProtocolGroupMisc* ibutton_protocol_group_misc_alloc(void) {
@@ -67,11 +74,6 @@ static const char* ibutton_protocol_group_misc_get_name(
     return protocol_dict_get_name(group->dict, id);
 }
 
-typedef struct {
-    uint32_t last_dwt_value;
-    FuriStreamBuffer* stream;
-} iButtonReadContext;
-
 static void ibutton_protocols_comparator_callback(bool level, void* context) {
     iButtonReadContext* read_context = context;
 
@@ -84,60 +86,107 @@ static void ibutton_protocols_comparator_callback(bool level, void* context) {
     read_context->last_dwt_value = current_dwt_value;
 }
 
-static bool ibutton_protocol_group_misc_read(
-    iButtonProtocolGroupMisc* group,
-    iButtonProtocolData* data,
-    iButtonProtocolLocalId* id) {
-    bool result = false;
-
+static void ibutton_protocol_group_misc_read_start(iButtonProtocolGroupMisc* group) {
     protocol_dict_decoders_start(group->dict);
 
     furi_hal_rfid_pins_reset();
     // pulldown pull pin, we sense the signal through the analog part of the RFID schematic
     furi_hal_rfid_pin_pull_pulldown();
 
-    iButtonReadContext read_context = {
-        .last_dwt_value = DWT->CYCCNT,
-        .stream = furi_stream_buffer_alloc(sizeof(LevelDuration) * 512, 1),
-    };
+    group->read_context.last_dwt_value = DWT->CYCCNT;
+    group->read_context.stream = furi_stream_buffer_alloc(sizeof(LevelDuration) * 512, 1);
 
-    furi_hal_rfid_comp_set_callback(ibutton_protocols_comparator_callback, &read_context);
+    furi_hal_rfid_comp_set_callback(ibutton_protocols_comparator_callback, &group->read_context);
     furi_hal_rfid_comp_start();
+}
+
+static void ibutton_protocol_group_misc_read_stop(iButtonProtocolGroupMisc* group) {
+    furi_hal_rfid_comp_stop();
+    furi_hal_rfid_comp_set_callback(NULL, NULL);
+    furi_hal_rfid_pins_reset();
+
+    furi_stream_buffer_free(group->read_context.stream);
+    group->read_context.stream = NULL;
+}
+
+static bool ibutton_protocol_group_misc_read_decode(
+    iButtonProtocolGroupMisc* group,
+    const LevelDuration* levels,
+    size_t count,
+    iButtonProtocolData* data,
+    iButtonProtocolLocalId* id) {
+    bool result = false;
+
+    while(count > 0) {
+        size_t consumed;
+        ProtocolId decoded_index =
+            protocol_dict_decoders_feed_batch(group->dict, levels, count, &consumed);
+        levels += consumed;
+        count -= consumed;
+
+        if(decoded_index == PROTOCOL_NO) continue;
+
+        *id = decoded_index;
+
+        protocol_dict_get_data(
+            group->dict,
+            decoded_index,
+            data,
+            protocol_dict_get_data_size(group->dict, decoded_index));
+
+        result = true;
+    }
+
+    return result;
+}
+
+static bool ibutton_protocol_group_misc_read(
+    iButtonProtocolGroupMisc* group,
+    iButtonProtocolData* data,
+    iButtonProtocolLocalId* id) {
+    bool result = false;
+
+    ibutton_protocol_group_misc_read_start(group);
 
     const uint32_t tick_start = furi_get_tick();
 
+    LevelDuration levels[IBUTTON_MISC_READ_BATCH];
+
     for(;;) {
-        LevelDuration level;
+        // take everything comparator produced since last wake up
         size_t ret = furi_stream_buffer_receive(
-            read_context.stream, &level, sizeof(LevelDuration), IBUTTON_MISC_READ_TIMEOUT);
+            group->read_context.stream, levels, sizeof(levels), IBUTTON_MISC_READ_TIMEOUT);
 
         if((furi_get_tick() - tick_start) > IBUTTON_MISC_READ_TIMEOUT) {
             break;
         }
 
-        if(ret > 0) {
-            ProtocolId decoded_index = protocol_dict_decoders_feed(
-                group->dict, level_duration_get_level(level), level_duration_get_duration(level));
+        result |= ibutton_protocol_group_misc_read_decode(
+            group, levels, ret / sizeof(LevelDuration), data, id);
+    }
 
-            if(decoded_index == PROTOCOL_NO) continue;
+    ibutton_protocol_group_misc_read_stop(group);
 
-            *id = decoded_index;
+    return result;
+}
 
-            protocol_dict_get_data(
-                group->dict,
-                decoded_index,
-                data,
-                protocol_dict_get_data_size(group->dict, decoded_index));
+static bool ibutton_protocol_group_misc_read_poll(
+    iButtonProtocolGroupMisc* group,
+    iButtonProtocolData* data,
+    iButtonProtocolLocalId* id) {
+    bool result = false;
 
-            result = true;
-        }
-    }
+    LevelDuration levels[IBUTTON_MISC_READ_BATCH];
 
-    furi_hal_rfid_comp_stop();
-    furi_hal_rfid_comp_set_callback(NULL, NULL);
-    furi_hal_rfid_pins_reset();
+    // decode whatever comparator produced since the last poll, don't wait for more
+    for(;;) {
+        size_t ret =
+            furi_stream_buffer_receive(group->read_context.stream, levels, sizeof(levels), 0);
+        if(ret == 0) break;
 
-    furi_stream_buffer_free(read_context.stream);
+        result |= ibutton_protocol_group_misc_read_decode(
+            group, levels, ret / sizeof(LevelDuration), data, id);
+    }
 
     return result;
 }
@@ -284,6 +333,9 @@ const iButtonProtocolGroupBase ibutton_protocol_group_misc = {
     .get_name = (iButtonProtocolGroupGetStringFunc)ibutton_protocol_group_misc_get_name,
 
     .read = (iButtonProtocolGroupReadFunc)ibutton_protocol_group_misc_read,
+    .read_start = (iButtonProtocolGroupReadControlFunc)ibutton_protocol_group_misc_read_start,
+    .read_poll = (iButtonProtocolGroupReadFunc)ibutton_protocol_group_misc_read_poll,
+    .read_stop = (iButtonProtocolGroupReadControlFunc)ibutton_protocol_group_misc_read_stop,
     .write_id = NULL,
     .write_copy = NULL,
 
@@ -52,6 +52,8 @@ typedef bool (*iButtonProtocolGroupReadFunc)(
     iButtonProtocolData*,
     iButtonProtocolLocalId*);
 
+typedef void (*iButtonProtocolGroupReadControlFunc)(iButtonProtocolGroupData*);
+
 typedef bool (*iButtonProtocolGroupWriteFunc)(
     iButtonProtocolGroupData*,
     iButtonProtocolData*,
@@ -84,6 +86,9 @@ typedef struct {
     iButtonProtocolGroupGetStringFunc get_name;
 
     iButtonProtocolGroupReadFunc read;
+    iButtonProtocolGroupReadControlFunc read_start;
+    iButtonProtocolGroupReadFunc read_poll;
+    iButtonProtocolGroupReadControlFunc read_stop;
     iButtonProtocolGroupWriteFunc write_id;
     iButtonProtocolGroupWriteFunc write_copy;
 
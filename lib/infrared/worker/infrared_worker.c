@@ -26,6 +26,9 @@
 
 #define INFRARED_WORKER_ALL_EVENTS (INFRARED_WORKER_ALL_RX_EVENTS | INFRARED_WORKER_ALL_TX_EVENTS)
 
+/* Timings encoded per stream write */
+#define INFRARED_WORKER_TX_BATCH (16)
+
 typedef enum {
     InfraredWorkerStateIdle,
     InfraredWorkerStateRunRx,
@@ -231,7 +234,11 @@ InfraredWorker* infrared_worker_alloc(void) {
     size_t buffer_size =
         MAX(sizeof(InfraredWorkerTiming) * (MAX_TIMINGS_AMOUNT + 1),
             sizeof(LevelDuration) * MAX_TIMINGS_AMOUNT);
-    instance->stream = furi_stream_buffer_alloc(buffer_size, sizeof(InfraredWorkerTiming));
+    // TX sends whole timings, keep buffer a whole number of them
+    buffer_size =
+        ROUND_UP_TO(buffer_size, sizeof(InfraredWorkerTiming)) * sizeof(InfraredWorkerTiming);
+    instance->stream = furi_stream_buffer_alloc_ex(
+        buffer_size, sizeof(InfraredWorkerTiming), sizeof(InfraredWorkerTiming));
     instance->infrared_decoder = infrared_alloc_decoder();
     instance->infrared_encoder = infrared_alloc_encoder();
     instance->blink_enable = false;
@@ -426,45 +433,56 @@ static bool infrared_get_new_signal(InfraredWorker* instance) {
 
 static bool infrared_worker_tx_fill_buffer(InfraredWorker* instance) {
     bool new_data_available = true;
-    InfraredWorkerTiming timing;
+    InfraredWorkerTiming timings[INFRARED_WORKER_TX_BATCH];
     InfraredStatus status = InfraredStatusError;
 
-    while(!furi_stream_buffer_is_full(instance->stream) && !instance->tx.need_reinitialization &&
-          new_data_available) {
-        if(instance->signal.decoded) {
-            status = infrared_encode(instance->infrared_encoder, &timing.duration, &timing.level);
-        } else {
-            timing.duration = instance->signal.raw.timings[instance->tx.tx_raw_cnt];
-            /* raw always starts from Mark, but we fill it with space delay at start */
-            timing.level = (instance->tx.tx_raw_cnt % 2);
-            ++instance->tx.tx_raw_cnt;
-            if(instance->tx.tx_raw_cnt >= instance->signal.timings_cnt) {
-                instance->tx.tx_raw_cnt = 0;
-                status = InfraredStatusDone;
+    while(!instance->tx.need_reinitialization && new_data_available) {
+        // Encode as many timings as fit and send them with one write
+        const size_t free_count =
+            furi_stream_buffer_spaces_available(instance->stream) / sizeof(InfraredWorkerTiming);
+        const size_t batch_size = MIN(free_count, (size_t)INFRARED_WORKER_TX_BATCH);
+        if(!batch_size) break;
+
+        size_t count = 0;
+        while(count < batch_size && !instance->tx.need_reinitialization && new_data_available) {
+            InfraredWorkerTiming* timing = &timings[count++];
+
+            if(instance->signal.decoded) {
+                status = infrared_encode(
+                    instance->infrared_encoder, &timing->duration, &timing->level);
             } else {
-                status = InfraredStatusOk;
+                timing->duration = instance->signal.raw.timings[instance->tx.tx_raw_cnt];
+                /* raw always starts from Mark, but we fill it with space delay at start */
+                timing->level = (instance->tx.tx_raw_cnt % 2);
+                ++instance->tx.tx_raw_cnt;
+                if(instance->tx.tx_raw_cnt >= instance->signal.timings_cnt) {
+                    instance->tx.tx_raw_cnt = 0;
+                    status = InfraredStatusDone;
+                } else {
+                    status = InfraredStatusOk;
+                }
             }
-        }
 
-        if(status == InfraredStatusError) {
-            new_data_available = false;
-            furi_crash();
-        } else if(status == InfraredStatusOk) {
-            timing.state = FuriHalInfraredTxGetDataStateOk;
-        } else if(status == InfraredStatusDone) {
-            timing.state = FuriHalInfraredTxGetDataStateDone;
-
-            new_data_available = infrared_get_new_signal(instance);
-            if(instance->tx.need_reinitialization || !new_data_available) {
-                timing.state = FuriHalInfraredTxGetDataStateLastDone;
+            if(status == InfraredStatusError) {
+                new_data_available = false;
+                furi_crash();
+            } else if(status == InfraredStatusOk) {
+                timing->state = FuriHalInfraredTxGetDataStateOk;
+            } else if(status == InfraredStatusDone) {
+                timing->state = FuriHalInfraredTxGetDataStateDone;
+
+                new_data_available = infrared_get_new_signal(instance);
+                if(instance->tx.need_reinitialization || !new_data_available) {
+                    timing->state = FuriHalInfraredTxGetDataStateLastDone;
+                }
+            } else {
+                furi_crash();
             }
-        } else {
-            furi_crash();
         }
-        uint32_t written_size =
-            furi_stream_buffer_send(instance->stream, &timing, sizeof(InfraredWorkerTiming), 0);
-        furi_assert(sizeof(InfraredWorkerTiming) == written_size);
-        (void)written_size;
+
+        size_t written = furi_stream_buffer_send_batch(instance->stream, timings, count, 0);
+        furi_assert(written == count);
+        (void)written;
     }
 
     return new_data_available;
@@ -4,7 +4,14 @@
 #include <toolbox/varint.h>
 
 #define LFRFID_RAW_FILE_MAGIC   0x4C464952
-#define LFRFID_RAW_FILE_VERSION 1
+#define LFRFID_RAW_FILE_VERSION 2
+
+#define LFRFID_RAW_FILE_VERSION_VARINT     1
+#define LFRFID_RAW_FILE_VERSION_COMPRESSED 2
+
+#define LFRFID_RAW_FILE_INDEX_MAGIC 0x58444E49
+#define LFRFID_RAW_FILE_INDEX_CHUNK 16
+#define LFRFID_RAW_FILE_SKIP_CHUNK  16
 
 #define TAG "LfRfidRawFile"
 
@@ -16,13 +23,36 @@ typedef struct {
     uint32_t max_buffer_size;
 } LFRFIDRawFileHeader;
 
+// Compressed file layout:
+// header, blocks of [uint32_t size][codec block], uint32_t 0, index entries, footer.
+// Index and footer are written by lfrfid_raw_file_write_end, file without them is still
+// readable from the beginning.
+typedef struct {
+    uint32_t offset;
+    uint32_t first_pair;
+} LFRFIDRawFileIndexEntry;
+
+typedef struct {
+    uint32_t block_count;
+    uint32_t pair_count;
+    uint32_t index_offset;
+    uint32_t magic;
+} LFRFIDRawFileFooter;
+
 struct LFRFIDRawFile {
     Stream* stream;
+    uint32_t version;
     uint32_t max_buffer_size;
 
     uint8_t* buffer;
     uint32_t buffer_size;
     size_t buffer_counter;
+
+    LFRFIDRawDecoder decoder;
+    LFRFIDRawFileFooter footer;
+
+    LFRFIDRawPair* pairs;
+    size_t pairs_count;
 };
 
 LFRFIDRawFile* lfrfid_raw_file_alloc(Storage* storage) {
@@ -31,6 +61,7 @@ LFRFIDRawFile* lfrfid_raw_file_alloc(Storage* storage) {
     LFRFIDRawFile* file = malloc(sizeof(LFRFIDRawFile));
     file->stream = file_stream_alloc(storage);
     file->buffer = NULL;
+    file->pairs = NULL;
     return file;
 }
 
@@ -38,6 +69,7 @@ void lfrfid_raw_file_free(LFRFIDRawFile* file) {
     furi_check(file);
 
     if(file->buffer) free(file->buffer);
+    if(file->pairs) free(file->pairs);
     stream_free(file->stream);
     free(file);
 }
@@ -62,33 +94,176 @@ bool lfrfid_raw_file_write_header(
     float duty_cycle,
     uint32_t max_buffer_size) {
     furi_check(file);
+    UNUSED(max_buffer_size);
 
+    // real maximum is written by lfrfid_raw_file_write_end
     LFRFIDRawFileHeader header = {
         .magic = LFRFID_RAW_FILE_MAGIC,
         .version = LFRFID_RAW_FILE_VERSION,
         .frequency = frequency,
         .duty_cycle = duty_cycle,
-        .max_buffer_size = max_buffer_size};
+        .max_buffer_size = LFRFID_RAW_CODEC_MAX_SIZE(LFRFID_RAW_CODEC_BLOCK_PAIRS)};
+
+    if(!file->buffer) file->buffer = malloc(header.max_buffer_size);
+    if(!file->pairs) file->pairs = malloc(sizeof(LFRFIDRawPair) * LFRFID_RAW_CODEC_BLOCK_PAIRS);
+    file->version = header.version;
+    file->max_buffer_size = 0;
+    file->pairs_count = 0;
+    memset(&file->footer, 0, sizeof(LFRFIDRawFileFooter));
 
     size_t size = stream_write(file->stream, (uint8_t*)&header, sizeof(LFRFIDRawFileHeader));
     return size == sizeof(LFRFIDRawFileHeader);
 }
 
+static bool lfrfid_raw_file_write_block(LFRFIDRawFile* file) {
+    uint32_t size = lfrfid_raw_codec_encode(file->pairs, file->pairs_count, file->buffer);
+
+    if(stream_write(file->stream, (uint8_t*)&size, sizeof(uint32_t)) != sizeof(uint32_t)) {
+        return false;
+    }
+    if(stream_write(file->stream, file->buffer, size) != size) return false;
+
+    file->footer.block_count++;
+    file->footer.pair_count += file->pairs_count;
+    file->max_buffer_size = MAX(file->max_buffer_size, size);
+    file->pairs_count = 0;
+
+    return true;
+}
+
 bool lfrfid_raw_file_write_buffer(LFRFIDRawFile* file, uint8_t* buffer_data, size_t buffer_size) {
     furi_check(file);
+    furi_check(file->pairs);
     furi_check(buffer_data);
     furi_check(buffer_size);
 
-    size_t size;
-    size = stream_write(file->stream, (uint8_t*)&buffer_size, sizeof(size_t));
-    if(size != sizeof(size_t)) return false;
+    size_t index = 0;
+    while(index < buffer_size) {
+        LFRFIDRawPair* pair = &file->pairs[file->pairs_count];
+        size_t length = 0;
+        if(!varint_pair_unpack(
+               &buffer_data[index], buffer_size - index, &pair->pulse, &pair->duration, &length)) {
+            FURI_LOG_E(TAG, "write buffer: broken pair");
+            return false;
+        }
+        index += length;
+
+        if(++file->pairs_count == LFRFID_RAW_CODEC_BLOCK_PAIRS) {
+            if(!lfrfid_raw_file_write_block(file)) return false;
+        }
+    }
+
+    return true;
+}
+
+static bool lfrfid_raw_file_write_index(LFRFIDRawFile* file) {
+    LFRFIDRawFileIndexEntry entries[LFRFID_RAW_FILE_INDEX_CHUNK];
+    uint32_t offset = sizeof(LFRFIDRawFileHeader);
+    uint32_t first_pair = 0;
+
+    // walk block headers and append their positions to the end of file, chunk by chunk
+    for(uint32_t block = 0; block < file->footer.block_count;) {
+        size_t count = 0;
+        while(count < LFRFID_RAW_FILE_INDEX_CHUNK && block < file->footer.block_count) {
+            uint32_t size;
+            uint8_t block_header[LFRFID_RAW_CODEC_HEADER_SIZE];
+            if(!stream_seek(file->stream, offset, StreamOffsetFromStart) ||
+               stream_read(file->stream, (uint8_t*)&size, sizeof(uint32_t)) != sizeof(uint32_t) ||
+               stream_read(file->stream, block_header, sizeof(block_header)) !=
+                   sizeof(block_header)) {
+                return false;
+            }
 
-    size = stream_write(file->stream, buffer_data, buffer_size);
-    if(size != buffer_size) return false;
+            entries[count].offset = offset;
+            entries[count].first_pair = first_pair;
+            count++;
+            block++;
+
+            offset += sizeof(uint32_t) + size;
+            first_pair += block_header[0] | (block_header[1] << 8);
+        }
+
+        size_t entries_size = count * sizeof(LFRFIDRawFileIndexEntry);
+        if(!stream_seek(file->stream, 0, StreamOffsetFromEnd) ||
+           stream_write(file->stream, (uint8_t*)entries, entries_size) != entries_size) {
+            return false;
+        }
+    }
 
     return true;
 }
 
+bool lfrfid_raw_file_write_end(LFRFIDRawFile* file) {
+    furi_check(file);
+    furi_check(file->pairs);
+
+    bool result = false;
+
+    do {
+        if(file->pairs_count > 0 && !lfrfid_raw_file_write_block(file)) break;
+
+        uint32_t terminator = 0;
+        if(stream_write(file->stream, (uint8_t*)&terminator, sizeof(uint32_t)) !=
+           sizeof(uint32_t)) {
+            break;
+        }
+
+        file->footer.index_offset = stream_tell(file->stream);
+        file->footer.magic = LFRFID_RAW_FILE_INDEX_MAGIC;
+        if(!lfrfid_raw_file_write_index(file)) break;
+
+        if(!stream_seek(file->stream, 0, StreamOffsetFromEnd) ||
+           stream_write(file->stream, (uint8_t*)&file->footer, sizeof(LFRFIDRawFileFooter)) !=
+               sizeof(LFRFIDRawFileFooter)) {
+            break;
+        }
+
+        // let reader allocate only as much as the biggest block
+        if(!stream_seek(
+               file->stream,
+               offsetof(LFRFIDRawFileHeader, max_buffer_size),
+               StreamOffsetFromStart) ||
+           stream_write(file->stream, (uint8_t*)&file->max_buffer_size, sizeof(uint32_t)) !=
+               sizeof(uint32_t)) {
+            break;
+        }
+
+        result = true;
+    } while(false);
+
+    return result;
+}
+
+static void lfrfid_raw_file_read_footer(LFRFIDRawFile* file) {
+    LFRFIDRawFileFooter footer;
+    size_t file_size = stream_size(file->stream);
+    memset(&file->footer, 0, sizeof(LFRFIDRawFileFooter));
+
+    if(file_size < sizeof(LFRFIDRawFileHeader) + sizeof(LFRFIDRawFileFooter)) return;
+    if(!stream_seek(file->stream, -(int32_t)sizeof(LFRFIDRawFileFooter), StreamOffsetFromEnd)) {
+        return;
+    }
+    if(stream_read(file->stream, (uint8_t*)&footer, sizeof(LFRFIDRawFileFooter)) !=
+       sizeof(LFRFIDRawFileFooter)) {
+        return;
+    }
+
+    size_t index_size = footer.block_count * sizeof(LFRFIDRawFileIndexEntry);
+    if(footer.magic == LFRFID_RAW_FILE_INDEX_MAGIC &&
+       footer.index_offset + index_size + sizeof(LFRFIDRawFileFooter) == file_size) {
+        file->footer = footer;
+    } else {
+        FURI_LOG_W(TAG, "read header: no block index");
+    }
+}
+
+static void lfrfid_raw_file_rewind(LFRFIDRawFile* file) {
+    stream_seek(file->stream, sizeof(LFRFIDRawFileHeader), StreamOffsetFromStart);
+    file->buffer_size = 0;
+    file->buffer_counter = 0;
+    file->decoder.pairs_left = 0;
+}
+
 bool lfrfid_raw_file_read_header(LFRFIDRawFile* file, float* frequency, float* duty_cycle) {
     furi_check(file);
     furi_check(frequency);
@@ -97,13 +272,22 @@ bool lfrfid_raw_file_read_header(LFRFIDRawFile* file, float* frequency, float* d
     LFRFIDRawFileHeader header;
     size_t size = stream_read(file->stream, (uint8_t*)&header, sizeof(LFRFIDRawFileHeader));
     if(size == sizeof(LFRFIDRawFileHeader)) {
-        if(header.magic == LFRFID_RAW_FILE_MAGIC && header.version == LFRFID_RAW_FILE_VERSION) {
+        if(header.magic == LFRFID_RAW_FILE_MAGIC &&
+           (header.version == LFRFID_RAW_FILE_VERSION_VARINT ||
+            header.version == LFRFID_RAW_FILE_VERSION_COMPRESSED)) {
             *frequency = header.frequency;
             *duty_cycle = header.duty_cycle;
+            file->version = header.version;
             file->max_buffer_size = header.max_buffer_size;
             file->buffer = malloc(file->max_buffer_size);
-            file->buffer_size = 0;
-            file->buffer_counter = 0;
+
+            if(file->version == LFRFID_RAW_FILE_VERSION_COMPRESSED) {
+                lfrfid_raw_file_read_footer(file);
+            } else {
+                memset(&file->footer, 0, sizeof(LFRFIDRawFileFooter));
+            }
+
+            lfrfid_raw_file_rewind(file);
             return true;
         } else {
             return false;
@@ -113,6 +297,105 @@ bool lfrfid_raw_file_read_header(LFRFIDRawFile* file, float* frequency, float* d
     }
 }
 
+static bool lfrfid_raw_file_load_buffer(LFRFIDRawFile* file) {
+    size_t length = stream_read(file->stream, (uint8_t*)&file->buffer_size, sizeof(size_t));
+    if(length != sizeof(size_t)) {
+        return false;
+    }
+
+    if(file->buffer_size > file->max_buffer_size) {
+        FURI_LOG_E(TAG, "read pair: buffer size is too big");
+        return false;
+    }
+
+    length = stream_read(file->stream, file->buffer, file->buffer_size);
+    if(length != file->buffer_size) {
+        FURI_LOG_E(TAG, "read pair: failed to read data");
+        return false;
+    }
+
+    file->buffer_counter = 0;
+    return true;
+}
+
+static size_t
+    lfrfid_raw_file_read_varint_pairs(LFRFIDRawFile* file, LFRFIDRawPair* pairs, size_t count) {
+    size_t result = 0;
+
+    while(result < count) {
+        if(file->buffer_counter >= file->buffer_size) {
+            if(!lfrfid_raw_file_load_buffer(file)) break;
+            continue;
+        }
+
+        size_t size = 0;
+        if(!varint_pair_unpack(
+               &file->buffer[file->buffer_counter],
+               (size_t)(file->buffer_size - file->buffer_counter),
+               &pairs[result].pulse,
+               &pairs[result].duration,
+               &size)) {
+            FURI_LOG_E(TAG, "read pair: buffer is too small");
+            file->buffer_counter = file->buffer_size;
+            break;
+        }
+
+        file->buffer_counter += size;
+        result++;
+    }
+
+    return result;
+}
+
+static bool lfrfid_raw_file_load_block(LFRFIDRawFile* file) {
+    uint32_t size;
+    if(stream_read(file->stream, (uint8_t*)&size, sizeof(uint32_t)) != sizeof(uint32_t)) {
+        return false;
+    }
+
+    // zero size terminates blocks
+    if(size == 0) return false;
+
+    if(size > file->max_buffer_size) {
+        FURI_LOG_E(TAG, "read pair: block size is too big");
+        return false;
+    }
+
+    if(stream_read(file->stream, file->buffer, size) != size) {
+        FURI_LOG_E(TAG, "read pair: failed to read block");
+        return false;
+    }
+
+    return lfrfid_raw_codec_decoder_init(&file->decoder, file->buffer, size);
+}
+
+static size_t lfrfid_raw_file_read_compressed_pairs(
+    LFRFIDRawFile* file,
+    LFRFIDRawPair* pairs,
+    size_t count) {
+    size_t result = 0;
+
+    while(result < count) {
+        size_t decoded = lfrfid_raw_codec_decode(&file->decoder, &pairs[result], count - result);
+        if(decoded == 0 && !lfrfid_raw_file_load_block(file)) break;
+        result += decoded;
+    }
+
+    return result;
+}
+
+size_t lfrfid_raw_file_read_pairs(LFRFIDRawFile* file, LFRFIDRawPair* pairs, size_t count) {
+    furi_check(file);
+    furi_check(file->buffer);
+    furi_check(pairs);
+
+    if(file->version == LFRFID_RAW_FILE_VERSION_COMPRESSED) {
+        return lfrfid_raw_file_read_compressed_pairs(file, pairs, count);
+    } else {
+        return lfrfid_raw_file_read_varint_pairs(file, pairs, count);
+    }
+}
+
 bool lfrfid_raw_file_read_pair(
     LFRFIDRawFile* file,
     uint32_t* duration,
@@ -122,48 +405,101 @@ bool lfrfid_raw_file_read_pair(
     furi_check(duration);
     furi_check(pulse);
 
-    size_t length = 0;
-    if(file->buffer_counter >= file->buffer_size) {
-        if(stream_eof(file->stream)) {
-            // rewind stream and pass header
-            stream_seek(file->stream, sizeof(LFRFIDRawFileHeader), StreamOffsetFromStart);
-            if(pass_end) *pass_end = true;
-        }
+    LFRFIDRawPair pair;
+    if(lfrfid_raw_file_read_pairs(file, &pair, 1) == 0) {
+        // rewind stream and pass header
+        lfrfid_raw_file_rewind(file);
+        if(pass_end) *pass_end = true;
 
-        length = stream_read(file->stream, (uint8_t*)&file->buffer_size, sizeof(size_t));
-        if(length != sizeof(size_t)) {
-            FURI_LOG_E(TAG, "read pair: failed to read size");
+        if(lfrfid_raw_file_read_pairs(file, &pair, 1) == 0) {
+            FURI_LOG_E(TAG, "read pair: no data");
             return false;
         }
+    }
 
-        if(file->buffer_size > file->max_buffer_size) {
-            FURI_LOG_E(TAG, "read pair: buffer size is too big");
-            return false;
-        }
+    *duration = pair.duration;
+    *pulse = pair.pulse;
+    return true;
+}
 
-        length = stream_read(file->stream, file->buffer, file->buffer_size);
-        if(length != file->buffer_size) {
-            FURI_LOG_E(TAG, "read pair: failed to read data");
-            return false;
+// Finds block containing pair, leaves stream at its start
+static bool
+    lfrfid_raw_file_seek_block(LFRFIDRawFile* file, uint32_t pair_index, uint32_t* first_pair) {
+    LFRFIDRawFileIndexEntry entry = {.offset = sizeof(LFRFIDRawFileHeader), .first_pair = 0};
+
+    if(file->footer.block_count > 0) {
+        // binary search for the last block starting at or before the pair
+        uint32_t low = 0;
+        uint32_t high = file->footer.block_count;
+        while(high - low > 1) {
+            uint32_t middle = low + (high - low) / 2;
+            LFRFIDRawFileIndexEntry middle_entry;
+            if(!stream_seek(
+                   file->stream,
+                   file->footer.index_offset + middle * sizeof(LFRFIDRawFileIndexEntry),
+                   StreamOffsetFromStart) ||
+               stream_read(
+                   file->stream, (uint8_t*)&middle_entry, sizeof(LFRFIDRawFileIndexEntry)) !=
+                   sizeof(LFRFIDRawFileIndexEntry)) {
+                return false;
+            }
+
+            if(middle_entry.first_pair <= pair_index) {
+                low = middle;
+                entry = middle_entry;
+            } else {
+                high = middle;
+            }
         }
+    } else {
+        // no index, walk block headers
+        while(true) {
+            uint32_t size;
+            uint8_t block_header[LFRFID_RAW_CODEC_HEADER_SIZE];
+            if(!stream_seek(file->stream, entry.offset, StreamOffsetFromStart) ||
+               stream_read(file->stream, (uint8_t*)&size, sizeof(uint32_t)) != sizeof(uint32_t) ||
+               size == 0 ||
+               stream_read(file->stream, block_header, sizeof(block_header)) !=
+                   sizeof(block_header)) {
+                return false;
+            }
 
-        file->buffer_counter = 0;
+            uint32_t count = block_header[0] | (block_header[1] << 8);
+            if(entry.first_pair + count > pair_index) break;
+
+            entry.offset += sizeof(uint32_t) + size;
+            entry.first_pair += count;
+        }
     }
 
-    size_t size = 0;
-    bool result = varint_pair_unpack(
-        &file->buffer[file->buffer_counter],
-        (size_t)(file->buffer_size - file->buffer_counter),
-        pulse,
-        duration,
-        &size);
+    *first_pair = entry.first_pair;
+    return stream_seek(file->stream, entry.offset, StreamOffsetFromStart);
+}
 
-    if(result) {
-        file->buffer_counter += size;
-    } else {
-        FURI_LOG_E(TAG, "read pair: buffer is too small");
-        return false;
+bool lfrfid_raw_file_seek_pair(LFRFIDRawFile* file, uint32_t pair_index) {
+    furi_check(file);
+    furi_check(file->buffer);
+
+    uint32_t position = 0;
+    lfrfid_raw_file_rewind(file);
+
+    if(file->version == LFRFID_RAW_FILE_VERSION_COMPRESSED) {
+        if(!lfrfid_raw_file_seek_block(file, pair_index, &position)) return false;
+    }
+
+    // skip pairs preceding requested one
+    LFRFIDRawPair pairs[LFRFID_RAW_FILE_SKIP_CHUNK];
+    while(position < pair_index) {
+        size_t count = MIN(pair_index - position, (uint32_t)LFRFID_RAW_FILE_SKIP_CHUNK);
+        size_t skipped = lfrfid_raw_file_read_pairs(file, pairs, count);
+        if(skipped == 0) return false;
+        position += skipped;
     }
 
     return true;
 }
+
+uint32_t lfrfid_raw_file_get_pair_count(LFRFIDRawFile* file) {
+    furi_check(file);
+    return file->footer.pair_count;
+}
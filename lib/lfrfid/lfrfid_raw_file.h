@@ -1,6 +1,7 @@
 #pragma once
 #include <furi.h>
 #include <storage/storage.h>
+#include "tools/lfrfid_raw_codec.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -46,7 +47,7 @@ bool lfrfid_raw_file_open_read(LFRFIDRawFile* file, const char* file_path);
  * @param file 
  * @param frequency 
  * @param duty_cycle 
- * @param max_buffer_size 
+ * @param max_buffer_size not used, pairs are stored in compressed blocks
  * @return bool 
  */
 bool lfrfid_raw_file_write_header(
@@ -59,12 +60,21 @@ bool lfrfid_raw_file_write_header(
  * @brief Write data to RAW file
  * 
  * @param file 
- * @param buffer_data 
+ * @param buffer_data varint-encoded pairs
  * @param buffer_size 
  * @return bool 
  */
 bool lfrfid_raw_file_write_buffer(LFRFIDRawFile* file, uint8_t* buffer_data, size_t buffer_size);
 
+/**
+ * @brief Finish RAW file: write pending pairs and block index
+ * File without index is still readable, but can't be seeked quickly.
+ * 
+ * @param file 
+ * @return bool 
+ */
+bool lfrfid_raw_file_write_end(LFRFIDRawFile* file);
+
 /**
  * @brief Read RAW file header
  * 
@@ -90,6 +100,34 @@ bool lfrfid_raw_file_read_pair(
     uint32_t* pulse,
     bool* pass_end);
 
+/**
+ * @brief Read pairs from RAW file, without wrapping around
+ * 
+ * @param file 
+ * @param pairs output pairs
+ * @param count maximum pair count
+ * @return size_t read pair count, 0 at the end of file
+ */
+size_t lfrfid_raw_file_read_pairs(LFRFIDRawFile* file, LFRFIDRawPair* pairs, size_t count);
+
+/**
+ * @brief Move RAW file read position to pair
+ * Uses block index if file has one, otherwise skips data before the pair.
+ * 
+ * @param file 
+ * @param pair_index 
+ * @return bool false if file is shorter
+ */
+bool lfrfid_raw_file_seek_pair(LFRFIDRawFile* file, uint32_t pair_index);
+
+/**
+ * @brief Get pair count from RAW file index
+ * 
+ * @param file 
+ * @return uint32_t pair count, 0 if file has no index
+ */
+uint32_t lfrfid_raw_file_get_pair_count(LFRFIDRawFile* file);
+
 #ifdef __cplusplus
 }
 #endif
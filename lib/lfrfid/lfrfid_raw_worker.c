@@ -199,6 +199,14 @@ static int32_t lfrfid_raw_read_worker_thread(void* thread_context) {
 
         furi_hal_rfid_tim_read_capture_stop();
         furi_hal_rfid_tim_read_stop();
+
+        if(file_valid) {
+            // flush pending pairs and write block index
+            file_valid = lfrfid_raw_file_write_end(file);
+            if(!file_valid && worker->read_callback != NULL) {
+                worker->read_callback(LFRFIDWorkerReadRawFileError, worker->context);
+            }
+        }
     } else {
         if(worker->read_callback != NULL) {
             // message file_error to worker
@@ -5,6 +5,7 @@
 #include <toolbox/pulse_protocols/pulse_glue.h>
 #include <toolbox/buffer_stream.h>
 #include "tools/varint_pair.h"
+#include "tools/lfrfid_demod.h"
 #include <lib/bit_lib/bit_lib.h>
 
 #define TAG "LfRfidWorker"
@@ -140,6 +141,7 @@ static LFRFIDWorkerReadState lfrfid_worker_read_internal(
     uint8_t* last_data = malloc(last_size);
     uint8_t* protocol_data = malloc(last_size);
     size_t last_read_count = 0;
+    LFRFIDDemod* demod = lfrfid_demod_alloc();
 
     uint32_t switch_os_tick_last = furi_get_tick();
 
@@ -220,11 +222,14 @@ static LFRFIDWorkerReadState lfrfid_worker_read_internal(
 
                 ProtocolId protocol = PROTOCOL_NO;
 
-                protocol = protocol_dict_decoders_feed_by_feature(
-                    worker->protocols, feature, true, pulse);
+                // edge is classified once and shared by all decoders
+                const LFRFIDSymbol* symbol = lfrfid_demod_feed(demod, true, pulse);
+                protocol = protocol_dict_decoders_feed_symbol_by_feature(
+                    worker->protocols, feature, true, pulse, symbol);
                 if(protocol == PROTOCOL_NO) {
-                    protocol = protocol_dict_decoders_feed_by_feature(
-                        worker->protocols, feature, false, duration - pulse);
+                    symbol = lfrfid_demod_feed(demod, false, duration - pulse);
+                    protocol = protocol_dict_decoders_feed_symbol_by_feature(
+                        worker->protocols, feature, false, duration - pulse, symbol);
                 }
 
                 if(protocol != PROTOCOL_NO) {
@@ -318,6 +323,7 @@ static LFRFIDWorkerReadState lfrfid_worker_read_internal(
     varint_pair_free(ctx.pair);
     buffer_stream_free(ctx.stream);
 
+    lfrfid_demod_free(demod);
     free(protocol_data);
     free(last_data);
 
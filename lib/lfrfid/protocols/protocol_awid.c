@@ -1,6 +1,7 @@
 #include <furi.h>
 #include <toolbox/protocols/protocol.h>
 #include <lfrfid/tools/fsk_demod.h>
+#include <lfrfid/tools/lfrfid_demod.h>
 #include <lfrfid/tools/fsk_osc.h>
 #include <bit_lib/bit_lib.h>
 #include "lfrfid_protocols.h"
@@ -93,12 +94,9 @@ static void protocol_awid_decode(uint8_t* encoded_data, uint8_t* decoded_data) {
     bit_lib_copy_bits(decoded_data, 0, 66, encoded_data, 8);
 }
 
-bool protocol_awid_decoder_feed(ProtocolAwid* protocol, bool level, uint32_t duration) {
-    bool value;
-    uint32_t count;
+static bool protocol_awid_decoder_feed_bits(ProtocolAwid* protocol, bool value, uint32_t count) {
     bool result = false;
 
-    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
     if(count > 0) {
         for(size_t i = 0; i < count; i++) {
             bit_lib_push_bit(protocol->encoded_data, AWID_ENCODED_DATA_SIZE, value);
@@ -114,6 +112,20 @@ bool protocol_awid_decoder_feed(ProtocolAwid* protocol, bool level, uint32_t dur
     return result;
 }
 
+bool protocol_awid_decoder_feed(ProtocolAwid* protocol, bool level, uint32_t duration) {
+    bool value = false;
+    uint32_t count;
+
+    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
+    return protocol_awid_decoder_feed_bits(protocol, value, count);
+}
+
+bool protocol_awid_decoder_feed_symbol(ProtocolAwid* protocol, const LFRFIDSymbol* symbol) {
+    bool value = false;
+    uint32_t count = lfrfid_symbol_get_fsk_bits(symbol, 6, 5, &value);
+    return protocol_awid_decoder_feed_bits(protocol, value, count);
+}
+
 static void protocol_awid_encode(const uint8_t* decoded_data, uint8_t* encoded_data) {
     memset(encoded_data, 0, AWID_ENCODED_DATA_SIZE);
 
@@ -254,6 +266,7 @@ const ProtocolBase protocol_awid = {
         {
             .start = (ProtocolDecoderStart)protocol_awid_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_awid_decoder_feed,
+            .feed_symbol = (ProtocolDecoderFeedSymbol)protocol_awid_decoder_feed_symbol,
         },
     .encoder =
         {
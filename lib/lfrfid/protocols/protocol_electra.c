@@ -55,6 +55,7 @@
 #include <stdlib.h>
 #include <toolbox/protocols/protocol.h>
 #include <toolbox/manchester_decoder.h>
+#include <lfrfid/tools/lfrfid_demod.h>
 #include "lfrfid_protocols.h"
 
 #define TAG "ELECTRA"
@@ -244,25 +245,9 @@ void protocol_electra_decoder_start(ProtocolElectra* proto) {
         NULL);
 }
 
-bool protocol_electra_decoder_feed(ProtocolElectra* proto, bool level, uint32_t duration) {
+static bool protocol_electra_decoder_feed_event(ProtocolElectra* proto, ManchesterEvent event) {
     bool result = false;
 
-    ManchesterEvent event = ManchesterEventReset;
-
-    if(duration > ELECTRA_READ_SHORT_TIME_LOW && duration < ELECTRA_READ_SHORT_TIME_HIGH) {
-        if(!level) {
-            event = ManchesterEventShortHigh;
-        } else {
-            event = ManchesterEventShortLow;
-        }
-    } else if(duration > ELECTRA_READ_LONG_TIME_LOW && duration < ELECTRA_READ_LONG_TIME_HIGH) {
-        if(!level) {
-            event = ManchesterEventLongHigh;
-        } else {
-            event = ManchesterEventLongLow;
-        }
-    }
-
     if(event != ManchesterEventReset) {
         bool data;
         bool data_ok = manchester_advance(
@@ -301,6 +286,30 @@ bool protocol_electra_decoder_feed(ProtocolElectra* proto, bool level, uint32_t
     return result;
 }
 
+bool protocol_electra_decoder_feed(ProtocolElectra* proto, bool level, uint32_t duration) {
+    ManchesterEvent event = ManchesterEventReset;
+
+    if(duration > ELECTRA_READ_SHORT_TIME_LOW && duration < ELECTRA_READ_SHORT_TIME_HIGH) {
+        if(!level) {
+            event = ManchesterEventShortHigh;
+        } else {
+            event = ManchesterEventShortLow;
+        }
+    } else if(duration > ELECTRA_READ_LONG_TIME_LOW && duration < ELECTRA_READ_LONG_TIME_HIGH) {
+        if(!level) {
+            event = ManchesterEventLongHigh;
+        } else {
+            event = ManchesterEventLongLow;
+        }
+    }
+
+    return protocol_electra_decoder_feed_event(proto, event);
+}
+
+bool protocol_electra_decoder_feed_symbol(ProtocolElectra* proto, const LFRFIDSymbol* symbol) {
+    return protocol_electra_decoder_feed_event(proto, symbol->ask[LFRFIDAskClassRF64]);
+}
+
 static void em_write_nibble(bool low_nibble, uint8_t data, ElectraDecodedData* encoded_base_data) {
     uint8_t parity_sum = 0;
     uint8_t start = 0;
@@ -428,6 +437,7 @@ const ProtocolBase protocol_electra = {
         {
             .start = (ProtocolDecoderStart)protocol_electra_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_electra_decoder_feed,
+            .feed_symbol = (ProtocolDecoderFeedSymbol)protocol_electra_decoder_feed_symbol,
         },
     .encoder =
         {
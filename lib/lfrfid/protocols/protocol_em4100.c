@@ -1,6 +1,7 @@
 #include <furi.h>
 #include <toolbox/protocols/protocol.h>
 #include <toolbox/manchester_decoder.h>
+#include <lfrfid/tools/lfrfid_demod.h>
 #include "lfrfid_protocols.h"
 
 typedef uint64_t EM4100DecodedData;
@@ -69,6 +70,17 @@ uint32_t protocol_em4100_get_t5577_bitrate(ProtocolEM4100* proto) {
     }
 }
 
+static LFRFIDAskClass protocol_em4100_get_ask_class(ProtocolEM4100* proto) {
+    switch(proto->clock_per_bit) {
+    case 32:
+        return LFRFIDAskClassRF32;
+    case 16:
+        return LFRFIDAskClassRF16;
+    default:
+        return LFRFIDAskClassRF64;
+    }
+}
+
 uint16_t protocol_em4100_get_short_time_low(ProtocolEM4100* proto) {
     return EM_READ_SHORT_TIME_BASE / protocol_em4100_get_time_divisor(proto) -
            EM_READ_JITTER_TIME_BASE / protocol_em4100_get_time_divisor(proto);
@@ -197,6 +209,7 @@ static bool em4100_can_be_decoded(
 void protocol_em4100_decoder_start(ProtocolEM4100* proto) {
     memset(proto->data, 0, EM4100_DECODED_DATA_SIZE);
     proto->encoded_data = 0;
+    proto->encoded_epilogue = 0;
     manchester_advance(
         proto->decoder_manchester_state,
         ManchesterEventReset,
@@ -204,28 +217,9 @@ void protocol_em4100_decoder_start(ProtocolEM4100* proto) {
         NULL);
 }
 
-bool protocol_em4100_decoder_feed(ProtocolEM4100* proto, bool level, uint32_t duration) {
+static bool protocol_em4100_decoder_feed_event(ProtocolEM4100* proto, ManchesterEvent event) {
     bool result = false;
 
-    ManchesterEvent event = ManchesterEventReset;
-
-    if(duration > protocol_em4100_get_short_time_low(proto) &&
-       duration < protocol_em4100_get_short_time_high(proto)) {
-        if(!level) {
-            event = ManchesterEventShortHigh;
-        } else {
-            event = ManchesterEventShortLow;
-        }
-    } else if(
-        duration > protocol_em4100_get_long_time_low(proto) &&
-        duration < protocol_em4100_get_long_time_high(proto)) {
-        if(!level) {
-            event = ManchesterEventLongHigh;
-        } else {
-            event = ManchesterEventLongLow;
-        }
-    }
-
     if(event != ManchesterEventReset) {
         bool data;
         bool data_ok = manchester_advance(
@@ -254,6 +248,34 @@ bool protocol_em4100_decoder_feed(ProtocolEM4100* proto, bool level, uint32_t du
     return result;
 }
 
+bool protocol_em4100_decoder_feed(ProtocolEM4100* proto, bool level, uint32_t duration) {
+    ManchesterEvent event = ManchesterEventReset;
+
+    if(duration > protocol_em4100_get_short_time_low(proto) &&
+       duration < protocol_em4100_get_short_time_high(proto)) {
+        if(!level) {
+            event = ManchesterEventShortHigh;
+        } else {
+            event = ManchesterEventShortLow;
+        }
+    } else if(
+        duration > protocol_em4100_get_long_time_low(proto) &&
+        duration < protocol_em4100_get_long_time_high(proto)) {
+        if(!level) {
+            event = ManchesterEventLongHigh;
+        } else {
+            event = ManchesterEventLongLow;
+        }
+    }
+
+    return protocol_em4100_decoder_feed_event(proto, event);
+}
+
+bool protocol_em4100_decoder_feed_symbol(ProtocolEM4100* proto, const LFRFIDSymbol* symbol) {
+    return protocol_em4100_decoder_feed_event(
+        proto, symbol->ask[protocol_em4100_get_ask_class(proto)]);
+}
+
 static void em4100_write_nibble(bool low_nibble, uint8_t data, EM4100DecodedData* encoded_data) {
     uint8_t parity_sum = 0;
     uint8_t start = 0;
@@ -367,6 +389,7 @@ const ProtocolBase protocol_em4100 = {
         {
             .start = (ProtocolDecoderStart)protocol_em4100_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_em4100_decoder_feed,
+            .feed_symbol = (ProtocolDecoderFeedSymbol)protocol_em4100_decoder_feed_symbol,
         },
     .encoder =
         {
@@ -391,6 +414,7 @@ const ProtocolBase protocol_em4100_32 = {
         {
             .start = (ProtocolDecoderStart)protocol_em4100_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_em4100_decoder_feed,
+            .feed_symbol = (ProtocolDecoderFeedSymbol)protocol_em4100_decoder_feed_symbol,
         },
     .encoder =
         {
@@ -415,6 +439,7 @@ const ProtocolBase protocol_em4100_16 = {
         {
             .start = (ProtocolDecoderStart)protocol_em4100_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_em4100_decoder_feed,
+            .feed_symbol = (ProtocolDecoderFeedSymbol)protocol_em4100_decoder_feed_symbol,
         },
     .encoder =
         {
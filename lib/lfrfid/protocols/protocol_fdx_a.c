@@ -1,6 +1,7 @@
 #include <furi.h>
 #include <toolbox/protocols/protocol.h>
 #include <lfrfid/tools/fsk_demod.h>
+#include <lfrfid/tools/lfrfid_demod.h>
 #include <lfrfid/tools/fsk_osc.h>
 #include "lfrfid_protocols.h"
 #include <bit_lib/bit_lib.h>
@@ -107,12 +108,9 @@ static bool protocol_fdx_a_can_be_decoded(const uint8_t* data) {
     return parity_sum == 0;
 }
 
-bool protocol_fdx_a_decoder_feed(ProtocolFDXA* protocol, bool level, uint32_t duration) {
-    bool value;
-    uint32_t count;
+static bool protocol_fdx_a_decoder_feed_bits(ProtocolFDXA* protocol, bool value, uint32_t count) {
     bool result = false;
 
-    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
     if(count > 0) {
         for(size_t i = 0; i < count; i++) {
             bit_lib_push_bit(protocol->encoded_data, FDXA_ENCODED_DATA_SIZE, value);
@@ -126,6 +124,20 @@ bool protocol_fdx_a_decoder_feed(ProtocolFDXA* protocol, bool level, uint32_t du
     return result;
 }
 
+bool protocol_fdx_a_decoder_feed(ProtocolFDXA* protocol, bool level, uint32_t duration) {
+    bool value = false;
+    uint32_t count;
+
+    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
+    return protocol_fdx_a_decoder_feed_bits(protocol, value, count);
+}
+
+bool protocol_fdx_a_decoder_feed_symbol(ProtocolFDXA* protocol, const LFRFIDSymbol* symbol) {
+    bool value = false;
+    uint32_t count = lfrfid_symbol_get_fsk_bits(symbol, 6, 5, &value);
+    return protocol_fdx_a_decoder_feed_bits(protocol, value, count);
+}
+
 static void protocol_fdx_a_encode(ProtocolFDXA* protocol) {
     protocol->encoded_data[0] = FDXA_PREAMBLE_0;
     protocol->encoded_data[1] = FDXA_PREAMBLE_1;
@@ -236,6 +248,7 @@ const ProtocolBase protocol_fdx_a = {
         {
             .start = (ProtocolDecoderStart)protocol_fdx_a_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_fdx_a_decoder_feed,
+            .feed_symbol = (ProtocolDecoderFeedSymbol)protocol_fdx_a_decoder_feed_symbol,
         },
     .encoder =
         {
@@ -2,6 +2,7 @@
 #include <toolbox/protocols/protocol.h>
 #include <toolbox/manchester_decoder.h>
 #include <bit_lib/bit_lib.h>
+#include <lfrfid/tools/lfrfid_demod.h>
 #include "lfrfid_protocols.h"
 
 #define GALLAGHER_CLOCK_PER_BIT (32)
@@ -154,9 +155,29 @@ void protocol_gallagher_decoder_start(ProtocolGallagher* protocol) {
         NULL);
 }
 
-bool protocol_gallagher_decoder_feed(ProtocolGallagher* protocol, bool level, uint32_t duration) {
+static bool
+    protocol_gallagher_decoder_feed_event(ProtocolGallagher* protocol, ManchesterEvent event) {
     bool result = false;
 
+    if(event != ManchesterEventReset) {
+        bool data;
+        bool data_ok = manchester_advance(
+            protocol->decoder_manchester_state, event, &protocol->decoder_manchester_state, &data);
+
+        if(data_ok) {
+            bit_lib_push_bit(protocol->encoded_data, GALLAGHER_ENCODED_BYTE_FULL_SIZE, data);
+
+            if(protocol_gallagher_can_be_decoded(protocol)) {
+                protocol_gallagher_decode(protocol);
+                result = true;
+            }
+        }
+    }
+
+    return result;
+}
+
+bool protocol_gallagher_decoder_feed(ProtocolGallagher* protocol, bool level, uint32_t duration) {
     ManchesterEvent event = ManchesterEventReset;
 
     if(duration > GALLAGHER_READ_SHORT_TIME_LOW && duration < GALLAGHER_READ_SHORT_TIME_HIGH) {
@@ -173,22 +194,13 @@ bool protocol_gallagher_decoder_feed(ProtocolGallagher* protocol, bool level, ui
         }
     }
 
-    if(event != ManchesterEventReset) {
-        bool data;
-        bool data_ok = manchester_advance(
-            protocol->decoder_manchester_state, event, &protocol->decoder_manchester_state, &data);
-
-        if(data_ok) {
-            bit_lib_push_bit(protocol->encoded_data, GALLAGHER_ENCODED_BYTE_FULL_SIZE, data);
-
-            if(protocol_gallagher_can_be_decoded(protocol)) {
-                protocol_gallagher_decode(protocol);
-                result = true;
-            }
-        }
-    }
+    return protocol_gallagher_decoder_feed_event(protocol, event);
+}
 
-    return result;
+bool protocol_gallagher_decoder_feed_symbol(
+    ProtocolGallagher* protocol,
+    const LFRFIDSymbol* symbol) {
+    return protocol_gallagher_decoder_feed_event(protocol, symbol->ask[LFRFIDAskClassRF32Wide]);
 }
 
 bool protocol_gallagher_encoder_start(ProtocolGallagher* protocol) {
@@ -319,6 +331,7 @@ const ProtocolBase protocol_gallagher = {
         {
             .start = (ProtocolDecoderStart)protocol_gallagher_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_gallagher_decoder_feed,
+            .feed_symbol = (ProtocolDecoderFeedSymbol)protocol_gallagher_decoder_feed_symbol,
         },
     .encoder =
         {
@@ -1,6 +1,7 @@
 #include <furi.h>
 #include <toolbox/protocols/protocol.h>
 #include <lfrfid/tools/fsk_demod.h>
+#include <lfrfid/tools/lfrfid_demod.h>
 #include <lfrfid/tools/fsk_osc.h>
 #include "lfrfid_protocols.h"
 
@@ -187,12 +188,10 @@ static void protocol_h10301_decode(const uint32_t* card_data, uint8_t* decoded_d
     memcpy(decoded_data, &data, H10301_DECODED_DATA_SIZE);
 }
 
-bool protocol_h10301_decoder_feed(ProtocolH10301* protocol, bool level, uint32_t duration) {
-    bool value;
-    uint32_t count;
+static bool
+    protocol_h10301_decoder_feed_bits(ProtocolH10301* protocol, bool value, uint32_t count) {
     bool result = false;
 
-    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
     if(count > 0) {
         for(size_t i = 0; i < count; i++) {
             protocol_h10301_decoder_store_data(protocol, value);
@@ -207,6 +206,20 @@ bool protocol_h10301_decoder_feed(ProtocolH10301* protocol, bool level, uint32_t
     return result;
 }
 
+bool protocol_h10301_decoder_feed(ProtocolH10301* protocol, bool level, uint32_t duration) {
+    bool value = false;
+    uint32_t count;
+
+    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
+    return protocol_h10301_decoder_feed_bits(protocol, value, count);
+}
+
+bool protocol_h10301_decoder_feed_symbol(ProtocolH10301* protocol, const LFRFIDSymbol* symbol) {
+    bool value = false;
+    uint32_t count = lfrfid_symbol_get_fsk_bits(symbol, 6, 5, &value);
+    return protocol_h10301_decoder_feed_bits(protocol, value, count);
+}
+
 static void protocol_h10301_write_raw_bit(bool bit, uint8_t position, uint32_t* card_data) {
     if(bit) {
         card_data[position / H10301_BIT_SIZE] |=
@@ -378,6 +391,7 @@ const ProtocolBase protocol_h10301 = {
         {
             .start = (ProtocolDecoderStart)protocol_h10301_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_h10301_decoder_feed,
+            .feed_symbol = (ProtocolDecoderFeedSymbol)protocol_h10301_decoder_feed_symbol,
         },
     .encoder =
         {
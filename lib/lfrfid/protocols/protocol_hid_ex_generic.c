@@ -1,6 +1,7 @@
 #include <furi.h>
 #include <toolbox/protocols/protocol.h>
 #include <lfrfid/tools/fsk_demod.h>
+#include <lfrfid/tools/lfrfid_demod.h>
 #include <lfrfid/tools/fsk_osc.h>
 #include "lfrfid_protocols.h"
 #include <bit_lib/bit_lib.h>
@@ -93,12 +94,12 @@ static void protocol_hid_ex_generic_decode(const uint8_t* from, uint8_t* to) {
     }
 }
 
-bool protocol_hid_ex_generic_decoder_feed(ProtocolHIDEx* protocol, bool level, uint32_t duration) {
-    bool value;
-    uint32_t count;
+static bool protocol_hid_ex_generic_decoder_feed_bits(
+    ProtocolHIDEx* protocol,
+    bool value,
+    uint32_t count) {
     bool result = false;
 
-    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
     if(count > 0) {
         for(size_t i = 0; i < count; i++) {
             bit_lib_push_bit(protocol->encoded_data, HID_ENCODED_DATA_SIZE, value);
@@ -112,6 +113,22 @@ bool protocol_hid_ex_generic_decoder_feed(ProtocolHIDEx* protocol, bool level, u
     return result;
 }
 
+bool protocol_hid_ex_generic_decoder_feed(ProtocolHIDEx* protocol, bool level, uint32_t duration) {
+    bool value = false;
+    uint32_t count;
+
+    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
+    return protocol_hid_ex_generic_decoder_feed_bits(protocol, value, count);
+}
+
+bool protocol_hid_ex_generic_decoder_feed_symbol(
+    ProtocolHIDEx* protocol,
+    const LFRFIDSymbol* symbol) {
+    bool value = false;
+    uint32_t count = lfrfid_symbol_get_fsk_bits(symbol, 6, 5, &value);
+    return protocol_hid_ex_generic_decoder_feed_bits(protocol, value, count);
+}
+
 static void protocol_hid_ex_generic_encode(ProtocolHIDEx* protocol) {
     protocol->encoded_data[0] = HID_PREAMBLE;
 
@@ -215,6 +232,7 @@ const ProtocolBase protocol_hid_ex_generic = {
         {
             .start = (ProtocolDecoderStart)protocol_hid_ex_generic_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_hid_ex_generic_decoder_feed,
+            .feed_symbol = (ProtocolDecoderFeedSymbol)protocol_hid_ex_generic_decoder_feed_symbol,
         },
     .encoder =
         {
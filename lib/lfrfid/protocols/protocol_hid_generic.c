@@ -1,6 +1,7 @@
 #include <furi.h>
 #include <toolbox/protocols/protocol.h>
 #include <lfrfid/tools/fsk_demod.h>
+#include <lfrfid/tools/lfrfid_demod.h>
 #include <lfrfid/tools/fsk_osc.h>
 #include "lfrfid_protocols.h"
 #include <bit_lib/bit_lib.h>
@@ -125,12 +126,10 @@ static uint8_t protocol_hid_generic_decode_protocol_size(ProtocolHID* protocol)
     return size < 26 ? HID_PROTOCOL_SIZE_UNKNOWN : size;
 }
 
-bool protocol_hid_generic_decoder_feed(ProtocolHID* protocol, bool level, uint32_t duration) {
-    bool value;
-    uint32_t count;
+static bool
+    protocol_hid_generic_decoder_feed_bits(ProtocolHID* protocol, bool value, uint32_t count) {
     bool result = false;
 
-    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
     if(count > 0) {
         for(size_t i = 0; i < count; i++) {
             bit_lib_push_bit(protocol->encoded_data, HID_ENCODED_DATA_SIZE, value);
@@ -144,6 +143,20 @@ bool protocol_hid_generic_decoder_feed(ProtocolHID* protocol, bool level, uint32
     return result;
 }
 
+bool protocol_hid_generic_decoder_feed(ProtocolHID* protocol, bool level, uint32_t duration) {
+    bool value = false;
+    uint32_t count;
+
+    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
+    return protocol_hid_generic_decoder_feed_bits(protocol, value, count);
+}
+
+bool protocol_hid_generic_decoder_feed_symbol(ProtocolHID* protocol, const LFRFIDSymbol* symbol) {
+    bool value = false;
+    uint32_t count = lfrfid_symbol_get_fsk_bits(symbol, 6, 5, &value);
+    return protocol_hid_generic_decoder_feed_bits(protocol, value, count);
+}
+
 static void protocol_hid_generic_encode(ProtocolHID* protocol) {
     protocol->encoded_data[0] = HID_PREAMBLE;
 
@@ -276,6 +289,7 @@ const ProtocolBase protocol_hid_generic = {
         {
             .start = (ProtocolDecoderStart)protocol_hid_generic_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_hid_generic_decoder_feed,
+            .feed_symbol = (ProtocolDecoderFeedSymbol)protocol_hid_generic_decoder_feed_symbol,
         },
     .encoder =
         {
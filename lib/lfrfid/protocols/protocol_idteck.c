@@ -1,6 +1,7 @@
 #include <furi.h>
 #include <toolbox/protocols/protocol.h>
 #include <bit_lib/bit_lib.h>
+#include <lfrfid/tools/lfrfid_demod.h>
 #include "lfrfid_protocols.h"
 
 // Example: 4944544B 351FBE4B
@@ -70,10 +71,8 @@ static bool protocol_idteck_can_be_decoded(uint8_t* data) {
     return true;
 }
 
-static bool protocol_idteck_decoder_feed_internal(bool polarity, uint32_t time, uint8_t* data) {
-    time += (IDTECK_US_PER_BIT / 2);
-
-    size_t bit_count = (time / IDTECK_US_PER_BIT);
+static bool
+    protocol_idteck_decoder_feed_internal(bool polarity, uint32_t bit_count, uint8_t* data) {
     bool result = false;
 
     if(bit_count < IDTECK_ENCODED_BIT_SIZE) {
@@ -93,19 +92,22 @@ static void protocol_idteck_decoder_save(uint8_t* data_to, const uint8_t* data_f
     bit_lib_copy_bits(data_to, 0, 64, data_from, 0);
 }
 
-bool protocol_idteck_decoder_feed(ProtocolIdteck* protocol, bool level, uint32_t duration) {
+static bool protocol_idteck_decoder_feed_bits(
+    ProtocolIdteck* protocol,
+    bool level,
+    uint32_t bits,
+    uint32_t shifted_bits) {
     bool result = false;
 
-    if(duration > (IDTECK_US_PER_BIT / 2)) {
-        if(protocol_idteck_decoder_feed_internal(level, duration, protocol->encoded_data)) {
+    if(bits) {
+        if(protocol_idteck_decoder_feed_internal(level, bits, protocol->encoded_data)) {
             protocol_idteck_decoder_save(protocol->data, protocol->encoded_data);
             FURI_LOG_D("Idteck", "Positive");
             result = true;
             return result;
         }
 
-        if(protocol_idteck_decoder_feed_internal(
-               !level, duration, protocol->negative_encoded_data)) {
+        if(protocol_idteck_decoder_feed_internal(!level, bits, protocol->negative_encoded_data)) {
             protocol_idteck_decoder_save(protocol->data, protocol->negative_encoded_data);
             FURI_LOG_D("Idteck", "Negative");
             result = true;
@@ -113,18 +115,10 @@ bool protocol_idteck_decoder_feed(ProtocolIdteck* protocol, bool level, uint32_t
         }
     }
 
-    if(duration > (IDTECK_US_PER_BIT / 4)) {
+    if(shifted_bits) {
         // Try to decode wrong phase synced data
-        if(level) {
-            duration += 120;
-        } else {
-            if(duration > 120) {
-                duration -= 120;
-            }
-        }
-
         if(protocol_idteck_decoder_feed_internal(
-               level, duration, protocol->corrupted_encoded_data)) {
+               level, shifted_bits, protocol->corrupted_encoded_data)) {
             protocol_idteck_decoder_save(protocol->data, protocol->corrupted_encoded_data);
             FURI_LOG_D("Idteck", "Positive Corrupted");
 
@@ -133,7 +127,7 @@ bool protocol_idteck_decoder_feed(ProtocolIdteck* protocol, bool level, uint32_t
         }
 
         if(protocol_idteck_decoder_feed_internal(
-               !level, duration, protocol->corrupted_negative_encoded_data)) {
+               !level, shifted_bits, protocol->corrupted_negative_encoded_data)) {
             protocol_idteck_decoder_save(
                 protocol->data, protocol->corrupted_negative_encoded_data);
             FURI_LOG_D("Idteck", "Negative Corrupted");
@@ -146,6 +140,19 @@ bool protocol_idteck_decoder_feed(ProtocolIdteck* protocol, bool level, uint32_t
     return result;
 }
 
+bool protocol_idteck_decoder_feed(ProtocolIdteck* protocol, bool level, uint32_t duration) {
+    return protocol_idteck_decoder_feed_bits(
+        protocol,
+        level,
+        lfrfid_demod_get_psk_bits(duration),
+        lfrfid_demod_get_psk_shifted_bits(level, duration));
+}
+
+bool protocol_idteck_decoder_feed_symbol(ProtocolIdteck* protocol, const LFRFIDSymbol* symbol) {
+    return protocol_idteck_decoder_feed_bits(
+        protocol, symbol->level, symbol->psk_bits, symbol->psk_shifted_bits);
+}
+
 bool protocol_idteck_encoder_start(ProtocolIdteck* protocol) {
     memset(protocol->encoded_data, 0, IDTECK_ENCODED_DATA_SIZE);
     *(uint32_t*)&protocol->encoded_data[0] = 0b01001011010101000100010001001001;
@@ -247,6 +254,7 @@ const ProtocolBase protocol_idteck = {
         {
             .start = (ProtocolDecoderStart)protocol_idteck_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_idteck_decoder_feed,
+            .feed_symbol = (ProtocolDecoderFeedSymbol)protocol_idteck_decoder_feed_symbol,
         },
     .encoder =
         {
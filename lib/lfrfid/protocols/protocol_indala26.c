@@ -1,6 +1,7 @@
 #include <furi.h>
 #include <toolbox/protocols/protocol.h>
 #include <bit_lib/bit_lib.h>
+#include <lfrfid/tools/lfrfid_demod.h>
 #include "lfrfid_protocols.h"
 
 #define INDALA26_PREAMBLE_BIT_SIZE  (33)
@@ -70,10 +71,8 @@ static bool protocol_indala26_can_be_decoded(uint8_t* data) {
     return true;
 }
 
-static bool protocol_indala26_decoder_feed_internal(bool polarity, uint32_t time, uint8_t* data) {
-    time += (INDALA26_US_PER_BIT / 2);
-
-    size_t bit_count = (time / INDALA26_US_PER_BIT);
+static bool
+    protocol_indala26_decoder_feed_internal(bool polarity, uint32_t bit_count, uint8_t* data) {
     bool result = false;
 
     if(bit_count < INDALA26_ENCODED_BIT_SIZE) {
@@ -95,11 +94,15 @@ static void protocol_indala26_decoder_save(uint8_t* data_to, const uint8_t* data
     bit_lib_copy_bits(data_to, 27, 2, data_from, 62);
 }
 
-bool protocol_indala26_decoder_feed(ProtocolIndala* protocol, bool level, uint32_t duration) {
+static bool protocol_indala26_decoder_feed_bits(
+    ProtocolIndala* protocol,
+    bool level,
+    uint32_t bits,
+    uint32_t shifted_bits) {
     bool result = false;
 
-    if(duration > (INDALA26_US_PER_BIT / 2)) {
-        if(protocol_indala26_decoder_feed_internal(level, duration, protocol->encoded_data)) {
+    if(bits) {
+        if(protocol_indala26_decoder_feed_internal(level, bits, protocol->encoded_data)) {
             protocol_indala26_decoder_save(protocol->data, protocol->encoded_data);
             FURI_LOG_D("Indala26", "Positive");
             result = true;
@@ -107,7 +110,7 @@ bool protocol_indala26_decoder_feed(ProtocolIndala* protocol, bool level, uint32
         }
 
         if(protocol_indala26_decoder_feed_internal(
-               !level, duration, protocol->negative_encoded_data)) {
+               !level, bits, protocol->negative_encoded_data)) {
             protocol_indala26_decoder_save(protocol->data, protocol->negative_encoded_data);
             FURI_LOG_D("Indala26", "Negative");
             result = true;
@@ -115,18 +118,10 @@ bool protocol_indala26_decoder_feed(ProtocolIndala* protocol, bool level, uint32
         }
     }
 
-    if(duration > (INDALA26_US_PER_BIT / 4)) {
+    if(shifted_bits) {
         // Try to decode wrong phase synced data
-        if(level) {
-            duration += 120;
-        } else {
-            if(duration > 120) {
-                duration -= 120;
-            }
-        }
-
         if(protocol_indala26_decoder_feed_internal(
-               level, duration, protocol->corrupted_encoded_data)) {
+               level, shifted_bits, protocol->corrupted_encoded_data)) {
             protocol_indala26_decoder_save(protocol->data, protocol->corrupted_encoded_data);
             FURI_LOG_D("Indala26", "Positive Corrupted");
 
@@ -135,7 +130,7 @@ bool protocol_indala26_decoder_feed(ProtocolIndala* protocol, bool level, uint32
         }
 
         if(protocol_indala26_decoder_feed_internal(
-               !level, duration, protocol->corrupted_negative_encoded_data)) {
+               !level, shifted_bits, protocol->corrupted_negative_encoded_data)) {
             protocol_indala26_decoder_save(
                 protocol->data, protocol->corrupted_negative_encoded_data);
             FURI_LOG_D("Indala26", "Negative Corrupted");
@@ -148,6 +143,19 @@ bool protocol_indala26_decoder_feed(ProtocolIndala* protocol, bool level, uint32
     return result;
 }
 
+bool protocol_indala26_decoder_feed(ProtocolIndala* protocol, bool level, uint32_t duration) {
+    return protocol_indala26_decoder_feed_bits(
+        protocol,
+        level,
+        lfrfid_demod_get_psk_bits(duration),
+        lfrfid_demod_get_psk_shifted_bits(level, duration));
+}
+
+bool protocol_indala26_decoder_feed_symbol(ProtocolIndala* protocol, const LFRFIDSymbol* symbol) {
+    return protocol_indala26_decoder_feed_bits(
+        protocol, symbol->level, symbol->psk_bits, symbol->psk_shifted_bits);
+}
+
 bool protocol_indala26_encoder_start(ProtocolIndala* protocol) {
     memset(protocol->encoded_data, 0, INDALA26_ENCODED_DATA_SIZE);
     *(uint32_t*)&protocol->encoded_data[0] = 0b00000000000000000000000010100000;
@@ -343,6 +351,7 @@ const ProtocolBase protocol_indala26 = {
         {
             .start = (ProtocolDecoderStart)protocol_indala26_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_indala26_decoder_feed,
+            .feed_symbol = (ProtocolDecoderFeedSymbol)protocol_indala26_decoder_feed_symbol,
         },
     .encoder =
         {
@@ -1,6 +1,7 @@
 #include <furi.h>
 #include <toolbox/protocols/protocol.h>
 #include <lfrfid/tools/fsk_demod.h>
+#include <lfrfid/tools/lfrfid_demod.h>
 #include <lfrfid/tools/fsk_osc.h>
 #include <bit_lib/bit_lib.h>
 #include "lfrfid_protocols.h"
@@ -155,13 +156,12 @@ void protocol_io_prox_xsf_decode(const uint8_t* encoded_data, uint8_t* decoded_d
     decoded_data[3] = bit_lib_get_bits(encoded_data, 45, 8);
 }
 
-bool protocol_io_prox_xsf_decoder_feed(ProtocolIOProxXSF* protocol, bool level, uint32_t duration) {
+static bool protocol_io_prox_xsf_decoder_feed_bits(
+    ProtocolIOProxXSF* protocol,
+    bool value,
+    uint32_t count) {
     bool result = false;
 
-    uint32_t count;
-    bool value;
-
-    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
     for(size_t i = 0; i < count; i++) {
         bit_lib_push_bit(protocol->encoded_data, IOPROXXSF_ENCODED_DATA_SIZE, value);
         if(protocol_io_prox_xsf_can_be_decoded(protocol->encoded_data)) {
@@ -174,6 +174,22 @@ bool protocol_io_prox_xsf_decoder_feed(ProtocolIOProxXSF* protocol, bool level,
     return result;
 }
 
+bool protocol_io_prox_xsf_decoder_feed(ProtocolIOProxXSF* protocol, bool level, uint32_t duration) {
+    bool value = false;
+    uint32_t count;
+
+    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
+    return protocol_io_prox_xsf_decoder_feed_bits(protocol, value, count);
+}
+
+bool protocol_io_prox_xsf_decoder_feed_symbol(
+    ProtocolIOProxXSF* protocol,
+    const LFRFIDSymbol* symbol) {
+    bool value = false;
+    uint32_t count = lfrfid_symbol_get_fsk_bits(symbol, 8, 6, &value);
+    return protocol_io_prox_xsf_decoder_feed_bits(protocol, value, count);
+}
+
 static void protocol_io_prox_xsf_encode(const uint8_t* decoded_data, uint8_t* encoded_data) {
     // Packet to transmit:
     //
@@ -289,6 +305,7 @@ const ProtocolBase protocol_io_prox_xsf = {
         {
             .start = (ProtocolDecoderStart)protocol_io_prox_xsf_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_io_prox_xsf_decoder_feed,
+            .feed_symbol = (ProtocolDecoderFeedSymbol)protocol_io_prox_xsf_decoder_feed_symbol,
         },
     .encoder =
         {
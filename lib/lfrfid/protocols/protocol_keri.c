@@ -1,6 +1,7 @@
 #include <furi.h>
 #include <toolbox/protocols/protocol.h>
 #include <bit_lib/bit_lib.h>
+#include <lfrfid/tools/lfrfid_demod.h>
 #include "lfrfid_protocols.h"
 
 #define KERI_PREAMBLE_BIT_SIZE  (33)
@@ -69,10 +70,7 @@ static bool protocol_keri_can_be_decoded(uint8_t* data) {
     return true;
 }
 
-static bool protocol_keri_decoder_feed_internal(bool polarity, uint32_t time, uint8_t* data) {
-    time += (KERI_US_PER_BIT / 2);
-
-    size_t bit_count = (time / KERI_US_PER_BIT);
+static bool protocol_keri_decoder_feed_internal(bool polarity, uint32_t bit_count, uint8_t* data) {
     bool result = false;
 
     if(bit_count < KERI_ENCODED_BIT_SIZE) {
@@ -120,34 +118,31 @@ static void protocol_keri_decoder_save(uint8_t* data_to, const uint8_t* data_fro
     data_to[0] = (uint8_t)(id >>= 8);
 }
 
-bool protocol_keri_decoder_feed(ProtocolKeri* protocol, bool level, uint32_t duration) {
+static bool protocol_keri_decoder_feed_bits(
+    ProtocolKeri* protocol,
+    bool level,
+    uint32_t bits,
+    uint32_t shifted_bits) {
     bool result = false;
 
-    if(duration > (KERI_US_PER_BIT / 2)) {
-        if(protocol_keri_decoder_feed_internal(level, duration, protocol->encoded_data)) {
+    if(bits) {
+        if(protocol_keri_decoder_feed_internal(level, bits, protocol->encoded_data)) {
             protocol_keri_decoder_save(protocol->data, protocol->encoded_data);
             result = true;
             return result;
         }
 
-        if(protocol_keri_decoder_feed_internal(!level, duration, protocol->negative_encoded_data)) {
+        if(protocol_keri_decoder_feed_internal(!level, bits, protocol->negative_encoded_data)) {
             protocol_keri_decoder_save(protocol->data, protocol->negative_encoded_data);
             result = true;
             return result;
         }
     }
 
-    if(duration > (KERI_US_PER_BIT / 4)) {
+    if(shifted_bits) {
         // Try to decode wrong phase synced data
-        if(level) {
-            duration += 120;
-        } else {
-            if(duration > 120) {
-                duration -= 120;
-            }
-        }
-
-        if(protocol_keri_decoder_feed_internal(level, duration, protocol->corrupted_encoded_data)) {
+        if(protocol_keri_decoder_feed_internal(
+               level, shifted_bits, protocol->corrupted_encoded_data)) {
             protocol_keri_decoder_save(protocol->data, protocol->corrupted_encoded_data);
 
             result = true;
@@ -155,7 +150,7 @@ bool protocol_keri_decoder_feed(ProtocolKeri* protocol, bool level, uint32_t dur
         }
 
         if(protocol_keri_decoder_feed_internal(
-               !level, duration, protocol->corrupted_negative_encoded_data)) {
+               !level, shifted_bits, protocol->corrupted_negative_encoded_data)) {
             protocol_keri_decoder_save(protocol->data, protocol->corrupted_negative_encoded_data);
 
             result = true;
@@ -166,6 +161,19 @@ bool protocol_keri_decoder_feed(ProtocolKeri* protocol, bool level, uint32_t dur
     return result;
 }
 
+bool protocol_keri_decoder_feed(ProtocolKeri* protocol, bool level, uint32_t duration) {
+    return protocol_keri_decoder_feed_bits(
+        protocol,
+        level,
+        lfrfid_demod_get_psk_bits(duration),
+        lfrfid_demod_get_psk_shifted_bits(level, duration));
+}
+
+bool protocol_keri_decoder_feed_symbol(ProtocolKeri* protocol, const LFRFIDSymbol* symbol) {
+    return protocol_keri_decoder_feed_bits(
+        protocol, symbol->level, symbol->psk_bits, symbol->psk_shifted_bits);
+}
+
 bool protocol_keri_encoder_start(ProtocolKeri* protocol) {
     memset(protocol->encoded_data, 0, KERI_ENCODED_DATA_SIZE);
     *(uint32_t*)&protocol->encoded_data[0] = 0b00000000000000000000000011100000;
@@ -282,6 +290,7 @@ const ProtocolBase protocol_keri = {
         {
             .start = (ProtocolDecoderStart)protocol_keri_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_keri_decoder_feed,
+            .feed_symbol = (ProtocolDecoderFeedSymbol)protocol_keri_decoder_feed_symbol,
         },
     .encoder =
         {
@@ -1,6 +1,7 @@
 #include <furi.h>
 #include <toolbox/protocols/protocol.h>
 #include <bit_lib/bit_lib.h>
+#include <lfrfid/tools/lfrfid_demod.h>
 #include "lfrfid_protocols.h"
 
 #define NEXWATCH_PREAMBLE_BIT_SIZE  (8)
@@ -124,10 +125,8 @@ static bool protocol_nexwatch_can_be_decoded(uint8_t* data) {
     return true;
 }
 
-static bool protocol_nexwatch_decoder_feed_internal(bool polarity, uint32_t time, uint8_t* data) {
-    time += (NEXWATCH_US_PER_BIT / 2);
-
-    size_t bit_count = (time / NEXWATCH_US_PER_BIT);
+static bool
+    protocol_nexwatch_decoder_feed_internal(bool polarity, uint32_t bit_count, uint8_t* data) {
     bool result = false;
 
     if(bit_count < NEXWATCH_ENCODED_BIT_SIZE) {
@@ -168,36 +167,32 @@ static void protocol_nexwatch_decoder_save(uint8_t* data_to, const uint8_t* data
     data_to[5] = (uint8_t)(check >>= 8);
 }
 
-bool protocol_nexwatch_decoder_feed(ProtocolNexwatch* protocol, bool level, uint32_t duration) {
+static bool protocol_nexwatch_decoder_feed_bits(
+    ProtocolNexwatch* protocol,
+    bool level,
+    uint32_t bits,
+    uint32_t shifted_bits) {
     bool result = false;
 
-    if(duration > (NEXWATCH_US_PER_BIT / 2)) {
-        if(protocol_nexwatch_decoder_feed_internal(level, duration, protocol->encoded_data)) {
+    if(bits) {
+        if(protocol_nexwatch_decoder_feed_internal(level, bits, protocol->encoded_data)) {
             protocol_nexwatch_decoder_save(protocol->data, protocol->encoded_data);
             result = true;
             return result;
         }
 
         if(protocol_nexwatch_decoder_feed_internal(
-               !level, duration, protocol->negative_encoded_data)) {
+               !level, bits, protocol->negative_encoded_data)) {
             protocol_nexwatch_decoder_save(protocol->data, protocol->negative_encoded_data);
             result = true;
             return result;
         }
     }
 
-    if(duration > (NEXWATCH_US_PER_BIT / 4)) {
+    if(shifted_bits) {
         // Try to decode wrong phase synced data
-        if(level) {
-            duration += 120;
-        } else {
-            if(duration > 120) {
-                duration -= 120;
-            }
-        }
-
         if(protocol_nexwatch_decoder_feed_internal(
-               level, duration, protocol->corrupted_encoded_data)) {
+               level, shifted_bits, protocol->corrupted_encoded_data)) {
             protocol_nexwatch_decoder_save(protocol->data, protocol->corrupted_encoded_data);
 
             result = true;
@@ -205,7 +200,7 @@ bool protocol_nexwatch_decoder_feed(ProtocolNexwatch* protocol, bool level, uint
         }
 
         if(protocol_nexwatch_decoder_feed_internal(
-               !level, duration, protocol->corrupted_negative_encoded_data)) {
+               !level, shifted_bits, protocol->corrupted_negative_encoded_data)) {
             protocol_nexwatch_decoder_save(
                 protocol->data, protocol->corrupted_negative_encoded_data);
 
@@ -217,6 +212,21 @@ bool protocol_nexwatch_decoder_feed(ProtocolNexwatch* protocol, bool level, uint
     return result;
 }
 
+bool protocol_nexwatch_decoder_feed(ProtocolNexwatch* protocol, bool level, uint32_t duration) {
+    return protocol_nexwatch_decoder_feed_bits(
+        protocol,
+        level,
+        lfrfid_demod_get_psk_bits(duration),
+        lfrfid_demod_get_psk_shifted_bits(level, duration));
+}
+
+bool protocol_nexwatch_decoder_feed_symbol(
+    ProtocolNexwatch* protocol,
+    const LFRFIDSymbol* symbol) {
+    return protocol_nexwatch_decoder_feed_bits(
+        protocol, symbol->level, symbol->psk_bits, symbol->psk_shifted_bits);
+}
+
 bool protocol_nexwatch_encoder_start(ProtocolNexwatch* protocol) {
     memset(protocol->encoded_data, 0, NEXWATCH_ENCODED_DATA_SIZE);
     *(uint32_t*)&protocol->encoded_data[0] = 0b00000000000000000000000001010110;
@@ -343,6 +353,7 @@ const ProtocolBase protocol_nexwatch = {
         {
             .start = (ProtocolDecoderStart)protocol_nexwatch_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_nexwatch_decoder_feed,
+            .feed_symbol = (ProtocolDecoderFeedSymbol)protocol_nexwatch_decoder_feed_symbol,
         },
     .encoder =
         {
@@ -1,6 +1,7 @@
 #include <furi.h>
 #include <toolbox/protocols/protocol.h>
 #include <lfrfid/tools/fsk_demod.h>
+#include <lfrfid/tools/lfrfid_demod.h>
 #include <lfrfid/tools/fsk_osc.h>
 #include <bit_lib/bit_lib.h>
 #include "lfrfid_protocols.h"
@@ -84,11 +85,8 @@ static void protocol_paradox_decode(uint8_t* encoded_data, uint8_t* decoded_data
     bit_lib_push_bit(decoded_data, PARADOX_DECODED_DATA_SIZE, 0);
 }
 
-bool protocol_paradox_decoder_feed(ProtocolParadox* protocol, bool level, uint32_t duration) {
-    bool value;
-    uint32_t count;
-
-    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
+static bool
+    protocol_paradox_decoder_feed_bits(ProtocolParadox* protocol, bool value, uint32_t count) {
     if(count > 0) {
         for(size_t i = 0; i < count; i++) {
             bit_lib_push_bit(protocol->encoded_data, PARADOX_ENCODED_DATA_SIZE, value);
@@ -103,6 +101,20 @@ bool protocol_paradox_decoder_feed(ProtocolParadox* protocol, bool level, uint32
     return false;
 }
 
+bool protocol_paradox_decoder_feed(ProtocolParadox* protocol, bool level, uint32_t duration) {
+    bool value = false;
+    uint32_t count;
+
+    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
+    return protocol_paradox_decoder_feed_bits(protocol, value, count);
+}
+
+bool protocol_paradox_decoder_feed_symbol(ProtocolParadox* protocol, const LFRFIDSymbol* symbol) {
+    bool value = false;
+    uint32_t count = lfrfid_symbol_get_fsk_bits(symbol, 6, 5, &value);
+    return protocol_paradox_decoder_feed_bits(protocol, value, count);
+}
+
 static void protocol_paradox_encode(const uint8_t* decoded_data, uint8_t* encoded_data) {
     // preamble
     bit_lib_set_bits(encoded_data, 0, 0b00001111, 8);
@@ -237,6 +249,7 @@ const ProtocolBase protocol_paradox = {
         {
             .start = (ProtocolDecoderStart)protocol_paradox_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_paradox_decoder_feed,
+            .feed_symbol = (ProtocolDecoderFeedSymbol)protocol_paradox_decoder_feed_symbol,
         },
     .encoder =
         {
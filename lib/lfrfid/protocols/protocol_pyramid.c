@@ -1,6 +1,7 @@
 #include <furi.h>
 #include <toolbox/protocols/protocol.h>
 #include <lfrfid/tools/fsk_demod.h>
+#include <lfrfid/tools/lfrfid_demod.h>
 #include <lfrfid/tools/fsk_osc.h>
 #include "lfrfid_protocols.h"
 #include <bit_lib/bit_lib.h>
@@ -105,12 +106,10 @@ static void protocol_pyramid_decode(ProtocolPyramid* protocol) {
     bit_lib_copy_bits(protocol->data, 16, 16, protocol->encoded_data, 81 + 8);
 }
 
-bool protocol_pyramid_decoder_feed(ProtocolPyramid* protocol, bool level, uint32_t duration) {
-    bool value;
-    uint32_t count;
+static bool
+    protocol_pyramid_decoder_feed_bits(ProtocolPyramid* protocol, bool value, uint32_t count) {
     bool result = false;
 
-    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
     if(count > 0) {
         for(size_t i = 0; i < count; i++) {
             bit_lib_push_bit(protocol->encoded_data, PYRAMID_ENCODED_DATA_SIZE, value);
@@ -124,6 +123,20 @@ bool protocol_pyramid_decoder_feed(ProtocolPyramid* protocol, bool level, uint32
     return result;
 }
 
+bool protocol_pyramid_decoder_feed(ProtocolPyramid* protocol, bool level, uint32_t duration) {
+    bool value = false;
+    uint32_t count;
+
+    fsk_demod_feed(protocol->decoder.fsk_demod, level, duration, &value, &count);
+    return protocol_pyramid_decoder_feed_bits(protocol, value, count);
+}
+
+bool protocol_pyramid_decoder_feed_symbol(ProtocolPyramid* protocol, const LFRFIDSymbol* symbol) {
+    bool value = false;
+    uint32_t count = lfrfid_symbol_get_fsk_bits(symbol, 6, 5, &value);
+    return protocol_pyramid_decoder_feed_bits(protocol, value, count);
+}
+
 bool protocol_pyramid_get_parity(const uint8_t* bits, uint8_t type, int length) {
     int x;
     for(x = 0; length > 0; --length)
@@ -271,6 +284,7 @@ const ProtocolBase protocol_pyramid = {
         {
             .start = (ProtocolDecoderStart)protocol_pyramid_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_pyramid_decoder_feed,
+            .feed_symbol = (ProtocolDecoderFeedSymbol)protocol_pyramid_decoder_feed_symbol,
         },
     .encoder =
         {
@@ -2,6 +2,7 @@
 #include <toolbox/protocols/protocol.h>
 #include <toolbox/manchester_decoder.h>
 #include <bit_lib/bit_lib.h>
+#include <lfrfid/tools/lfrfid_demod.h>
 #include "lfrfid_protocols.h"
 
 #define VIKING_CLOCK_PER_BIT (32)
@@ -82,9 +83,28 @@ void protocol_viking_decoder_start(ProtocolViking* protocol) {
         NULL);
 }
 
-bool protocol_viking_decoder_feed(ProtocolViking* protocol, bool level, uint32_t duration) {
+static bool protocol_viking_decoder_feed_event(ProtocolViking* protocol, ManchesterEvent event) {
     bool result = false;
 
+    if(event != ManchesterEventReset) {
+        bool data;
+        bool data_ok = manchester_advance(
+            protocol->decoder_manchester_state, event, &protocol->decoder_manchester_state, &data);
+
+        if(data_ok) {
+            bit_lib_push_bit(protocol->encoded_data, VIKING_ENCODED_BYTE_FULL_SIZE, data);
+
+            if(protocol_viking_can_be_decoded(protocol)) {
+                protocol_viking_decode(protocol);
+                result = true;
+            }
+        }
+    }
+
+    return result;
+}
+
+bool protocol_viking_decoder_feed(ProtocolViking* protocol, bool level, uint32_t duration) {
     ManchesterEvent event = ManchesterEventReset;
 
     if(duration > VIKING_READ_SHORT_TIME_LOW && duration < VIKING_READ_SHORT_TIME_HIGH) {
@@ -101,22 +121,11 @@ bool protocol_viking_decoder_feed(ProtocolViking* protocol, bool level, uint32_t
         }
     }
 
-    if(event != ManchesterEventReset) {
-        bool data;
-        bool data_ok = manchester_advance(
-            protocol->decoder_manchester_state, event, &protocol->decoder_manchester_state, &data);
-
-        if(data_ok) {
-            bit_lib_push_bit(protocol->encoded_data, VIKING_ENCODED_BYTE_FULL_SIZE, data);
-
-            if(protocol_viking_can_be_decoded(protocol)) {
-                protocol_viking_decode(protocol);
-                result = true;
-            }
-        }
-    }
+    return protocol_viking_decoder_feed_event(protocol, event);
+}
 
-    return result;
+bool protocol_viking_decoder_feed_symbol(ProtocolViking* protocol, const LFRFIDSymbol* symbol) {
+    return protocol_viking_decoder_feed_event(protocol, symbol->ask[LFRFIDAskClassRF32Wide]);
 }
 
 bool protocol_viking_encoder_start(ProtocolViking* protocol) {
@@ -192,6 +201,7 @@ const ProtocolBase protocol_viking = {
         {
             .start = (ProtocolDecoderStart)protocol_viking_decoder_start,
             .feed = (ProtocolDecoderFeed)protocol_viking_decoder_feed,
+            .feed_symbol = (ProtocolDecoderFeedSymbol)protocol_viking_decoder_feed_symbol,
         },
     .encoder =
         {
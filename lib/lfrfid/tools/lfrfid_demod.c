@@ -0,0 +1,138 @@
+#include <furi.h>
+#include "lfrfid_demod.h"
+
+#define FSK_JITTER_TIME (20)
+#define FSK_MIN_TIME    (64 - FSK_JITTER_TIME)
+#define FSK_MAX_TIME    (80 + FSK_JITTER_TIME)
+#define FSK_MID_TIME    ((FSK_MAX_TIME - FSK_MIN_TIME) / 2 + FSK_MIN_TIME)
+
+#define PSK_US_PER_BIT     (255)
+#define PSK_SHIFT_TIME     (120)
+#define PSK_MIN_TIME       (PSK_US_PER_BIT / 2)
+#define PSK_MIN_SHIFT_TIME (PSK_US_PER_BIT / 4)
+
+typedef struct {
+    uint16_t short_time;
+    uint16_t long_time;
+    uint16_t jitter_time;
+} LFRFIDAskTiming;
+
+static const LFRFIDAskTiming lfrfid_ask_timings[LFRFIDAskClassMax] = {
+    [LFRFIDAskClassRF64] = {.short_time = 256, .long_time = 512, .jitter_time = 100},
+    [LFRFIDAskClassRF32] = {.short_time = 128, .long_time = 256, .jitter_time = 50},
+    [LFRFIDAskClassRF16] = {.short_time = 64, .long_time = 128, .jitter_time = 25},
+    [LFRFIDAskClassRF32Wide] = {.short_time = 128, .long_time = 256, .jitter_time = 60},
+};
+
+struct LFRFIDDemod {
+    LFRFIDSymbol symbol;
+
+    uint32_t fsk_time;
+    uint32_t fsk_count;
+    bool fsk_last_pulse;
+};
+
+LFRFIDDemod* lfrfid_demod_alloc(void) {
+    LFRFIDDemod* demod = malloc(sizeof(LFRFIDDemod));
+    demod->fsk_time = 0;
+    demod->fsk_count = 0;
+    demod->fsk_last_pulse = false;
+    return demod;
+}
+
+void lfrfid_demod_free(LFRFIDDemod* demod) {
+    free(demod);
+}
+
+ManchesterEvent
+    lfrfid_demod_get_ask_event(LFRFIDAskClass ask_class, bool level, uint32_t duration) {
+    furi_check(ask_class < LFRFIDAskClassMax);
+    const LFRFIDAskTiming* timing = &lfrfid_ask_timings[ask_class];
+
+    ManchesterEvent event = ManchesterEventReset;
+
+    if(duration > (uint32_t)(timing->short_time - timing->jitter_time) &&
+       duration < (uint32_t)(timing->short_time + timing->jitter_time)) {
+        event = level ? ManchesterEventShortLow : ManchesterEventShortHigh;
+    } else if(
+        duration > (uint32_t)(timing->long_time - timing->jitter_time) &&
+        duration < (uint32_t)(timing->long_time + timing->jitter_time)) {
+        event = level ? ManchesterEventLongLow : ManchesterEventLongHigh;
+    }
+
+    return event;
+}
+
+uint32_t lfrfid_demod_get_psk_bits(uint32_t duration) {
+    if(duration <= PSK_MIN_TIME) return 0;
+    return (duration + PSK_US_PER_BIT / 2) / PSK_US_PER_BIT;
+}
+
+uint32_t lfrfid_demod_get_psk_shifted_bits(bool level, uint32_t duration) {
+    if(duration <= PSK_MIN_SHIFT_TIME) return 0;
+
+    if(level) {
+        duration += PSK_SHIFT_TIME;
+    } else if(duration > PSK_SHIFT_TIME) {
+        duration -= PSK_SHIFT_TIME;
+    }
+
+    return (duration + PSK_US_PER_BIT / 2) / PSK_US_PER_BIT;
+}
+
+static void lfrfid_demod_feed_fsk(LFRFIDDemod* demod, bool level, uint32_t duration) {
+    LFRFIDSymbol* symbol = &demod->symbol;
+    symbol->fsk_count = 0;
+
+    if(level) {
+        demod->fsk_time = duration;
+        return;
+    }
+
+    demod->fsk_time += duration;
+
+    // same state machine as fsk_demod, shared by all FSK protocols
+    if(demod->fsk_time >= FSK_MIN_TIME && demod->fsk_time < FSK_MAX_TIME) {
+        bool pulse = demod->fsk_time >= FSK_MID_TIME;
+        demod->fsk_count++;
+
+        if(demod->fsk_last_pulse != pulse) {
+            symbol->fsk_hi = demod->fsk_last_pulse;
+            symbol->fsk_count = demod->fsk_count + 1;
+            demod->fsk_count = 0;
+            demod->fsk_last_pulse = pulse;
+        }
+    } else {
+        demod->fsk_count = 0;
+    }
+}
+
+const LFRFIDSymbol* lfrfid_demod_feed(LFRFIDDemod* demod, bool level, uint32_t duration) {
+    furi_check(demod);
+    LFRFIDSymbol* symbol = &demod->symbol;
+
+    symbol->level = level;
+    symbol->duration = duration;
+
+    for(size_t i = 0; i < LFRFIDAskClassMax; i++) {
+        symbol->ask[i] = lfrfid_demod_get_ask_event(i, level, duration);
+    }
+
+    lfrfid_demod_feed_fsk(demod, level, duration);
+
+    symbol->psk_bits = lfrfid_demod_get_psk_bits(duration);
+    symbol->psk_shifted_bits = lfrfid_demod_get_psk_shifted_bits(level, duration);
+
+    return symbol;
+}
+
+uint32_t lfrfid_symbol_get_fsk_bits(
+    const LFRFIDSymbol* symbol,
+    uint32_t low_pulses,
+    uint32_t hi_pulses,
+    bool* value) {
+    if(!symbol->fsk_count) return 0;
+
+    *value = symbol->fsk_hi;
+    return symbol->fsk_count / (symbol->fsk_hi ? hi_pulses : low_pulses);
+}
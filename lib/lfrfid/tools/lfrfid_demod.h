@@ -0,0 +1,112 @@
+/**
+ * @file lfrfid_demod.h
+ * LF RFID demodulator front end
+ *
+ * Classifies every captured edge once, for all protocols at the same time:
+ * ASK half or full bit for common bit rates, FSK carrier runs and PSK phase length.
+ * Protocols that implement decoder feed_symbol read classified LFRFIDSymbol
+ * instead of deriving bit timings from raw durations themselves.
+ */
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include <toolbox/manchester_decoder.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** ASK timing classes, shared by protocols with identical thresholds */
+typedef enum {
+    LFRFIDAskClassRF64, /**< RF/64, 256/512us +-100us */
+    LFRFIDAskClassRF32, /**< RF/32, 128/256us +-50us */
+    LFRFIDAskClassRF16, /**< RF/16, 64/128us +-25us */
+    LFRFIDAskClassRF32Wide, /**< RF/32, 128/256us +-60us */
+    LFRFIDAskClassMax,
+} LFRFIDAskClass;
+
+/** Classified edge */
+typedef struct {
+    bool level;
+    uint32_t duration;
+    ManchesterEvent ask[LFRFIDAskClassMax]; /**< ManchesterEventReset if out of range */
+    bool fsk_hi; /**< Finished FSK run consists of long carrier periods */
+    uint32_t fsk_count; /**< Carrier periods in finished FSK run, 0 if run continues */
+    uint32_t psk_bits; /**< Phase length in PSK bits, 0 if too short */
+    uint32_t psk_shifted_bits; /**< Phase length in PSK bits for wrong phase synced data */
+} LFRFIDSymbol;
+
+typedef struct LFRFIDDemod LFRFIDDemod;
+
+/**
+ * @brief Allocate a new LFRFIDDemod instance
+ *
+ * @return LFRFIDDemod*
+ */
+LFRFIDDemod* lfrfid_demod_alloc(void);
+
+/**
+ * @brief Free a LFRFIDDemod instance
+ *
+ * @param demod
+ */
+void lfrfid_demod_free(LFRFIDDemod* demod);
+
+/**
+ * @brief Classify edge
+ * Must be called for every edge that is fed to decoders, FSK run state depends on it
+ *
+ * @param demod LFRFIDDemod instance
+ * @param level edge level
+ * @param duration edge duration in us
+ * @return const LFRFIDSymbol* classified edge, valid until next call
+ */
+const LFRFIDSymbol* lfrfid_demod_feed(LFRFIDDemod* demod, bool level, uint32_t duration);
+
+/**
+ * @brief Get bits from finished FSK run
+ * Same as fsk_demod_feed with MIN_TIME..MAX_TIME period range
+ *
+ * @param symbol classified edge
+ * @param low_pulses carrier periods per bit for short periods
+ * @param hi_pulses carrier periods per bit for long periods
+ * @param value bit value
+ * @return uint32_t bit count
+ */
+uint32_t lfrfid_symbol_get_fsk_bits(
+    const LFRFIDSymbol* symbol,
+    uint32_t low_pulses,
+    uint32_t hi_pulses,
+    bool* value);
+
+/**
+ * @brief Classify ASK edge
+ *
+ * @param ask_class timing class
+ * @param level edge level
+ * @param duration edge duration in us
+ * @return ManchesterEvent
+ */
+ManchesterEvent
+    lfrfid_demod_get_ask_event(LFRFIDAskClass ask_class, bool level, uint32_t duration);
+
+/**
+ * @brief Get PSK phase length in bits
+ *
+ * @param duration edge duration in us
+ * @return uint32_t bit count, 0 if phase is too short
+ */
+uint32_t lfrfid_demod_get_psk_bits(uint32_t duration);
+
+/**
+ * @brief Get PSK phase length in bits, corrected for wrong phase sync
+ *
+ * @param level edge level
+ * @param duration edge duration in us
+ * @return uint32_t bit count, 0 if phase is too short
+ */
+uint32_t lfrfid_demod_get_psk_shifted_bits(bool level, uint32_t duration);
+
+#ifdef __cplusplus
+}
+#endif
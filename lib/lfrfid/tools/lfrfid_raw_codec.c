@@ -0,0 +1,191 @@
+#include "lfrfid_raw_codec.h"
+#include <string.h>
+
+#define RICE_K_MAX       (15)
+#define RICE_ESCAPE      (24)
+#define RICE_ESCAPE_BITS (RICE_ESCAPE + 32)
+
+typedef struct {
+    uint8_t* data;
+    size_t bit_index;
+} LFRFIDRawBitWriter;
+
+static inline uint32_t lfrfid_raw_codec_zigzag(uint32_t value, uint32_t last) {
+    int32_t delta = (int32_t)(value - last);
+    return ((uint32_t)delta << 1) ^ (uint32_t)(delta >> 31);
+}
+
+static inline uint32_t lfrfid_raw_codec_unzigzag(uint32_t value, uint32_t last) {
+    return last + ((value >> 1) ^ -(value & 1));
+}
+
+static inline uint32_t lfrfid_raw_codec_rice_cost(uint32_t value, uint8_t k) {
+    uint32_t quotient = value >> k;
+    return quotient < RICE_ESCAPE ? quotient + 1 + k : RICE_ESCAPE_BITS;
+}
+
+static uint8_t lfrfid_raw_codec_best_k(const uint32_t* costs) {
+    uint8_t best_k = 0;
+    for(uint8_t k = 1; k <= RICE_K_MAX; k++) {
+        if(costs[k] < costs[best_k]) best_k = k;
+    }
+    return best_k;
+}
+
+// Writes up to 56 bits, LSB first
+static void lfrfid_raw_codec_put(LFRFIDRawBitWriter* writer, uint64_t bits, size_t count) {
+    size_t byte = writer->bit_index / 8;
+    size_t shift = writer->bit_index % 8;
+    size_t bytes = (shift + count + 7) / 8;
+
+    bits <<= shift;
+    writer->data[byte] = (writer->data[byte] & ((1U << shift) - 1)) | (bits & 0xFF);
+    for(size_t i = 1; i < bytes; i++) {
+        writer->data[byte + i] = (bits >> (i * 8)) & 0xFF;
+    }
+
+    writer->bit_index += count;
+}
+
+static void lfrfid_raw_codec_put_rice(LFRFIDRawBitWriter* writer, uint32_t value, uint8_t k) {
+    uint32_t quotient = value >> k;
+
+    if(quotient < RICE_ESCAPE) {
+        uint64_t unary = (1ULL << quotient) - 1;
+        uint64_t remainder = value & ((1ULL << k) - 1);
+        lfrfid_raw_codec_put(writer, unary | (remainder << (quotient + 1)), quotient + 1 + k);
+    } else {
+        uint64_t unary = (1ULL << RICE_ESCAPE) - 1;
+        lfrfid_raw_codec_put(writer, unary | ((uint64_t)value << RICE_ESCAPE), RICE_ESCAPE_BITS);
+    }
+}
+
+size_t lfrfid_raw_codec_encode(const LFRFIDRawPair* pairs, size_t count, uint8_t* output) {
+    if(count > LFRFID_RAW_CODEC_BLOCK_PAIRS) return 0;
+
+    // first pass: encoded size for every Rice parameter
+    uint32_t pulse_costs[RICE_K_MAX + 1] = {0};
+    uint32_t duration_costs[RICE_K_MAX + 1] = {0};
+
+    LFRFIDRawPair last = {0, 0};
+    for(size_t i = 0; i < count; i++) {
+        uint32_t pulse_delta = lfrfid_raw_codec_zigzag(pairs[i].pulse, last.pulse);
+        uint32_t duration_delta = lfrfid_raw_codec_zigzag(pairs[i].duration, last.duration);
+        for(uint8_t k = 0; k <= RICE_K_MAX; k++) {
+            pulse_costs[k] += lfrfid_raw_codec_rice_cost(pulse_delta, k);
+            duration_costs[k] += lfrfid_raw_codec_rice_cost(duration_delta, k);
+        }
+        last = pairs[i];
+    }
+
+    uint8_t pulse_k = lfrfid_raw_codec_best_k(pulse_costs);
+    uint8_t duration_k = lfrfid_raw_codec_best_k(duration_costs);
+
+    output[0] = count & 0xFF;
+    output[1] = count >> 8;
+    output[2] = pulse_k;
+    output[3] = duration_k;
+
+    LFRFIDRawBitWriter writer = {
+        .data = output + LFRFID_RAW_CODEC_HEADER_SIZE,
+        .bit_index = 0,
+    };
+
+    // second pass: delta coded pairs
+    last.pulse = 0;
+    last.duration = 0;
+    for(size_t i = 0; i < count; i++) {
+        lfrfid_raw_codec_put_rice(
+            &writer, lfrfid_raw_codec_zigzag(pairs[i].pulse, last.pulse), pulse_k);
+        lfrfid_raw_codec_put_rice(
+            &writer, lfrfid_raw_codec_zigzag(pairs[i].duration, last.duration), duration_k);
+        last = pairs[i];
+    }
+
+    return LFRFID_RAW_CODEC_HEADER_SIZE + (writer.bit_index + 7) / 8;
+}
+
+bool lfrfid_raw_codec_decoder_init(LFRFIDRawDecoder* decoder, const uint8_t* data, size_t size) {
+    decoder->pairs_left = 0;
+
+    if(size < LFRFID_RAW_CODEC_HEADER_SIZE) return false;
+
+    size_t count = data[0] | (data[1] << 8);
+    if(count > LFRFID_RAW_CODEC_BLOCK_PAIRS || data[2] > RICE_K_MAX || data[3] > RICE_K_MAX) {
+        return false;
+    }
+
+    decoder->data = data + LFRFID_RAW_CODEC_HEADER_SIZE;
+    decoder->size = size - LFRFID_RAW_CODEC_HEADER_SIZE;
+    decoder->bit_index = 0;
+    decoder->pairs_left = count;
+    decoder->pulse_k = data[2];
+    decoder->duration_k = data[3];
+    decoder->last.pulse = 0;
+    decoder->last.duration = 0;
+
+    return true;
+}
+
+// Returns at least 56 valid bits starting from current position, zero padded at block end
+static inline uint64_t lfrfid_raw_codec_fetch(const LFRFIDRawDecoder* decoder) {
+    size_t byte = decoder->bit_index / 8;
+    uint64_t window = 0;
+
+    if(byte + sizeof(window) <= decoder->size) {
+        memcpy(&window, &decoder->data[byte], sizeof(window));
+    } else {
+        for(size_t i = 0; byte + i < decoder->size; i++) {
+            window |= (uint64_t)decoder->data[byte + i] << (i * 8);
+        }
+    }
+
+    return window >> (decoder->bit_index % 8);
+}
+
+static inline bool
+    lfrfid_raw_codec_get_rice(LFRFIDRawDecoder* decoder, uint8_t k, uint32_t* value) {
+    uint64_t window = lfrfid_raw_codec_fetch(decoder);
+    uint32_t quotient = (~window & ((1ULL << RICE_ESCAPE) - 1)) ?
+                            (uint32_t)__builtin_ctzll(~window) :
+                            RICE_ESCAPE;
+    size_t bits;
+
+    if(quotient < RICE_ESCAPE) {
+        uint32_t remainder = (window >> (quotient + 1)) & ((1UL << k) - 1);
+        *value = (quotient << k) | remainder;
+        bits = quotient + 1 + k;
+    } else {
+        *value = (uint32_t)(window >> RICE_ESCAPE);
+        bits = RICE_ESCAPE_BITS;
+    }
+
+    decoder->bit_index += bits;
+    return decoder->bit_index <= decoder->size * 8;
+}
+
+size_t lfrfid_raw_codec_decode(LFRFIDRawDecoder* decoder, LFRFIDRawPair* pairs, size_t count) {
+    size_t decoded = 0;
+
+    while(decoded < count && decoder->pairs_left > 0) {
+        uint32_t pulse_delta, duration_delta;
+        if(!lfrfid_raw_codec_get_rice(decoder, decoder->pulse_k, &pulse_delta) ||
+           !lfrfid_raw_codec_get_rice(decoder, decoder->duration_k, &duration_delta)) {
+            // corrupted block
+            decoder->pairs_left = 0;
+            break;
+        }
+
+        decoder->last.pulse = lfrfid_raw_codec_unzigzag(pulse_delta, decoder->last.pulse);
+        decoder->last.duration =
+            lfrfid_raw_codec_unzigzag(duration_delta, decoder->last.duration);
+        pairs[decoded++] = decoder->last;
+        decoder->pairs_left--;
+    }
+
+    return decoded;
+}
+
+size_t lfrfid_raw_codec_get_pairs_left(const LFRFIDRawDecoder* decoder) {
+    return decoder->pairs_left;
+}
@@ -0,0 +1,85 @@
+/**
+ * @file lfrfid_raw_codec.h
+ * LF RFID raw capture block codec
+ *
+ * Block of pulse/duration pairs is delta coded against the previous pair,
+ * deltas are zigzag mapped and Rice coded with parameters chosen per block.
+ * Blocks are independent, so any of them can be decoded without the ones before it.
+ * Codec doesn't depend on storage.
+ */
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Pairs in a full block */
+#define LFRFID_RAW_CODEC_BLOCK_PAIRS (256)
+
+/** Block header size: pair count and Rice parameters */
+#define LFRFID_RAW_CODEC_HEADER_SIZE (4)
+
+/** Worst case encoded block size for given pair count */
+#define LFRFID_RAW_CODEC_MAX_SIZE(pairs) (LFRFID_RAW_CODEC_HEADER_SIZE + (pairs) * 14)
+
+/** Captured period: high level time and full period time, in us */
+typedef struct {
+    uint32_t pulse;
+    uint32_t duration;
+} LFRFIDRawPair;
+
+/** Streaming block decoder state */
+typedef struct {
+    const uint8_t* data;
+    size_t size;
+    size_t bit_index;
+    size_t pairs_left;
+    uint8_t pulse_k;
+    uint8_t duration_k;
+    LFRFIDRawPair last;
+} LFRFIDRawDecoder;
+
+/**
+ * @brief Encode block of pairs
+ *
+ * @param pairs pairs to encode
+ * @param count pair count, up to LFRFID_RAW_CODEC_BLOCK_PAIRS
+ * @param output output buffer, at least LFRFID_RAW_CODEC_MAX_SIZE(count) bytes
+ * @return size_t encoded block size
+ */
+size_t lfrfid_raw_codec_encode(const LFRFIDRawPair* pairs, size_t count, uint8_t* output);
+
+/**
+ * @brief Start decoding block
+ *
+ * @param decoder decoder state
+ * @param data encoded block, must stay valid while decoding
+ * @param size encoded block size
+ * @return true if block header is valid
+ */
+bool lfrfid_raw_codec_decoder_init(LFRFIDRawDecoder* decoder, const uint8_t* data, size_t size);
+
+/**
+ * @brief Decode next pairs of block
+ *
+ * @param decoder decoder state
+ * @param pairs output pairs
+ * @param count maximum pair count
+ * @return size_t decoded pair count, 0 if block is over or corrupted
+ */
+size_t lfrfid_raw_codec_decode(LFRFIDRawDecoder* decoder, LFRFIDRawPair* pairs, size_t count);
+
+/**
+ * @brief Get pair count left in block
+ *
+ * @param decoder decoder state
+ * @return size_t pair count
+ */
+size_t lfrfid_raw_codec_get_pairs_left(const LFRFIDRawDecoder* decoder);
+
+#ifdef __cplusplus
+}
+#endif
@@ -29,6 +29,15 @@ extern "C" {
 /* Sub-second granularity time(). */
 double cs_time(void);
 
+/*
+ * Free running counter for measuring short intervals, wraps around. Only the
+ * difference between two readings is meaningful. Provided by the platform.
+ */
+uint32_t cs_clock_ticks(void);
+
+/* Number of `cs_clock_ticks()` ticks per microsecond. */
+uint32_t cs_clock_ticks_per_us(void);
+
 /*
  * Similar to (non-standard) timegm, converts broken-down time into the number
  * of seconds since Unix Epoch.
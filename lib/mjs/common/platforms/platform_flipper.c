@@ -1,6 +1,8 @@
 #include <furi.h>
+#include <furi_hal_cortex.h>
 #include <toolbox/stream/file_stream.h>
 #include "../cs_dbg.h"
+#include "../cs_time.h"
 #include "../frozen/frozen.h"
 
 char* cs_read_file(const char* path, size_t* size) {
@@ -29,6 +31,14 @@ char* cs_read_file(const char* path, size_t* size) {
     return data;
 }
 
+uint32_t cs_clock_ticks(void) {
+    return furi_hal_cortex_timer_get(0).start;
+}
+
+uint32_t cs_clock_ticks_per_us(void) {
+    return furi_hal_cortex_instructions_per_microsecond();
+}
+
 char* json_fread(const char* path) {
     UNUSED(path);
     return NULL;
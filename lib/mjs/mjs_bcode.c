@@ -126,18 +126,12 @@ MJS_PRIVATE int mjs_bcode_parts_cnt(struct mjs* mjs) {
     return mjs->bcode_parts.len / sizeof(struct mjs_bcode_part);
 }
 
-MJS_PRIVATE void mjs_bcode_commit(struct mjs* mjs) {
+MJS_PRIVATE void mjs_bcode_part_append(struct mjs* mjs, const char* data, size_t len) {
     struct mjs_bcode_part bp;
     memset(&bp, 0, sizeof(bp));
 
-    /* Make sure the bcode doesn't occupy any extra space */
-    mbuf_trim(&mjs->bcode_gen);
-
-    /* Transfer the ownership of the bcode data */
-    bp.data.p = mjs->bcode_gen.buf;
-    bp.data.len = mjs->bcode_gen.len;
-    mbuf_init(&mjs->bcode_gen, 0);
-
+    bp.data.p = data;
+    bp.data.len = len;
     bp.start_idx = mjs->bcode_len;
     bp.exec_res = MJS_ERRS_CNT;
 
@@ -145,3 +139,18 @@ MJS_PRIVATE void mjs_bcode_commit(struct mjs* mjs) {
 
     mjs->bcode_len += bp.data.len;
 }
+
+MJS_PRIVATE void mjs_bcode_commit(struct mjs* mjs) {
+    const char* data;
+    size_t len;
+
+    /* Make sure the bcode doesn't occupy any extra space */
+    mbuf_trim(&mjs->bcode_gen);
+
+    /* Transfer the ownership of the bcode data */
+    data = mjs->bcode_gen.buf;
+    len = mjs->bcode_gen.len;
+    mbuf_init(&mjs->bcode_gen, 0);
+
+    mjs_bcode_part_append(mjs, data, len);
+}
@@ -93,6 +93,11 @@ MJS_PRIVATE struct mjs_bcode_part* mjs_bcode_part_get_by_offset(struct mjs* mjs,
  */
 MJS_PRIVATE int mjs_bcode_parts_cnt(struct mjs* mjs);
 
+/*
+ * Adds malloc-ed bcode `data` as a next bcode part, takes ownership of it
+ */
+MJS_PRIVATE void mjs_bcode_part_append(struct mjs* mjs, const char* data, size_t len);
+
 /*
  * Adds the bcode being generated (mjs->bcode_gen) as a next bcode part
  */
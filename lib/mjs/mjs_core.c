@@ -61,6 +61,7 @@ void mjs_destroy(struct mjs* mjs) {
     mbuf_free(&mjs->loop_addresses);
     mbuf_free(&mjs->json_visited_stack);
     mbuf_free(&mjs->array_buffers);
+    mbuf_free(&mjs->gc_gray);
     free(mjs->error_msg);
     free(mjs->stack_trace);
     mjs_ffi_args_free_list(mjs);
@@ -98,6 +99,7 @@ struct mjs* mjs_create(void* context) {
         mbuf_append(&mjs->owned_strings, &z, 1);
     }
 
+    mjs->gc_step_size = MJS_GC_STEP_SIZE;
     gc_arena_init(
         &mjs->object_arena,
         sizeof(struct mjs_object),
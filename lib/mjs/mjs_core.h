@@ -8,7 +8,9 @@
 
 #include "mjs_ffi.h"
 #include "mjs_gc.h"
+#include "mjs_gc_public.h"
 #include "mjs_internal.h"
+#include "mjs_object.h"
 
 #if defined(__cplusplus)
 extern "C" {
@@ -89,6 +91,15 @@ struct mjs {
     struct gc_arena property_arena;
     struct gc_arena ffi_sig_arena;
 
+    struct mjs_property_cache_entry property_cache[MJS_PROPERTY_CACHE_SIZE];
+    uint32_t property_epoch;
+
+    struct mbuf gc_gray; /* Objects marked, but not scanned yet */
+    struct mjs_gc_stats gc_stats;
+    size_t gc_step_size;
+    uint8_t gc_phase;
+    unsigned gc_sweeping : 1;
+
     unsigned inhibit_gc : 1;
     unsigned need_gc : 1;
     unsigned generate_jsc : 1;
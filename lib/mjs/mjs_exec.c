@@ -19,6 +19,8 @@
 #include "mjs_util.h"
 #include "mjs_array_buf.h"
 
+#include <toolbox/crc.h>
+
 #if MJS_GENERATE_JSC && defined(CS_MMAP)
 #include <sys/mman.h>
 #endif
@@ -741,8 +743,11 @@ MJS_PRIVATE mjs_err_t mjs_execute(struct mjs* mjs, size_t off, mjs_val_t* res) {
             mjs_val_t obj = mjs_pop(mjs);
             mjs_val_t key = mjs_pop(mjs);
             mjs_val_t val = MJS_UNDEFINED;
+            struct mjs_property* prop = mjs_get_own_property_cached(mjs, obj, key, &code[i]);
 
-            if(!getprop_builtin(mjs, obj, key, &val)) {
+            if(prop != NULL) {
+                val = prop->value;
+            } else if(!getprop_builtin(mjs, obj, key, &val)) {
                 if(mjs_is_object(obj)) {
                     val = mjs_get_v_proto(mjs, obj, key);
                 } else if((mjs_is_data_view(obj) && (mjs_is_number(key)))) {
@@ -1145,6 +1150,97 @@ MJS_PRIVATE mjs_err_t mjs_exec_internal(
     return mjs->error;
 }
 
+mjs_err_t mjs_compile(
+    struct mjs* mjs,
+    const char* path,
+    const char* src,
+    char** bcode,
+    size_t* bcode_size) {
+    struct mjs_bcode_part* bp;
+
+    *bcode = NULL;
+    *bcode_size = 0;
+
+    mjs->error = mjs_parse(path, src, mjs);
+    if(mjs->error != MJS_OK) {
+        return mjs->error;
+    }
+
+    /* Detach the part that was just committed, it goes back with mjs_exec_bcode() */
+    bp = mjs_bcode_part_get(mjs, mjs_bcode_parts_cnt(mjs) - 1);
+    *bcode = (char*)bp->data.p;
+    *bcode_size = bp->data.len;
+    mjs->bcode_len -= bp->data.len;
+    mjs->bcode_parts.len -= sizeof(*bp);
+
+    return MJS_OK;
+}
+
+mjs_err_t mjs_exec_bcode(struct mjs* mjs, char* bcode, size_t bcode_size, mjs_val_t* res) {
+    size_t off = mjs->bcode_len;
+    mjs_val_t r = MJS_UNDEFINED;
+    mjs_header_item_t total_size = 0;
+
+    if(bcode_size > 1 + sizeof(mjs_header_item_t) * MJS_HDR_ITEMS_CNT) {
+        memcpy(
+            &total_size,
+            bcode + 1 + sizeof(mjs_header_item_t) * MJS_HDR_ITEM_TOTAL_SIZE,
+            sizeof(total_size));
+    }
+
+    /* Header is the only thing we can check, the rest is trusted */
+    if(total_size == 0 || (uint8_t)bcode[0] != OP_BCODE_HEADER || total_size + 1 != bcode_size) {
+        free(bcode);
+        mjs_set_errorf(mjs, MJS_BAD_ARGS_ERROR, "invalid bcode");
+    } else {
+        mjs_bcode_part_append(mjs, bcode, bcode_size);
+        mjs_execute(mjs, off, &r);
+    }
+
+    if(res != NULL) *res = r;
+    return mjs->error;
+}
+
+/* Changes whenever opcodes are added or removed */
+#define MJS_BCODE_VERSION ((2 << 8) | OP_MAX)
+
+uint32_t mjs_source_hash(uint32_t hash, const void* data, size_t size) {
+    const uint8_t* bytes = data;
+    size_t i;
+
+    /* FNV-1a */
+    for(i = 0; i < size; i++) {
+        hash ^= bytes[i];
+        hash *= 16777619U;
+    }
+    return hash;
+}
+
+static uint32_t mjs_bcode_crc(const char* bcode, size_t bcode_size) {
+    return ~crc_update(CrcEngine32Poly04C11DB7Reflected, ~0U, bcode, bcode_size);
+}
+
+void mjs_bcode_file_header_init(
+    struct mjs_bcode_file_header* header,
+    uint32_t source_hash,
+    const char* bcode,
+    size_t bcode_size) {
+    header->magic = MJS_BCODE_FILE_MAGIC;
+    header->version = MJS_BCODE_VERSION;
+    header->source_hash = source_hash;
+    header->bcode_size = bcode_size;
+    header->bcode_crc = mjs_bcode_crc(bcode, bcode_size);
+}
+
+int mjs_bcode_file_header_check(const struct mjs_bcode_file_header* header, uint32_t source_hash) {
+    return header->magic == MJS_BCODE_FILE_MAGIC && header->version == MJS_BCODE_VERSION &&
+           header->source_hash == source_hash && header->bcode_size > 0;
+}
+
+int mjs_bcode_file_bcode_check(const struct mjs_bcode_file_header* header, const char* bcode) {
+    return header->bcode_crc == mjs_bcode_crc(bcode, header->bcode_size);
+}
+
 mjs_err_t mjs_exec(struct mjs* mjs, const char* src, mjs_val_t* res) {
     return mjs_exec_internal(mjs, "<stdin>", src, 0 /* generate_jsc */, res);
 }
@@ -7,6 +7,7 @@
 #define MJS_EXEC_PUBLIC_H_
 
 #include "mjs_core_public.h"
+#include <stdint.h>
 #include <stdio.h>
 
 #if defined(__cplusplus)
@@ -27,6 +28,64 @@ mjs_err_t
     mjs_call(struct mjs* mjs, mjs_val_t* res, mjs_val_t func, mjs_val_t this_val, int nargs, ...);
 mjs_val_t mjs_get_this(struct mjs* mjs);
 
+/*
+ * Compile source code to bcode without executing it. On success, `*bcode` is
+ * a malloc-ed buffer owned by the caller. `path` is stored in the bcode and is
+ * used in stack traces. Compilation result does not depend on interpreter
+ * state, so the bcode can be executed by another instance.
+ */
+mjs_err_t mjs_compile(
+    struct mjs* mjs,
+    const char* path,
+    const char* src,
+    char** bcode,
+    size_t* bcode_size);
+
+/*
+ * Execute bcode produced by `mjs_compile()`. Takes ownership of the malloc-ed
+ * `bcode` buffer, even if bcode is rejected.
+ */
+mjs_err_t mjs_exec_bcode(struct mjs* mjs, char* bcode, size_t bcode_size, mjs_val_t* res);
+
+/*
+ * Precompiled bcode file: header, followed by `bcode_size` bytes of bcode
+ * produced by `mjs_compile()`. All fields are little endian.
+ */
+#define MJS_BCODE_FILE_MAGIC 0x43534A4DU /* "MJSC" */
+#define MJS_SOURCE_HASH_INIT 2166136261U
+
+struct mjs_bcode_file_header {
+    uint32_t magic;
+    uint32_t version; /* Bcode format version, changes with the opcode set */
+    uint32_t source_hash; /* `mjs_source_hash()` of the source code */
+    uint32_t bcode_size;
+    uint32_t bcode_crc; /* CRC-32 of the bcode */
+};
+
+/*
+ * Hash source code, can be called incrementally starting with
+ * `MJS_SOURCE_HASH_INIT`.
+ */
+uint32_t mjs_source_hash(uint32_t hash, const void* data, size_t size);
+
+void mjs_bcode_file_header_init(
+    struct mjs_bcode_file_header* header,
+    uint32_t source_hash,
+    const char* bcode,
+    size_t bcode_size);
+
+/*
+ * Returns non-zero if bcode file with given header can be executed by this
+ * interpreter and was compiled from the source code with given hash.
+ */
+int mjs_bcode_file_header_check(const struct mjs_bcode_file_header* header, uint32_t source_hash);
+
+/*
+ * Returns non-zero if `bcode` of `header->bcode_size` bytes matches the CRC
+ * stored in the header. Must be checked before the bcode is executed.
+ */
+int mjs_bcode_file_bcode_check(const struct mjs_bcode_file_header* header, const char* bcode);
+
 #if defined(__cplusplus)
 }
 #endif /* __cplusplus */
@@ -5,6 +5,9 @@
 
 #include <stdio.h>
 
+#include <furi.h>
+
+#include "common/cs_time.h"
 #include "common/cs_varint.h"
 #include "common/mbuf.h"
 
@@ -17,16 +20,29 @@
 #include "mjs_string.h"
 
 /*
- * Macros for marking reachable things: use bit 0.
+ * Collection is incremental, a script only stops for `gc_step_size` cells of
+ * work at a time:
+ *
+ * - MARK: objects reachable from roots are marked. Roots are scanned when the
+ *   phase starts, `gc_write_barrier()` keeps objects unlinked in the middle of
+ *   the phase alive (snapshot at the beginning), and cells allocated during
+ *   the phase are marked right away. Last step rescans roots, and marks and
+ *   compacts owned strings if the buffer is getting full: strings can't be
+ *   marked incrementally, since marking scrambles their values.
+ * - SWEEP: unmarked cells are freed block by block. Arenas are swept in order,
+ *   so that object destructors still see properties of the object. Cells are
+ *   only allocated from swept blocks.
+ *
+ * Mark bits are kept in per-block bitmaps, since cells stay in use by the
+ * script between the steps. Blocks of a cell are found by binary search in the
+ * address sorted block index of the arena.
  */
-#define MARK(p) (((struct gc_cell*)(p))->head.word |= 1)
-#define UNMARK(p) (((struct gc_cell*)(p))->head.word &= ~1)
-#define MARKED(p) (((struct gc_cell*)(p))->head.word & 1)
+
+#define GC_MARKS_WORDS(cells) (((cells) + 31) / 32)
 
 /*
- * Similar to `MARK()` / `UNMARK()` / `MARKED()`, but `.._FREE` counterparts
- * are intended to mark free cells (as opposed to used ones), so they use
- * bit 1.
+ * `.._FREE` macros are intended to mark free cells (as opposed to used
+ * ones) while the arena is swept, they use bit 1 of the free list link.
  */
 #define MARK_FREE(p) (((struct gc_cell*)(p))->head.word |= 2)
 #define UNMARK_FREE(p) (((struct gc_cell*)(p))->head.word &= ~2)
@@ -38,8 +54,9 @@
 #define GC_ARENA_CELLS_RESERVE 2
 
 static struct gc_block* gc_new_block(struct gc_arena* a, size_t size);
-static void gc_free_block(struct gc_block* b);
-static void gc_mark_mbuf_pt(struct mjs* mjs, const struct mbuf* mbuf);
+static void gc_free_block(struct gc_arena* a, struct gc_block* b);
+static void gc_sweep_until(struct mjs* mjs, struct gc_arena* a);
+static int gc_mark_cell(const struct gc_arena* a, const void* p);
 
 MJS_PRIVATE struct mjs_object* new_object(struct mjs* mjs) {
     return (struct mjs_object*)gc_alloc_cell(mjs, &mjs->object_arena);
@@ -67,21 +84,75 @@ MJS_PRIVATE void gc_arena_init(
     a->blocks = gc_new_block(a, initial_size);
 }
 
+static void gc_sweep_start(struct gc_arena* a);
+static struct gc_block* gc_sweep_block(struct mjs* mjs, struct gc_arena* a, struct gc_block* b);
+
 MJS_PRIVATE void gc_arena_destroy(struct mjs* mjs, struct gc_arena* a) {
     struct gc_block* b;
 
     if(a->blocks != NULL) {
-        gc_sweep(mjs, a, 0);
+        /* Everything is garbage now, even if collection is in progress */
+        for(b = a->blocks; b != NULL; b = b->next) {
+            memset(b->marks, 0, GC_MARKS_WORDS(b->size) * sizeof(uint32_t));
+        }
+        gc_sweep_start(a);
+        while(a->sweep != NULL) {
+            a->sweep = gc_sweep_block(mjs, a, a->sweep);
+        }
         for(b = a->blocks; b != NULL;) {
             struct gc_block* tmp;
             tmp = b;
             b = b->next;
-            gc_free_block(tmp);
+            gc_free_block(a, tmp);
         }
     }
+    free(a->index);
+    a->index = NULL;
+    a->index_len = a->index_size = 0;
 }
 
-static void gc_free_block(struct gc_block* b) {
+/* Returns position of the first indexed block that starts after `p` */
+static size_t gc_index_upper_bound(const struct gc_arena* a, const void* p) {
+    size_t lo = 0, hi = a->index_len;
+    while(lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if((const void*)a->index[mid]->base <= p) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return lo;
+}
+
+static void gc_index_add(struct gc_arena* a, struct gc_block* b) {
+    size_t pos;
+
+    if(a->index_len == a->index_size) {
+        size_t size = a->index_size ? a->index_size * 2 : 4;
+        a->index = (struct gc_block**)realloc(a->index, size * sizeof(*a->index));
+        furi_check(a->index);
+        a->index_size = size;
+    }
+
+    pos = gc_index_upper_bound(a, b->base);
+    memmove(&a->index[pos + 1], &a->index[pos], (a->index_len - pos) * sizeof(*a->index));
+    a->index[pos] = b;
+    a->index_len++;
+}
+
+static void gc_index_remove(struct gc_arena* a, struct gc_block* b) {
+    size_t pos = gc_index_upper_bound(a, b->base);
+
+    furi_check(pos > 0 && a->index[pos - 1] == b);
+    pos--;
+    memmove(&a->index[pos], &a->index[pos + 1], (a->index_len - pos - 1) * sizeof(*a->index));
+    a->index_len--;
+}
+
+static void gc_free_block(struct gc_arena* a, struct gc_block* b) {
+    gc_index_remove(a, b);
+    free(b->marks);
     free(b->base);
     free(b);
 }
@@ -96,6 +167,9 @@ static struct gc_block* gc_new_block(struct gc_arena* a, size_t size) {
     b->size = size;
     b->base = (struct gc_cell*)calloc(a->cell_size, b->size);
     if(b->base == NULL) abort();
+    b->marks = (uint32_t*)calloc(GC_MARKS_WORDS(b->size), sizeof(uint32_t));
+    furi_check(b->marks);
+    gc_index_add(a, b);
 
     for(cur = GC_CELL_OP(a, b->base, +, 0); cur < GC_CELL_OP(a, b->base, +, b->size);
         cur = GC_CELL_OP(a, cur, +, 1)) {
@@ -106,15 +180,12 @@ static struct gc_block* gc_new_block(struct gc_arena* a, size_t size) {
     return b;
 }
 
-/*
- * Returns whether the given arena has GC_ARENA_CELLS_RESERVE or less free
- * cells
- */
-static int gc_arena_is_gc_needed(struct gc_arena* a) {
+/* Returns whether the given arena has `count` or less free cells */
+static int gc_arena_free_is_below(struct gc_arena* a, size_t count) {
     struct gc_cell* r = a->free;
-    int i;
+    size_t i;
 
-    for(i = 0; i <= GC_ARENA_CELLS_RESERVE; i++, r = r->head.link) {
+    for(i = 0; i <= count; i++, r = r->head.link) {
         if(r == NULL) {
             return 1;
         }
@@ -123,6 +194,26 @@ static int gc_arena_is_gc_needed(struct gc_arena* a) {
     return 0;
 }
 
+/*
+ * Returns whether the given arena has GC_ARENA_CELLS_RESERVE or less free
+ * cells
+ */
+static int gc_arena_is_gc_needed(struct gc_arena* a) {
+    return gc_arena_free_is_below(a, GC_ARENA_CELLS_RESERVE);
+}
+
+/*
+ * Adds a block to the arena if there is little free space left after
+ * collection, otherwise next collection would start right away
+ */
+static void gc_arena_grow_if_full(struct gc_arena* a) {
+    if(gc_arena_free_is_below(a, a->size_increment / 2)) {
+        struct gc_block* b = gc_new_block(a, a->size_increment);
+        b->next = a->blocks;
+        a->blocks = b;
+    }
+}
+
 MJS_PRIVATE int gc_strings_is_gc_needed(struct mjs* mjs) {
     struct mbuf* m = &mjs->owned_strings;
     return (double)m->len / (double)m->size > (double)0.9;
@@ -131,6 +222,9 @@ MJS_PRIVATE int gc_strings_is_gc_needed(struct mjs* mjs) {
 MJS_PRIVATE void* gc_alloc_cell(struct mjs* mjs, struct gc_arena* a) {
     struct gc_cell* r;
 
+    if(a->free == NULL && a->sweep != NULL) {
+        gc_sweep_until(mjs, a);
+    }
     if(a->free == NULL) {
         struct gc_block* b = gc_new_block(a, a->size_increment);
         b->next = a->blocks;
@@ -138,8 +232,6 @@ MJS_PRIVATE void* gc_alloc_cell(struct mjs* mjs, struct gc_arena* a) {
     }
     r = a->free;
 
-    UNMARK(r);
-
     a->free = r->head.link;
 
 #if MJS_MEMORY_STATS
@@ -157,165 +249,234 @@ MJS_PRIVATE void* gc_alloc_cell(struct mjs* mjs, struct gc_arena* a) {
    * are overwritten downstream, but not worth the yak shave time
    * when fields are added to GC-able structures */
     memset(r, 0, a->cell_size);
+
+    /* Cells allocated while marking is in progress are not garbage yet */
+    if(mjs->gc_phase == MJS_GC_PHASE_MARK) {
+        gc_mark_cell(a, r);
+    }
+
     return (void*)r;
 }
 
+static struct gc_block* gc_find_block(const struct gc_arena* a, const void* ptr) {
+    const struct gc_cell* p = (const struct gc_cell*)ptr;
+    size_t pos = gc_index_upper_bound(a, p);
+    struct gc_block* b;
+
+    if(pos == 0) return NULL;
+    b = a->index[pos - 1];
+    return p < GC_CELL_OP(a, b->base, +, b->size) ? b : NULL;
+}
+
+/* Marks a cell, returns 0 if it was marked already */
+static int gc_mark_cell(const struct gc_arena* a, const void* p) {
+    struct gc_block* b = gc_find_block(a, p);
+    size_t i;
+    uint32_t bit;
+
+    /* Pointer to a cell outside of the arena is a heap corruption */
+    furi_check(b);
+
+    i = ((const char*)p - (const char*)b->base) / a->cell_size;
+    bit = 1U << (i % 32);
+    if(b->marks[i / 32] & bit) return 0;
+    b->marks[i / 32] |= bit;
+    return 1;
+}
+
+static int gc_is_marked(const struct gc_arena* a, const void* p) {
+    struct gc_block* b = gc_find_block(a, p);
+    size_t i;
+
+    if(b == NULL) return 0;
+
+    i = ((const char*)p - (const char*)b->base) / a->cell_size;
+    return (b->marks[i / 32] >> (i % 32)) & 1;
+}
+
 /*
- * Scans the arena and add all unmarked cells to the free list.
- *
- * Empty blocks get deallocated. The head of the free list will contais cells
- * from the last (oldest) block. Cells will thus be allocated in block order.
+ * Prepares the arena to be swept: free list is rebuilt from scratch, so cells
+ * that are free already are marked in a way that is distinguishable from
+ * garbage.
  */
-void gc_sweep(struct mjs* mjs, struct gc_arena* a, size_t start) {
-    struct gc_block* b;
+static void gc_sweep_start(struct gc_arena* a) {
     struct gc_cell* cur;
-    struct gc_block** prevp = &a->blocks;
+    struct gc_cell* next;
+
+    for(cur = a->free; cur != NULL; cur = next) {
+        next = cur->head.link;
+        MARK_FREE(cur);
+    }
+
+    a->free = NULL;
+    a->sweep = a->blocks;
 #if MJS_MEMORY_STATS
     a->alive = 0;
 #endif
+}
 
-    /*
-   * Before we sweep, we should mark all free cells in a way that is
-   * distinguishable from marked used cells.
-   */
-    {
-        struct gc_cell* next;
-        for(cur = a->free; cur != NULL; cur = next) {
-            next = cur->head.link;
-            MARK_FREE(cur);
-        }
-    }
+/*
+ * Adds all unmarked cells of the block to the free list, returns the next block
+ * to sweep.
+ *
+ * Empty blocks get deallocated. The head of the free list will contais cells
+ * from the last (oldest) block. Cells will thus be allocated in block order.
+ */
+static struct gc_block* gc_sweep_block(struct mjs* mjs, struct gc_arena* a, struct gc_block* b) {
+    struct gc_block* next = b->next;
+    struct gc_cell* cur;
+    size_t freed_in_block = 0;
+    size_t i;
 
     /*
-   * We'll rebuild the whole `free` list, so initially we just reset it
+   * if it turns out that this block is 100% garbage
+   * we can release the whole block, but the addition
+   * of it's cells to the free list has to be undone.
    */
-    a->free = NULL;
+    struct gc_cell* prev_free = a->free;
 
-    for(b = a->blocks; b != NULL;) {
-        size_t freed_in_block = 0;
-        /*
-     * if it turns out that this block is 100% garbage
-     * we can release the whole block, but the addition
-     * of it's cells to the free list has to be undone.
-     */
-        struct gc_cell* prev_free = a->free;
+    /* Destructors may allocate, they must not sweep the block again */
+    mjs->gc_sweeping = 1;
 
-        for(cur = GC_CELL_OP(a, b->base, +, start); cur < GC_CELL_OP(a, b->base, +, b->size);
-            cur = GC_CELL_OP(a, cur, +, 1)) {
-            if(MARKED(cur)) {
-                /* The cell is used and marked  */
-                UNMARK(cur);
+    for(i = 0; i < b->size; i++) {
+        cur = GC_CELL_OP(a, b->base, +, i);
+        if((b->marks[i / 32] >> (i % 32)) & 1) {
+            /* The cell is used and marked  */
 #if MJS_MEMORY_STATS
-                a->alive++;
+            a->alive++;
 #endif
-            } else {
-                /*
-         * The cell is either:
-         * - free
-         * - garbage that's about to be freed
-         */
-
-                if(MARKED_FREE(cur)) {
-                    /* The cell is free, so, just unmark it */
-                    UNMARK_FREE(cur);
-                } else {
-                    /*
-           * The cell is used and should be freed: call the destructor and
-           * reset the memory
-           */
-                    if(a->destructor != NULL) {
-                        a->destructor(mjs, cur);
-                    }
-                    memset(cur, 0, a->cell_size);
-                }
-
-                /* Add this cell to the `free` list */
-                cur->head.link = a->free;
-                a->free = cur;
-                freed_in_block++;
-#if MJS_MEMORY_STATS
-                a->garbage++;
-#endif
-            }
+            continue;
         }
 
         /*
-     * don't free the initial block, which is at the tail
-     * because it has a special size aimed at reducing waste
-     * and simplifying initial startup. TODO(mkm): improve
-     * */
-        if(b->next != NULL && freed_in_block == b->size) {
-            *prevp = b->next;
-            gc_free_block(b);
-            b = *prevp;
-            a->free = prev_free;
+       * The cell is either:
+       * - free
+       * - garbage that's about to be freed
+       */
+        if(MARKED_FREE(cur)) {
+            /* The cell is free, so, just unmark it */
+            UNMARK_FREE(cur);
         } else {
-            prevp = &b->next;
-            b = b->next;
+            /*
+         * The cell is used and should be freed: call the destructor and
+         * reset the memory
+         */
+            if(a->destructor != NULL) {
+                a->destructor(mjs, cur);
+            }
+            memset(cur, 0, a->cell_size);
         }
-    }
-}
-
-/* Mark an FFI signature */
-static void gc_mark_ffi_sig(struct mjs* mjs, mjs_val_t* v) {
-    struct mjs_ffi_sig* psig;
 
-    assert(mjs_is_ffi_sig(*v));
+        /* Add this cell to the `free` list */
+        cur->head.link = a->free;
+        a->free = cur;
+        freed_in_block++;
+#if MJS_MEMORY_STATS
+        a->garbage++;
+#endif
+    }
 
-    psig = mjs_get_ffi_sig_struct(*v);
+    mjs->gc_sweeping = 0;
+    memset(b->marks, 0, GC_MARKS_WORDS(b->size) * sizeof(uint32_t));
 
     /*
-   * we treat all object like things like objects but they might be functions,
-   * gc_check_val checks the appropriate arena per actual value type.
-   */
-    if(!gc_check_val(mjs, *v)) {
-        abort();
+   * don't free the initial block, which is at the tail
+   * because it has a special size aimed at reducing waste
+   * and simplifying initial startup. TODO(mkm): improve
+   * */
+    if(next != NULL && freed_in_block == b->size) {
+        /* Blocks allocated by destructors are prepended, look the link up */
+        struct gc_block** prevp = &a->blocks;
+        while(*prevp != b) {
+            prevp = &(*prevp)->next;
+        }
+        *prevp = next;
+        gc_free_block(a, b);
+        a->free = prev_free;
     }
 
-    if(MARKED(psig)) return;
+    return next;
+}
 
-    MARK(psig);
+/* Sweeps arenas in order, returns amount of work done */
+static size_t gc_sweep_step(struct mjs* mjs, size_t budget) {
+    struct gc_arena* arenas[] = {&mjs->object_arena, &mjs->property_arena, &mjs->ffi_sig_arena};
+    size_t work = 0;
+    size_t i;
+
+    for(i = 0; i < sizeof(arenas) / sizeof(arenas[0]); i++) {
+        struct gc_arena* a = arenas[i];
+        while(a->sweep != NULL) {
+            if(work >= budget) return work;
+            work += a->sweep->size;
+            a->sweep = gc_sweep_block(mjs, a, a->sweep);
+        }
+    }
+
+    return work;
 }
 
-/* Mark an object */
-static void gc_mark_object(struct mjs* mjs, mjs_val_t* v) {
-    struct mjs_object* obj_base;
-    struct mjs_property* prop;
-    struct mjs_property* next;
+/*
+ * Sweeps the arena until a free cell is found. Arenas before it have to be
+ * swept completely first.
+ */
+static void gc_sweep_until(struct mjs* mjs, struct gc_arena* a) {
+    struct gc_arena* arenas[] = {&mjs->object_arena, &mjs->property_arena, &mjs->ffi_sig_arena};
+    size_t i;
 
-    assert(mjs_is_object_based(*v));
+    if(mjs->gc_sweeping) return;
 
-    obj_base = get_object_struct(*v);
+    for(i = 0; i < sizeof(arenas) / sizeof(arenas[0]); i++) {
+        while(arenas[i]->sweep != NULL) {
+            if(arenas[i] == a && a->free != NULL) return;
+            arenas[i]->sweep = gc_sweep_block(mjs, arenas[i], arenas[i]->sweep);
+        }
+        if(arenas[i] == a) return;
+    }
+}
 
-    /*
-   * we treat all object like things like objects but they might be functions,
-   * gc_check_val checks the appropriate arena per actual value type.
-   */
-    if(!gc_check_val(mjs, *v)) {
-        abort();
+/*
+ * Marks a value. Objects are queued to have their properties marked later,
+ * FFI signatures don't refer to anything.
+ */
+static void gc_mark_gray(struct mjs* mjs, mjs_val_t v) {
+    if(mjs_is_object_based(v)) {
+        struct mjs_object* obj = get_object_struct(v);
+        if(gc_mark_cell(&mjs->object_arena, obj)) {
+            mbuf_append(&mjs->gc_gray, &obj, sizeof(obj));
+        }
+    } else if(mjs_is_ffi_sig(v)) {
+        gc_mark_cell(&mjs->ffi_sig_arena, mjs_get_ffi_sig_struct(v));
     }
+}
 
-    if(MARKED(obj_base)) return;
+/* Marks properties of queued objects, returns amount of work done */
+static size_t gc_mark_drain(struct mjs* mjs, size_t budget) {
+    size_t work = 0;
 
-    /* mark object itself, and its properties */
-    for((prop = obj_base->properties), MARK(obj_base); prop != NULL; prop = next) {
-        if(!gc_check_ptr(&mjs->property_arena, prop)) {
-            abort();
-        }
+    while(mjs->gc_gray.len > 0 && work < budget) {
+        struct mjs_object* obj;
+        struct mjs_property* prop;
 
-        gc_mark(mjs, &prop->name);
-        gc_mark(mjs, &prop->value);
+        mjs->gc_gray.len -= sizeof(obj);
+        memcpy(&obj, mjs->gc_gray.buf + mjs->gc_gray.len, sizeof(obj));
 
-        next = prop->next;
-        MARK(prop);
+        for(prop = obj->properties; prop != NULL; prop = prop->next) {
+            gc_mark_cell(&mjs->property_arena, prop);
+            gc_mark_gray(mjs, prop->name);
+            gc_mark_gray(mjs, prop->value);
+            work++;
+        }
+        work++;
     }
 
-    /* mark object's prototype */
-    /*
-   * We dropped support for object prototypes in MJS.
-   * If we ever bring it back, don't forget to mark it
-   */
-    /* gc_mark(mjs, mjs_get_proto(mjs, v)); */
+    return work;
+}
+
+MJS_PRIVATE void gc_write_barrier(struct mjs* mjs, mjs_val_t old) {
+    if(mjs->gc_phase == MJS_GC_PHASE_MARK) {
+        gc_mark_gray(mjs, old);
+    }
 }
 
 /* Mark a string value */
@@ -366,18 +527,6 @@ static void gc_mark_string(struct mjs* mjs, mjs_val_t* v) {
     memcpy(v, &tmp, sizeof(tmp));
 }
 
-MJS_PRIVATE void gc_mark(struct mjs* mjs, mjs_val_t* v) {
-    if(mjs_is_object_based(*v)) {
-        gc_mark_object(mjs, v);
-    }
-    if(mjs_is_ffi_sig(*v)) {
-        gc_mark_ffi_sig(mjs, v);
-    }
-    if((*v & MJS_TAG_MASK) == MJS_TAG_STRING_O) {
-        gc_mark_string(mjs, v);
-    }
-}
-
 MJS_PRIVATE uint64_t gc_string_mjs_val_to_offset(mjs_val_t v) {
     return (((uint64_t)(uintptr_t)get_ptr(v)) & ~MJS_TAG_MASK);
 }
@@ -441,64 +590,196 @@ void gc_compact_strings(struct mjs* mjs) {
     mjs->owned_strings.len = head;
 }
 
-MJS_PRIVATE int maybe_gc(struct mjs* mjs) {
-    if(!mjs->inhibit_gc) {
-        mjs_gc(mjs, 0);
-        return 1;
-    }
-    return 0;
-}
+typedef void (*gc_root_visitor_t)(struct mjs* mjs, mjs_val_t* v);
 
 /*
- * mark an array of `mjs_val_t` values (*not pointers* to them)
+ * Calls `visit` for every root: values that are reachable no matter what
  */
-static void gc_mark_val_array(struct mjs* mjs, mjs_val_t* vals, size_t len) {
+static void gc_visit_roots(struct mjs* mjs, gc_root_visitor_t visit) {
+    const struct mbuf* stacks[] = {&mjs->scopes, &mjs->stack, &mjs->call_stack};
     mjs_val_t* vp;
-    for(vp = vals; vp < vals + len; vp++) {
-        gc_mark(mjs, vp);
+    mjs_val_t** vpp;
+    ffi_cb_args_t* cbargs;
+    size_t i;
+
+    for(vp = (mjs_val_t*)&mjs->vals;
+        vp < (mjs_val_t*)&mjs->vals + sizeof(mjs->vals) / sizeof(mjs_val_t);
+        vp++) {
+        visit(mjs, vp);
+    }
+
+    /* owned values are stored as *pointers* to `mjs_val_t` */
+    for(vpp = (mjs_val_t**)mjs->owned_values.buf;
+        (char*)vpp < mjs->owned_values.buf + mjs->owned_values.len;
+        vpp++) {
+        visit(mjs, *vpp);
+    }
+
+    for(i = 0; i < sizeof(stacks) / sizeof(stacks[0]); i++) {
+        for(vp = (mjs_val_t*)stacks[i]->buf; (char*)vp < stacks[i]->buf + stacks[i]->len;
+            vp++) {
+            visit(mjs, vp);
+        }
+    }
+
+    for(cbargs = mjs->ffi_cb_args; cbargs != NULL; cbargs = cbargs->next) {
+        visit(mjs, &cbargs->func);
+        visit(mjs, &cbargs->userdata);
+    }
+}
+
+static void gc_mark_root(struct mjs* mjs, mjs_val_t* v) {
+    gc_mark_gray(mjs, *v);
+}
+
+static void gc_mark_root_string(struct mjs* mjs, mjs_val_t* v) {
+    if((*v & MJS_TAG_MASK) == MJS_TAG_STRING_O) {
+        gc_mark_string(mjs, v);
+    }
+}
+
+/* Marks strings referenced by roots and by marked properties */
+static void gc_mark_strings(struct mjs* mjs) {
+    struct gc_arena* a = &mjs->property_arena;
+    struct gc_block* b;
+    size_t i;
+
+    gc_visit_roots(mjs, gc_mark_root_string);
+
+    for(b = a->blocks; b != NULL; b = b->next) {
+        for(i = 0; i < b->size; i++) {
+            struct mjs_property* prop = (struct mjs_property*)GC_CELL_OP(a, b->base, +, i);
+            if(!((b->marks[i / 32] >> (i % 32)) & 1)) continue;
+            gc_mark_root_string(mjs, &prop->name);
+            gc_mark_root_string(mjs, &prop->value);
+        }
     }
 }
 
 /*
- * mark an mbuf containing *pointers* to `mjs_val_t` values
+ * Drop cached property lookups of objects that are about to be freed: their
+ * cells can be reused. Properties of live objects stay alive.
  */
-static void gc_mark_mbuf_pt(struct mjs* mjs, const struct mbuf* mbuf) {
-    mjs_val_t** vp;
-    for(vp = (mjs_val_t**)mbuf->buf; (char*)vp < mbuf->buf + mbuf->len; vp++) {
-        gc_mark(mjs, *vp);
+static void gc_prune_property_cache(struct mjs* mjs) {
+    size_t i;
+    for(i = 0; i < MJS_PROPERTY_CACHE_SIZE; i++) {
+        struct mjs_property_cache_entry* entry = &mjs->property_cache[i];
+        if(entry->site != NULL && !gc_is_marked(&mjs->object_arena, entry->obj)) {
+            entry->site = NULL;
+        }
+    }
+}
+
+static void gc_mark_start(struct mjs* mjs) {
+    mjs->gc_phase = MJS_GC_PHASE_MARK;
+    gc_visit_roots(mjs, gc_mark_root);
+}
+
+static void gc_mark_finish(struct mjs* mjs, int compact_strings) {
+    /* Roots are not guarded by the barrier, pick up whatever got there */
+    gc_visit_roots(mjs, gc_mark_root);
+    /* Gray stack keeps its buffer for the next cycle, it is freed with the instance */
+    gc_mark_drain(mjs, (size_t)~0);
+
+    gc_prune_property_cache(mjs);
+
+    if(compact_strings) {
+        gc_mark_strings(mjs);
+        gc_compact_strings(mjs);
+
+        /* Leave room for new strings, so that next collection doesn't start right away */
+        if(gc_strings_is_gc_needed(mjs)) {
+            struct mbuf* m = &mjs->owned_strings;
+            mbuf_resize(m, m->len + m->len / 4 + _MJS_STRING_BUF_RESERVE);
+        }
+    }
+
+    gc_sweep_start(&mjs->object_arena);
+    gc_sweep_start(&mjs->property_arena);
+    gc_sweep_start(&mjs->ffi_sig_arena);
+    mjs->gc_phase = MJS_GC_PHASE_SWEEP;
+}
+
+static void gc_sweep_finish(struct mjs* mjs) {
+    gc_arena_grow_if_full(&mjs->object_arena);
+    gc_arena_grow_if_full(&mjs->property_arena);
+    gc_arena_grow_if_full(&mjs->ffi_sig_arena);
+    mjs->gc_phase = MJS_GC_PHASE_IDLE;
+    mjs->gc_stats.cycles++;
+}
+
+static void gc_stats_add_pause(struct mjs* mjs, uint32_t start) {
+    struct mjs_gc_stats* stats = &mjs->gc_stats;
+    uint32_t pause = (cs_clock_ticks() - start) / cs_clock_ticks_per_us();
+
+    stats->steps++;
+    stats->last_pause = pause;
+    stats->total_pause += pause;
+    if(pause > stats->max_pause) {
+        stats->max_pause = pause;
     }
 }
 
 /*
- * mark an mbuf containing `mjs_val_t` values (*not pointers* to them)
+ * Performs one step of incremental collection, returns 1 when a collection
+ * cycle is complete
  */
-static void gc_mark_mbuf_val(struct mjs* mjs, const struct mbuf* mbuf) {
-    gc_mark_val_array(mjs, (mjs_val_t*)mbuf->buf, mbuf->len / sizeof(mjs_val_t));
+static int gc_step(struct mjs* mjs) {
+    uint32_t start = cs_clock_ticks();
+    int done = 0;
+
+    switch(mjs->gc_phase) {
+    case MJS_GC_PHASE_IDLE:
+        gc_mark_start(mjs);
+        break;
+    case MJS_GC_PHASE_MARK:
+        gc_mark_drain(mjs, mjs->gc_step_size);
+        if(mjs->gc_gray.len == 0) {
+            gc_mark_finish(mjs, gc_strings_is_gc_needed(mjs));
+        }
+        break;
+    case MJS_GC_PHASE_SWEEP:
+        gc_sweep_step(mjs, mjs->gc_step_size);
+        if(mjs->ffi_sig_arena.sweep == NULL && mjs->property_arena.sweep == NULL &&
+           mjs->object_arena.sweep == NULL) {
+            gc_sweep_finish(mjs);
+            done = 1;
+        }
+        break;
+    }
+
+    gc_stats_add_pause(mjs, start);
+    return done;
 }
 
-static void gc_mark_ffi_cbargs_list(struct mjs* mjs, ffi_cb_args_t* cbargs) {
-    for(; cbargs != NULL; cbargs = cbargs->next) {
-        gc_mark(mjs, &cbargs->func);
-        gc_mark(mjs, &cbargs->userdata);
+MJS_PRIVATE int maybe_gc(struct mjs* mjs) {
+    if(!mjs->inhibit_gc) {
+        if(mjs->gc_step_size == 0) {
+            mjs_gc(mjs, 0);
+            return 1;
+        }
+        return gc_step(mjs);
     }
+    return 0;
 }
 
 /* Perform garbage collection */
 void mjs_gc(struct mjs* mjs, int full) {
-    gc_mark_val_array(mjs, (mjs_val_t*)&mjs->vals, sizeof(mjs->vals) / sizeof(mjs_val_t));
-
-    gc_mark_mbuf_pt(mjs, &mjs->owned_values);
-    gc_mark_mbuf_val(mjs, &mjs->scopes);
-    gc_mark_mbuf_val(mjs, &mjs->stack);
-    gc_mark_mbuf_val(mjs, &mjs->call_stack);
+    uint32_t start = cs_clock_ticks();
 
-    gc_mark_ffi_cbargs_list(mjs, mjs->ffi_cb_args);
+    if(mjs->gc_sweeping) return;
 
-    gc_compact_strings(mjs);
-
-    gc_sweep(mjs, &mjs->object_arena, 0);
-    gc_sweep(mjs, &mjs->property_arena, 0);
-    gc_sweep(mjs, &mjs->ffi_sig_arena, 0);
+    /* Complete collection in progress, marks of the previous cycle would be stale */
+    if(mjs->gc_phase == MJS_GC_PHASE_SWEEP) {
+        gc_sweep_step(mjs, (size_t)~0);
+        gc_sweep_finish(mjs);
+    }
+    if(mjs->gc_phase == MJS_GC_PHASE_IDLE) {
+        gc_mark_start(mjs);
+    }
+    gc_mark_finish(mjs, 1);
+    gc_sweep_step(mjs, (size_t)~0);
+    gc_sweep_finish(mjs);
 
     if(full) {
         /*
@@ -511,6 +792,16 @@ void mjs_gc(struct mjs* mjs, int full) {
             mbuf_resize(&mjs->owned_strings, trimmed_size);
         }
     }
+
+    gc_stats_add_pause(mjs, start);
+}
+
+void mjs_set_gc_step_size(struct mjs* mjs, size_t step_size) {
+    mjs->gc_step_size = step_size;
+}
+
+void mjs_get_gc_stats(struct mjs* mjs, struct mjs_gc_stats* stats) {
+    *stats = mjs->gc_stats;
 }
 
 MJS_PRIVATE int gc_check_val(struct mjs* mjs, mjs_val_t v) {
@@ -524,12 +815,5 @@ MJS_PRIVATE int gc_check_val(struct mjs* mjs, mjs_val_t v) {
 }
 
 MJS_PRIVATE int gc_check_ptr(const struct gc_arena* a, const void* ptr) {
-    const struct gc_cell* p = (const struct gc_cell*)ptr;
-    struct gc_block* b;
-    for(b = a->blocks; b != NULL; b = b->next) {
-        if(p >= b->base && p < GC_CELL_OP(a, b->base, +, b->size)) {
-            return 1;
-        }
-    }
-    return 0;
+    return gc_find_block(a, ptr) != NULL;
 }
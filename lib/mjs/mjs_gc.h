@@ -29,6 +29,20 @@ struct gc_cell {
     } head;
 };
 
+/*
+ * Default amount of work done by a single incremental collection step, in
+ * cells
+ */
+#ifndef MJS_GC_STEP_SIZE
+#define MJS_GC_STEP_SIZE 64
+#endif
+
+enum mjs_gc_phase {
+    MJS_GC_PHASE_IDLE,
+    MJS_GC_PHASE_MARK, /* Marking objects reachable from roots */
+    MJS_GC_PHASE_SWEEP, /* Freeing unmarked cells */
+};
+
 MJS_PRIVATE int gc_strings_is_gc_needed(struct mjs* mjs);
 
 /* perform gc if not inhibited */
@@ -38,11 +52,15 @@ MJS_PRIVATE struct mjs_object* new_object(struct mjs*);
 MJS_PRIVATE struct mjs_property* new_property(struct mjs*);
 MJS_PRIVATE struct mjs_ffi_sig* new_ffi_sig(struct mjs* mjs);
 
-MJS_PRIVATE void gc_mark(struct mjs* mjs, mjs_val_t* val);
+/*
+ * Must be called before a value stored in a property is overwritten or the
+ * property is deleted, so that incremental marking doesn't miss objects moved
+ * around by the script
+ */
+MJS_PRIVATE void gc_write_barrier(struct mjs* mjs, mjs_val_t old);
 
 MJS_PRIVATE void gc_arena_init(struct gc_arena*, size_t, size_t, size_t);
 MJS_PRIVATE void gc_arena_destroy(struct mjs*, struct gc_arena* a);
-MJS_PRIVATE void gc_sweep(struct mjs*, struct gc_arena*, size_t);
 MJS_PRIVATE void* gc_alloc_cell(struct mjs*, struct gc_arena*);
 
 MJS_PRIVATE uint64_t gc_string_mjs_val_to_offset(mjs_val_t v);
@@ -12,12 +12,35 @@
 extern "C" {
 #endif /* __cplusplus */
 
+/*
+ * Garbage collector statistics. Pause is the time a script was stopped by a
+ * single collector invocation, in microseconds.
+ */
+struct mjs_gc_stats {
+    uint32_t cycles; /* Completed collection cycles */
+    uint32_t steps; /* Collector invocations */
+    uint32_t last_pause;
+    uint32_t max_pause;
+    uint32_t total_pause;
+};
+
 /*
  * Perform garbage collection.
  * Pass true to full in order to reclaim unused heap back to the OS.
  */
 void mjs_gc(struct mjs* mjs, int full);
 
+/*
+ * Set the amount of work done by a single incremental collection step, in
+ * cells. Pass 0 to collect garbage all at once, like `mjs_gc()` does.
+ */
+void mjs_set_gc_step_size(struct mjs* mjs, size_t step_size);
+
+/*
+ * Get garbage collector statistics.
+ */
+void mjs_get_gc_stats(struct mjs* mjs, struct mjs_gc_stats* stats);
+
 #if defined(__cplusplus)
 }
 #endif /* __cplusplus */
@@ -19,6 +19,7 @@ typedef void (*gc_cell_destructor_t)(struct mjs* mjs, void*);
 struct gc_block {
     struct gc_block* next;
     struct gc_cell* base;
+    uint32_t* marks; /* Mark bits, one per cell */
     size_t size;
 };
 
@@ -27,6 +28,10 @@ struct gc_arena {
     size_t size_increment;
     struct gc_cell* free; /* head of free list */
     size_t cell_size;
+    struct gc_block* sweep; /* next block to sweep, NULL if there is none */
+    struct gc_block** index; /* blocks sorted by address, to look cells up */
+    size_t index_len;
+    size_t index_size;
 
 #if MJS_MEMORY_STATS
     unsigned long allocations; /* cumulative counter of allocations */
@@ -21,19 +21,6 @@ MJS_PRIVATE mjs_val_t mjs_object_to_value(struct mjs_object* o) {
     }
 }
 
-MJS_PRIVATE void mjs_obj_destructor(struct mjs* mjs, void* cell) {
-    struct mjs_object* obj = cell;
-    mjs_val_t obj_val = mjs_object_to_value(obj);
-
-    struct mjs_property* destructor = mjs_get_own_property(
-        mjs, obj_val, MJS_DESTRUCTOR_PROP_NAME, strlen(MJS_DESTRUCTOR_PROP_NAME));
-    if(!destructor) return;
-    if(!mjs_is_foreign(destructor->value)) return;
-
-    mjs_custom_obj_destructor_t destructor_fn = mjs_get_ptr(mjs, destructor->value);
-    if(destructor_fn) destructor_fn(mjs, obj_val);
-}
-
 MJS_PRIVATE struct mjs_object* get_object_struct(mjs_val_t v) {
     struct mjs_object* ret = NULL;
     if(mjs_is_null(v)) {
@@ -52,6 +39,7 @@ mjs_val_t mjs_mk_object(struct mjs* mjs) {
     }
     (void)mjs;
     o->properties = NULL;
+    o->index = NULL;
     return mjs_object_to_value(o);
 }
 
@@ -64,30 +52,236 @@ int mjs_is_object_based(mjs_val_t v) {
            ((v & MJS_TAG_MASK) == MJS_TAG_ARRAY_BUF_VIEW);
 }
 
+/*
+ * Open addressing hash table of object properties. Slot count is a power of
+ * two, table is kept at most half full.
+ */
+struct mjs_property_index_slot {
+    uint32_t hash;
+    struct mjs_property* prop;
+};
+
+struct mjs_property_index {
+    uint32_t size;
+    uint32_t count;
+    struct mjs_property_index_slot slots[];
+};
+
+#define MJS_PROPERTY_INDEX_MIN_SIZE 16
+
+static uint32_t mjs_property_name_hash(const char* name, size_t len) {
+    /* FNV-1a */
+    uint32_t hash = 2166136261U;
+    for(size_t i = 0; i < len; i++) {
+        hash ^= (uint8_t)name[i];
+        hash *= 16777619U;
+    }
+    return hash;
+}
+
+static struct mjs_property_index* mjs_property_index_alloc(uint32_t size) {
+    struct mjs_property_index* index =
+        calloc(1, sizeof(*index) + size * sizeof(struct mjs_property_index_slot));
+    index->size = size;
+    return index;
+}
+
+static void mjs_property_index_insert(
+    struct mjs_property_index* index,
+    uint32_t hash,
+    struct mjs_property* prop) {
+    uint32_t mask = index->size - 1;
+    uint32_t i = hash & mask;
+    while(index->slots[i].prop != NULL) {
+        i = (i + 1) & mask;
+    }
+    index->slots[i].hash = hash;
+    index->slots[i].prop = prop;
+    index->count++;
+}
+
+static uint32_t mjs_property_hash(struct mjs* mjs, struct mjs_property* prop) {
+    size_t len;
+    const char* name = mjs_get_string(mjs, &prop->name, &len);
+    return mjs_property_name_hash(name, len);
+}
+
+static void mjs_property_index_build(struct mjs* mjs, struct mjs_object* o) {
+    struct mjs_property* p;
+    uint32_t count = 0;
+    uint32_t size = MJS_PROPERTY_INDEX_MIN_SIZE;
+
+    for(p = o->properties; p != NULL; p = p->next) {
+        count++;
+    }
+    while(size < count * 2) {
+        size *= 2;
+    }
+
+    o->index = mjs_property_index_alloc(size);
+    for(p = o->properties; p != NULL; p = p->next) {
+        mjs_property_index_insert(o->index, mjs_property_hash(mjs, p), p);
+    }
+}
+
+static void mjs_property_index_add(struct mjs* mjs, struct mjs_object* o, struct mjs_property* p) {
+    struct mjs_property_index* index = o->index;
+
+    if((index->count + 1) * 2 > index->size) {
+        /* Grow: reinsert with stored hashes, names are not touched */
+        o->index = mjs_property_index_alloc(index->size * 2);
+        for(uint32_t i = 0; i < index->size; i++) {
+            if(index->slots[i].prop != NULL) {
+                mjs_property_index_insert(o->index, index->slots[i].hash, index->slots[i].prop);
+            }
+        }
+        free(index);
+    }
+
+    mjs_property_index_insert(o->index, mjs_property_hash(mjs, p), p);
+}
+
+static struct mjs_property* mjs_property_index_find(
+    struct mjs* mjs,
+    const struct mjs_property_index* index,
+    const char* name,
+    size_t len) {
+    uint32_t hash = mjs_property_name_hash(name, len);
+    uint32_t mask = index->size - 1;
+    for(uint32_t i = hash & mask; index->slots[i].prop != NULL; i = (i + 1) & mask) {
+        if(index->slots[i].hash == hash &&
+           mjs_strcmp(mjs, &index->slots[i].prop->name, name, len) == 0) {
+            return index->slots[i].prop;
+        }
+    }
+    return NULL;
+}
+
+static void mjs_property_index_free(struct mjs_object* o) {
+    free(o->index);
+    o->index = NULL;
+}
+
+static struct mjs_property* mjs_find_own_property(
+    struct mjs* mjs,
+    struct mjs_object* o,
+    const char* name,
+    size_t len,
+    size_t* visited) {
+    struct mjs_property* p;
+    size_t n = 0;
+
+    if(len <= 5) {
+        mjs_val_t ss = mjs_mk_string(mjs, name, len, 1);
+        for(p = o->properties; p != NULL; p = p->next, n++) {
+            if(p->name == ss) break;
+        }
+    } else {
+        for(p = o->properties; p != NULL; p = p->next, n++) {
+            if(mjs_strcmp(mjs, &p->name, name, len) == 0) break;
+        }
+    }
+
+    *visited = n;
+    return p;
+}
+
 MJS_PRIVATE struct mjs_property*
     mjs_get_own_property(struct mjs* mjs, mjs_val_t obj, const char* name, size_t len) {
     struct mjs_property* p;
     struct mjs_object* o;
+    size_t visited;
 
     if(!mjs_is_object_based(obj)) {
         return NULL;
     }
 
+    if(len == (size_t)~0) {
+        len = strlen(name);
+    }
+
     o = get_object_struct(obj);
 
-    if(len <= 5) {
-        mjs_val_t ss = mjs_mk_string(mjs, name, len, 1);
-        for(p = o->properties; p != NULL; p = p->next) {
-            if(p->name == ss) return p;
-        }
-    } else {
-        for(p = o->properties; p != NULL; p = p->next) {
-            if(mjs_strcmp(mjs, &p->name, name, len) == 0) return p;
-        }
-        return p;
+    if(o->index != NULL) {
+        return mjs_property_index_find(mjs, o->index, name, len);
     }
 
-    return NULL;
+    p = mjs_find_own_property(mjs, o, name, len, &visited);
+    if(visited >= MJS_PROPERTY_INDEX_THRESHOLD) {
+        mjs_property_index_build(mjs, o);
+    }
+
+    return p;
+}
+
+MJS_PRIVATE void mjs_obj_destructor(struct mjs* mjs, void* cell) {
+    struct mjs_object* obj = cell;
+    mjs_val_t obj_val = mjs_object_to_value(obj);
+    size_t visited;
+
+    /* Strings may be already gone when mjs is destroyed, don't hash the names */
+    mjs_property_index_free(obj);
+
+    struct mjs_property* destructor = mjs_find_own_property(
+        mjs, obj, MJS_DESTRUCTOR_PROP_NAME, strlen(MJS_DESTRUCTOR_PROP_NAME), &visited);
+    if(!destructor) return;
+    if(!mjs_is_foreign(destructor->value)) return;
+
+    mjs_custom_obj_destructor_t destructor_fn = mjs_get_ptr(mjs, destructor->value);
+    if(destructor_fn) destructor_fn(mjs, obj_val);
+}
+
+static int mjs_property_name_equal(struct mjs* mjs, mjs_val_t name, mjs_val_t key) {
+    size_t name_len, key_len;
+    const char* name_str;
+    const char* key_str;
+
+    if(name == key) return 1;
+
+    name_str = mjs_get_string(mjs, &name, &name_len);
+    key_str = mjs_get_string(mjs, &key, &key_len);
+    return name_len == key_len && memcmp(name_str, key_str, name_len) == 0;
+}
+
+MJS_PRIVATE struct mjs_property*
+    mjs_get_own_property_cached(struct mjs* mjs, mjs_val_t obj, mjs_val_t key, const void* site) {
+    struct mjs_property_cache_entry* entry;
+    struct mjs_object* o;
+    struct mjs_property* p;
+    const char* name;
+    size_t len;
+
+    /* Only plain objects: arrays and friends have builtin properties */
+    if((obj & MJS_TAG_MASK) != MJS_TAG_OBJECT || !mjs_is_string(key)) {
+        return NULL;
+    }
+
+    o = get_object_struct(obj);
+    entry = &mjs->property_cache[(uintptr_t)site % MJS_PROPERTY_CACHE_SIZE];
+    if(entry->site == site && entry->obj == o && entry->epoch == mjs->property_epoch &&
+       mjs_property_name_equal(mjs, entry->prop->name, key)) {
+        return entry->prop;
+    }
+
+    name = mjs_get_string(mjs, &key, &len);
+    /* Builtin, takes precedence over own property, see getprop_builtin() */
+    if(len == 5 && strncmp(name, "apply", len) == 0) {
+        return NULL;
+    }
+
+    p = mjs_get_own_property(mjs, obj, name, len);
+    if(p != NULL) {
+        entry->site = site;
+        entry->obj = o;
+        entry->prop = p;
+        entry->epoch = mjs->property_epoch;
+    }
+
+    return p;
+}
+
+MJS_PRIVATE void mjs_property_cache_invalidate(struct mjs* mjs) {
+    mjs->property_epoch++;
 }
 
 MJS_PRIVATE struct mjs_property*
@@ -213,8 +407,12 @@ MJS_PRIVATE mjs_err_t mjs_set_internal(
         o = get_object_struct(obj);
         p->next = o->properties;
         o->properties = p;
+        if(o->index != NULL) {
+            mjs_property_index_add(mjs, o, p);
+        }
     }
 
+    gc_write_barrier(mjs, p->value);
     p->value = val;
 
 clean:
@@ -246,11 +444,15 @@ int mjs_del(struct mjs* mjs, mjs_val_t obj, const char* name, size_t len) {
         size_t n;
         const char* s = mjs_get_string(mjs, &prop->name, &n);
         if(n == len && strncmp(s, name, len) == 0) {
+            gc_write_barrier(mjs, prop->value);
             if(prev) {
                 prev->next = prop->next;
             } else {
                 get_object_struct(obj)->properties = prop->next;
             }
+            /* Deletion is rare, index is rebuilt on demand */
+            mjs_property_index_free(get_object_struct(obj));
+            mjs_property_cache_invalidate(mjs);
             mjs_destroy_property(&prop);
             return 0;
         }
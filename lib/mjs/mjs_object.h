@@ -23,6 +23,27 @@ struct mjs_property {
 
 struct mjs_object {
     struct mjs_property* properties;
+    struct mjs_property_index* index; /* Hashed lookup, built for large objects */
+};
+
+/*
+ * Objects get a hashed property index once a lookup has to walk more than
+ * this many properties
+ */
+#ifndef MJS_PROPERTY_INDEX_THRESHOLD
+#define MJS_PROPERTY_INDEX_THRESHOLD 8
+#endif
+
+/* Number of property access sites cached by `mjs_get_own_property_cached()` */
+#ifndef MJS_PROPERTY_CACHE_SIZE
+#define MJS_PROPERTY_CACHE_SIZE 32
+#endif
+
+struct mjs_property_cache_entry {
+    const void* site; /* Bcode address of the property access */
+    struct mjs_object* obj;
+    struct mjs_property* prop;
+    uint32_t epoch;
 };
 
 MJS_PRIVATE struct mjs_object* get_object_struct(mjs_val_t v);
@@ -32,6 +53,20 @@ MJS_PRIVATE struct mjs_property*
 MJS_PRIVATE struct mjs_property*
     mjs_get_own_property_v(struct mjs* mjs, mjs_val_t obj, mjs_val_t key);
 
+/*
+ * Inline cached lookup of own property of a plain object for a property
+ * access site. Returns NULL if property was not found, or if the lookup has
+ * to take the generic path (non-string key, builtin property, etc).
+ */
+MJS_PRIVATE struct mjs_property*
+    mjs_get_own_property_cached(struct mjs* mjs, mjs_val_t obj, mjs_val_t key, const void* site);
+
+/*
+ * Invalidate all cached property lookups, must be called when properties are
+ * removed. Entries of objects freed by GC are dropped by GC itself.
+ */
+MJS_PRIVATE void mjs_property_cache_invalidate(struct mjs* mjs);
+
 /*
  * A worker function for `mjs_set()` and `mjs_set_v()`: it takes name as both
  * ptr+len and mjs_val_t. If `name` pointer is not NULL, it takes precedence
@@ -1,6 +1,7 @@
 #include "iso14443_crc.h"
 
 #include <core/check.h>
+#include <toolbox/crc.h>
 
 #define ISO14443_3A_CRC_INIT (0x6363U)
 #define ISO14443_3B_CRC_INIT (0xFFFFU)
@@ -17,12 +18,7 @@ static uint16_t
         furi_crash("Wrong ISO14443 CRC type");
     }
 
-    for(size_t i = 0; i < data_size; i++) {
-        uint8_t byte = data[i];
-        byte ^= (uint8_t)(crc & 0xff);
-        byte ^= byte << 4;
-        crc = (crc >> 8) ^ (((uint16_t)byte) << 8) ^ (((uint16_t)byte) << 3) ^ (byte >> 4);
-    }
+    crc = crc_update(CrcEngine16Poly1021Reflected, crc, data, data_size);
 
     return type == Iso14443CrcTypeA ? crc : ~crc;
 }
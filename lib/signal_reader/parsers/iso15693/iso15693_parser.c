@@ -1,4 +1,5 @@
 #include "iso15693_parser.h"
+#include "iso15693_parser_i.h"
 
 #include <toolbox/bit_buffer.h>
 
@@ -60,6 +61,14 @@ typedef enum {
 
 typedef Iso15693ParserCommand (*Iso15693ParserStateHandler)(Iso15693Parser* instance);
 
+// Symbol + 1 for every valid 1 out of 4 code, one pulse in one of four two-sample slots
+static const uint8_t iso15693_parser_1_out_of_4_codes[256] = {
+    [0x02] = 1,
+    [0x08] = 2,
+    [0x20] = 3,
+    [0x80] = 4,
+};
+
 Iso15693Parser* iso15693_parser_alloc(const GpioPin* pin, size_t max_frame_size) {
     Iso15693Parser* instance = malloc(sizeof(Iso15693Parser));
     instance->parsed_frame = bit_buffer_alloc(max_frame_size);
@@ -179,29 +188,52 @@ void iso15693_parser_stop(Iso15693Parser* instance) {
     signal_reader_stop(instance->signal_reader);
 }
 
+void iso15693_parser_feed(Iso15693Parser* instance, uint8_t sample) {
+    furi_assert(instance);
+
+    SignalReaderEventData data = {.data = &sample, .len = 1};
+    SignalReaderEvent event = {.type = SignalReaderEventTypeHalfBufferFilled, .data = &data};
+    signal_reader_callback(event, instance);
+}
+
 static Iso15693ParserCommand iso15693_parser_parse_1_out_of_4(Iso15693Parser* instance) {
     Iso15693ParserCommand command = Iso15693ParserCommandWaitData;
-    const uint8_t bit_patterns_1_out_of_4[] = {0x02, 0x08, 0x20, 0x80};
-
-    for(size_t i = 0; i < instance->bytes_to_process; i++) {
-        // Check next pattern
-        size_t j = 0;
-        for(j = 0; j < COUNT_OF(bit_patterns_1_out_of_4); j++) {
-            if(instance->bitstream_buff[i] == bit_patterns_1_out_of_4[j]) {
-                instance->next_byte |= j << (instance->next_byte_part * 2);
-                instance->next_byte_part++;
-                if(instance->next_byte_part == 4) {
-                    instance->next_byte_part = 0;
-                    bit_buffer_append_byte(instance->parsed_frame, instance->next_byte);
-                    instance->next_byte = 0;
-                }
-                break;
+    const size_t bytes_to_process = instance->bytes_to_process;
+    const uint8_t* bitstream = instance->bitstream_buff;
+    size_t i = 0;
+
+    while(i < bytes_to_process) {
+        // Whole output byte at once: four codes, first one in the least significant bits
+        if(instance->next_byte_part == 0 && bytes_to_process - i >= 4) {
+            const uint8_t code_0 = iso15693_parser_1_out_of_4_codes[bitstream[i]];
+            const uint8_t code_1 = iso15693_parser_1_out_of_4_codes[bitstream[i + 1]];
+            const uint8_t code_2 = iso15693_parser_1_out_of_4_codes[bitstream[i + 2]];
+            const uint8_t code_3 = iso15693_parser_1_out_of_4_codes[bitstream[i + 3]];
+
+            if(code_0 && code_1 && code_2 && code_3) {
+                bit_buffer_append_byte(
+                    instance->parsed_frame,
+                    (code_0 - 1) | ((code_1 - 1) << 2) | ((code_2 - 1) << 4) |
+                        ((code_3 - 1) << 6));
+                i += 4;
+                continue;
             }
         }
-        if(j == COUNT_OF(bit_patterns_1_out_of_4)) {
+
+        const uint8_t code = iso15693_parser_1_out_of_4_codes[bitstream[i]];
+        if(code == 0) {
             command = Iso15693ParserCommandFail;
             break;
         }
+
+        instance->next_byte |= (code - 1) << (instance->next_byte_part * 2);
+        instance->next_byte_part++;
+        if(instance->next_byte_part == 4) {
+            instance->next_byte_part = 0;
+            bit_buffer_append_byte(instance->parsed_frame, instance->next_byte);
+            instance->next_byte = 0;
+        }
+        i++;
     }
 
     if(command != Iso15693ParserCommandFail) {
@@ -219,11 +251,25 @@ static Iso15693ParserCommand iso15693_parser_parse_1_out_of_4(Iso15693Parser* in
 static Iso15693ParserCommand iso15693_parser_parse_1_out_of_256(Iso15693Parser* instance) {
     Iso15693ParserCommand command = Iso15693ParserCommandWaitData;
     const uint8_t eof = 0x04;
+    const size_t bytes_to_process = instance->bytes_to_process;
+    const uint8_t* bitstream = instance->bitstream_buff;
+    size_t i = instance->byte_idx;
+
+    while(i < bytes_to_process) {
+        // Most of the bytes carry no pulse, skip them a word at a time
+        if(bytes_to_process - i >= sizeof(uint32_t)) {
+            uint32_t word;
+            memcpy(&word, &bitstream[i], sizeof(uint32_t));
+            if(word == 0) {
+                instance->next_byte_part = (instance->next_byte_part + sizeof(uint32_t)) % 64;
+                i += sizeof(uint32_t);
+                continue;
+            }
+        }
 
-    for(size_t i = instance->byte_idx; i < instance->bytes_to_process; i++) {
         // Check EoF
         if(instance->next_byte_part == 0) {
-            if(instance->bitstream_buff[i] == eof) {
+            if(bitstream[i] == eof) {
                 instance->frame_parsed = true;
                 command = Iso15693ParserCommandSuccess;
                 break;
@@ -231,21 +277,22 @@ static Iso15693ParserCommand iso15693_parser_parse_1_out_of_256(Iso15693Parser*
         }
 
         if(instance->zero_found) {
-            if(instance->bitstream_buff[i] != 0x00) {
+            if(bitstream[i] != 0x00) {
                 command = Iso15693ParserCommandFail;
                 break;
             }
         } else {
-            if(instance->bitstream_buff[i] != 0x00) {
-                for(size_t j = 0; j < 8; j++) {
-                    if(FURI_BIT(instance->bitstream_buff[i], j) == 1) {
-                        bit_buffer_append_byte(
-                            instance->parsed_frame, instance->next_byte_part * 4 + j / 2);
-                    }
-                }
+            // Every set bit is a pulse, two samples per slot
+            uint32_t pulses = bitstream[i];
+            while(pulses) {
+                const uint8_t slot = __builtin_ctz(pulses) / 2;
+                bit_buffer_append_byte(
+                    instance->parsed_frame, instance->next_byte_part * 4 + slot);
+                pulses &= pulses - 1;
             }
         }
         instance->next_byte_part = (instance->next_byte_part + 1) % 64;
+        i++;
     }
     instance->bytes_to_process = 0;
     instance->byte_idx = 0;
@@ -0,0 +1,21 @@
+/**
+ * @file iso15693_parser_i.h
+ * @brief Iso15693Parser private definitions.
+ *
+ * This file is an implementation detail. It must not be included in
+ * any public API-related headers.
+ */
+#pragma once
+
+#include "iso15693_parser.h"
+
+/**
+ * @brief Pass a sample to the parser as if it came from the signal reader, meant for testing.
+ *
+ * The parser must be started. Same as with the signal reader, iso15693_parser_run() must be
+ * called every time the parser callback fires, before feeding the next sample.
+ *
+ * @param[in,out] instance pointer to the parser instance.
+ * @param[in] sample bitstream byte, as produced by the signal reader.
+ */
+void iso15693_parser_feed(Iso15693Parser* instance, uint8_t sample);
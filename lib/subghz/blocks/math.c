@@ -1,5 +1,7 @@
 #include "math.h"
 
+#include <lib/toolbox/crc.h>
+
 uint64_t subghz_protocol_blocks_reverse_key(uint64_t key, uint8_t bit_count) {
     uint64_t reverse_key = 0;
     for(uint8_t i = 0; i < bit_count; i++) {
@@ -64,6 +66,11 @@ uint8_t subghz_protocol_blocks_crc8(
     size_t size,
     uint8_t polynomial,
     uint8_t init) {
+    CrcEngine engine;
+    if(crc_engine_find(8, polynomial, false, &engine)) {
+        return crc_update(engine, init, message, size);
+    }
+
     uint8_t remainder = init;
 
     for(size_t byte = 0; byte < size; ++byte) {
@@ -105,6 +112,11 @@ uint16_t subghz_protocol_blocks_crc16lsb(
     size_t size,
     uint16_t polynomial,
     uint16_t init) {
+    CrcEngine engine;
+    if(crc_engine_find(16, subghz_protocol_blocks_reverse_key(polynomial, 16), true, &engine)) {
+        return crc_update(engine, init, message, size);
+    }
+
     uint16_t remainder = init;
 
     for(size_t byte = 0; byte < size; ++byte) {
@@ -125,6 +137,11 @@ uint16_t subghz_protocol_blocks_crc16(
     size_t size,
     uint16_t polynomial,
     uint16_t init) {
+    CrcEngine engine;
+    if(crc_engine_find(16, polynomial, false, &engine)) {
+        return crc_update(engine, init, message, size);
+    }
+
     uint16_t remainder = init;
 
     for(size_t byte = 0; byte < size; ++byte) {
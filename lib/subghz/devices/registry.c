@@ -21,6 +21,8 @@ void subghz_device_registry_init(void) {
         SUBGHZ_RADIO_DEVICE_PLUGIN_APP_ID,
         SUBGHZ_RADIO_DEVICE_PLUGIN_API_VERSION,
         firmware_api_interface);
+    // Device plugins allocate their state on begin and free it on end
+    plugin_manager_set_shared(subghz_device->manager, true);
 
     //TODO FL-3556: fix path to plugins
     if(plugin_manager_load_all(subghz_device->manager, EXT_PATH("apps_data/subghz/plugins")) !=
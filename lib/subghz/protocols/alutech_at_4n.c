@@ -5,6 +5,8 @@
 #include "../blocks/generic.h"
 #include "../blocks/math.h"
 
+#include <lib/toolbox/crc.h>
+
 #define TAG "SubGhzProtocoAlutechAt4n"
 
 #define SUBGHZ_NO_ALUTECH_AT_4N_RAINBOW_TABLE 0xFFFFFFFF
@@ -100,33 +102,11 @@ static uint32_t subghz_protocol_alutech_at_4n_get_magic_data_in_file(
 }
 
 static uint8_t subghz_protocol_alutech_at_4n_crc(uint64_t data) {
-    uint8_t* p = (uint8_t*)&data;
-    uint8_t crc = 0xff;
-    for(uint8_t y = 0; y < 8; y++) {
-        crc = crc ^ p[y];
-        for(uint8_t i = 0; i < 8; i++) {
-            if((crc & 0x80) != 0) {
-                crc <<= 1;
-                crc ^= 0x31;
-            } else {
-                crc <<= 1;
-            }
-        }
-    }
-    return crc;
+    return crc_update(CrcEngine8Poly31, 0xff, &data, sizeof(data));
 }
 
 static uint8_t subghz_protocol_alutech_at_4n_decrypt_data_crc(uint8_t data) {
-    uint8_t crc = data;
-    for(uint8_t i = 0; i < 8; i++) {
-        if((crc & 0x80) != 0) {
-            crc <<= 1;
-            crc ^= 0x31;
-        } else {
-            crc <<= 1;
-        }
-    }
-    return ~crc;
+    return ~crc_update(CrcEngine8Poly31, 0x00, &data, sizeof(data));
 }
 
 static uint64_t subghz_protocol_alutech_at_4n_decrypt(uint64_t data, const char* file_name) {
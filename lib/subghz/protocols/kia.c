@@ -6,6 +6,8 @@
 #include "../blocks/generic.h"
 #include "../blocks/math.h"
 
+#include <lib/toolbox/crc.h>
+
 #define TAG "SubGhzProtocoKia"
 
 static const SubGhzBlockConst subghz_protocol_kia_const = {
@@ -190,18 +192,7 @@ void subghz_protocol_decoder_kia_feed(void* context, bool level, uint32_t durati
 }
 
 uint8_t subghz_protocol_kia_crc8(uint8_t* data, size_t len) {
-    uint8_t crc = 0x08;
-    size_t i, j;
-    for(i = 0; i < len; i++) {
-        crc ^= data[i];
-        for(j = 0; j < 8; j++) {
-            if((crc & 0x80) != 0)
-                crc = (uint8_t)((crc << 1) ^ 0x7F);
-            else
-                crc <<= 1;
-        }
-    }
-    return crc;
+    return crc_update(CrcEngine8Poly7F, 0x08, data, len);
 }
 
 /** 
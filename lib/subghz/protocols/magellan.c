@@ -6,6 +6,8 @@
 #include "../blocks/generic.h"
 #include "../blocks/math.h"
 
+#include <lib/toolbox/crc.h>
+
 #define TAG "SubGhzProtocolMagellan"
 
 static const SubGhzBlockConst subghz_protocol_magellan_const = {
@@ -221,18 +223,7 @@ void subghz_protocol_decoder_magellan_reset(void* context) {
 }
 
 uint8_t subghz_protocol_magellan_crc8(uint8_t* data, size_t len) {
-    uint8_t crc = 0x00;
-    size_t i, j;
-    for(i = 0; i < len; i++) {
-        crc ^= data[i];
-        for(j = 0; j < 8; j++) {
-            if((crc & 0x80) != 0)
-                crc = (uint8_t)((crc << 1) ^ 0x31);
-            else
-                crc <<= 1;
-        }
-    }
-    return crc;
+    return crc_update(CrcEngine8Poly31, 0x00, data, len);
 }
 
 static bool subghz_protocol_magellan_check_crc(SubGhzProtocolDecoderMagellan* instance) {
@@ -1,6 +1,7 @@
 #include "marantec.h"
 #include <lib/toolbox/manchester_decoder.h>
 #include <lib/toolbox/manchester_encoder.h>
+#include <lib/toolbox/crc.h>
 #include "../blocks/const.h"
 #include "../blocks/decoder.h"
 #include "../blocks/encoder.h"
@@ -165,18 +166,7 @@ static void subghz_protocol_encoder_marantec_get_upload(SubGhzProtocolEncoderMar
 }
 
 uint8_t subghz_protocol_marantec_crc8(uint8_t* data, size_t len) {
-    uint8_t crc = 0x08;
-    size_t i, j;
-    for(i = 0; i < len; i++) {
-        crc ^= data[i];
-        for(j = 0; j < 8; j++) {
-            if((crc & 0x80) != 0)
-                crc = (uint8_t)((crc << 1) ^ 0x1D);
-            else
-                crc <<= 1;
-        }
-    }
-    return crc;
+    return crc_update(CrcEngine8Poly1D, 0x08, data, len);
 }
 
 /** 
@@ -8,7 +8,8 @@
 
 #define TAG "SubGhzFileEncoderWorker"
 
-#define SUBGHZ_FILE_ENCODER_LOAD 512
+#define SUBGHZ_FILE_ENCODER_LOAD  512
+#define SUBGHZ_FILE_ENCODER_BATCH 64
 
 struct SubGhzFileEncoderWorker {
     FuriThread* thread;
@@ -45,6 +46,14 @@ void subghz_file_encoder_worker_add_level_duration(
     if(sizeof(int32_t) != ret) FURI_LOG_E(TAG, "Invalid add duration in the stream");
 }
 
+static void subghz_file_encoder_worker_add_level_duration_batch(
+    SubGhzFileEncoderWorker* instance,
+    const int32_t* durations,
+    size_t count) {
+    size_t ret = furi_stream_buffer_send_batch(instance->stream, durations, count, 100);
+    if(count != ret) FURI_LOG_E(TAG, "Invalid add duration batch in the stream");
+}
+
 bool subghz_file_encoder_worker_data_parse(SubGhzFileEncoderWorker* instance, const char* strStart) {
     // Line sample: "RAW_Data: -1, 2, -2..."
 
@@ -56,12 +65,19 @@ bool subghz_file_encoder_worker_data_parse(SubGhzFileEncoderWorker* instance, co
         // Skip key
         str = strchr(str, ' ');
 
-        // Parse next element
-        int32_t duration;
-        while(strint_to_int32(str, &str, &duration, 10) == StrintParseNoError) {
-            subghz_file_encoder_worker_add_level_duration(instance, duration);
+        // Parse elements in batches: one stream write and one consumer wakeup per batch
+        int32_t durations[SUBGHZ_FILE_ENCODER_BATCH];
+        size_t count = 0;
+        while(strint_to_int32(str, &str, &durations[count], 10) == StrintParseNoError) {
+            if(++count == SUBGHZ_FILE_ENCODER_BATCH) {
+                subghz_file_encoder_worker_add_level_duration_batch(instance, durations, count);
+                count = 0;
+            }
             if(*str == ',') str++; // could also be `\0`
         }
+        if(count) {
+            subghz_file_encoder_worker_add_level_duration_batch(instance, durations, count);
+        }
 
         res = true;
     }
@@ -171,7 +187,8 @@ SubGhzFileEncoderWorker* subghz_file_encoder_worker_alloc(void) {
 
     instance->thread =
         furi_thread_alloc_ex("SubGhzFEWorker", 2048, subghz_file_encoder_worker_thread, instance);
-    instance->stream = furi_stream_buffer_alloc(sizeof(int32_t) * 2048, sizeof(int32_t));
+    instance->stream =
+        furi_stream_buffer_alloc_ex(sizeof(int32_t) * 2048, sizeof(int32_t), sizeof(int32_t));
 
     instance->storage = furi_record_open(RECORD_STORAGE);
     instance->flipper_format = flipper_format_file_alloc(instance->storage);
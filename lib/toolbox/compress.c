@@ -1,6 +1,7 @@
 #include "compress.h"
 
 #include <furi.h>
+#include <m-dict.h>
 #include <lib/heatshrink/heatshrink_encoder.h>
 #include <lib/heatshrink/heatshrink_decoder.h>
 #include <stdint.h>
@@ -38,10 +39,32 @@ typedef struct {
 
 _Static_assert(sizeof(CompressHeader) == 4, "Incorrect CompressHeader size");
 
+typedef struct CompressIconCacheEntry CompressIconCacheEntry;
+
+struct CompressIconCacheEntry {
+    CompressIconCacheEntry* prev;
+    CompressIconCacheEntry* next;
+    const uint8_t* icon_data;
+    size_t size;
+    uint8_t data[];
+};
+
+DICT_DEF2(
+    CompressIconCacheDict,
+    uint32_t,
+    M_DEFAULT_OPLIST,
+    CompressIconCacheEntry*,
+    M_PTR_OPLIST)
+
 struct CompressIcon {
     heatshrink_decoder* decoder;
     uint8_t* buffer;
     size_t buffer_size;
+    /* Decoded frame cache, zero size_max in stats means no cache */
+    CompressIconCacheDict_t index; /* Entries by icon data address */
+    CompressIconCacheEntry* head; /* Most recently used */
+    CompressIconCacheEntry* tail; /* Least recently used */
+    CompressIconCacheStats stats;
 };
 
 CompressIcon* compress_icon_alloc(size_t decode_buf_size) {
@@ -58,13 +81,133 @@ CompressIcon* compress_icon_alloc(size_t decode_buf_size) {
     return instance;
 }
 
+CompressIcon* compress_icon_alloc_cached(size_t decode_buf_size, size_t cache_size) {
+    furi_check(cache_size);
+
+    CompressIcon* instance = compress_icon_alloc(decode_buf_size);
+    CompressIconCacheDict_init(instance->index);
+    instance->stats.size_max = cache_size;
+
+    return instance;
+}
+
 void compress_icon_free(CompressIcon* instance) {
     furi_check(instance);
+
+    if(instance->stats.size_max) {
+        while(instance->head) {
+            CompressIconCacheEntry* entry = instance->head;
+            instance->head = entry->next;
+            free(entry);
+        }
+        CompressIconCacheDict_clear(instance->index);
+    }
+
     free(instance->buffer);
     heatshrink_decoder_free(instance->decoder);
     free(instance);
 }
 
+static size_t compress_icon_decode_buffer(CompressIcon* instance, const uint8_t* icon_data) {
+    const CompressHeader* header = (const CompressHeader*)icon_data;
+    size_t decoded_size = 0;
+    /* If decompression fails - check that decode_buf_size is large enough */
+    furi_check(compress_decode_internal(
+        instance->decoder,
+        icon_data,
+        /* Decoder will check/process headers again - need to pass them */
+        sizeof(CompressHeader) + header->compressed_buff_size,
+        instance->buffer,
+        instance->buffer_size,
+        &decoded_size));
+    return decoded_size;
+}
+
+static void compress_icon_cache_unlink(CompressIcon* instance, CompressIconCacheEntry* entry) {
+    if(entry->prev) {
+        entry->prev->next = entry->next;
+    } else {
+        instance->head = entry->next;
+    }
+
+    if(entry->next) {
+        entry->next->prev = entry->prev;
+    } else {
+        instance->tail = entry->prev;
+    }
+
+    entry->prev = NULL;
+    entry->next = NULL;
+}
+
+static void compress_icon_cache_push_front(CompressIcon* instance, CompressIconCacheEntry* entry) {
+    entry->next = instance->head;
+    if(instance->head) {
+        instance->head->prev = entry;
+    } else {
+        instance->tail = entry;
+    }
+    instance->head = entry;
+}
+
+static CompressIconCacheEntry*
+    compress_icon_cache_find(CompressIcon* instance, const uint8_t* icon_data) {
+    CompressIconCacheEntry** entry_ptr =
+        CompressIconCacheDict_get(instance->index, (uint32_t)icon_data);
+    if(!entry_ptr) return NULL;
+
+    CompressIconCacheEntry* entry = *entry_ptr;
+    if(entry != instance->head) {
+        compress_icon_cache_unlink(instance, entry);
+        compress_icon_cache_push_front(instance, entry);
+    }
+
+    return entry;
+}
+
+static void compress_icon_cache_evict(CompressIcon* instance, size_t size) {
+    while(instance->tail && instance->stats.size + size > instance->stats.size_max) {
+        CompressIconCacheEntry* entry = instance->tail;
+        compress_icon_cache_unlink(instance, entry);
+        CompressIconCacheDict_erase(instance->index, (uint32_t)entry->icon_data);
+        instance->stats.size -= entry->size;
+        instance->stats.evictions++;
+        free(entry);
+    }
+}
+
+/* Leaves decoded data in decoder buffer if frame doesn't fit into cache */
+static CompressIconCacheEntry*
+    compress_icon_cache_get(CompressIcon* instance, const uint8_t* icon_data) {
+    CompressIconCacheEntry* entry = compress_icon_cache_find(instance, icon_data);
+
+    if(entry) {
+        instance->stats.hits++;
+        return entry;
+    }
+
+    instance->stats.misses++;
+    const size_t decoded_size = compress_icon_decode_buffer(instance, icon_data);
+
+    const size_t size = sizeof(CompressIconCacheEntry) + decoded_size;
+    if(size > instance->stats.size_max) {
+        return NULL;
+    }
+
+    compress_icon_cache_evict(instance, size);
+
+    entry = malloc(size);
+    entry->icon_data = icon_data;
+    entry->size = size;
+    memcpy(entry->data, instance->buffer, decoded_size);
+
+    compress_icon_cache_push_front(instance, entry);
+    CompressIconCacheDict_set_at(instance->index, (uint32_t)icon_data, entry);
+    instance->stats.size += size;
+
+    return entry;
+}
+
 void compress_icon_decode(CompressIcon* instance, const uint8_t* icon_data, uint8_t** output) {
     furi_check(instance);
     furi_check(icon_data);
@@ -72,22 +215,37 @@ void compress_icon_decode(CompressIcon* instance, const uint8_t* icon_data, uint
 
     CompressHeader* header = (CompressHeader*)icon_data;
     if(header->is_compressed) {
-        size_t decoded_size = 0;
-        /* If decompression fails - check that decode_buf_size is large enough */
-        furi_check(compress_decode_internal(
-            instance->decoder,
-            icon_data,
-            /* Decoder will check/process headers again - need to pass them */
-            sizeof(CompressHeader) + header->compressed_buff_size,
-            instance->buffer,
-            instance->buffer_size,
-            &decoded_size));
+        compress_icon_decode_buffer(instance, icon_data);
         *output = instance->buffer;
     } else {
         *output = (uint8_t*)&icon_data[1];
     }
 }
 
+void compress_icon_decode_cached(
+    CompressIcon* instance,
+    const uint8_t* icon_data,
+    uint8_t** output) {
+    furi_check(instance);
+    furi_check(icon_data);
+    furi_check(output);
+
+    CompressHeader* header = (CompressHeader*)icon_data;
+    if(header->is_compressed && instance->stats.size_max) {
+        CompressIconCacheEntry* entry = compress_icon_cache_get(instance, icon_data);
+        *output = entry ? entry->data : instance->buffer;
+    } else {
+        compress_icon_decode(instance, icon_data, output);
+    }
+}
+
+void compress_icon_get_cache_stats(CompressIcon* instance, CompressIconCacheStats* stats) {
+    furi_check(instance);
+    furi_check(stats);
+
+    *stats = instance->stats;
+}
+
 struct Compress {
     const void* config;
     heatshrink_encoder* encoder;
@@ -15,6 +15,15 @@ extern "C" {
 /** Compress Icon control structure */
 typedef struct CompressIcon CompressIcon;
 
+/** Compress Icon decoded frame cache statistics */
+typedef struct {
+    uint32_t hits; /**< Lookups served from cache */
+    uint32_t misses; /**< Lookups that required decoding */
+    uint32_t evictions; /**< Frames dropped to stay within memory budget */
+    size_t size; /**< Memory used by cached frames, bytes */
+    size_t size_max; /**< Cache memory budget, bytes */
+} CompressIconCacheStats;
+
 /** Initialize icon compressor
  *
  * @param[in]  decode_buf_size  The icon buffer size for decoding. Ensure that
@@ -25,6 +34,19 @@ typedef struct CompressIcon CompressIcon;
  */
 CompressIcon* compress_icon_alloc(size_t decode_buf_size);
 
+/** Initialize icon compressor with decoded frame cache
+ *
+ * Frames decoded with `compress_icon_decode_cached` are kept in least
+ * recently used order, keyed by icon data pointer.
+ *
+ * @param[in]  decode_buf_size  The icon buffer size for decoding, same as
+ *                              for `compress_icon_alloc`
+ * @param[in]  cache_size       Memory budget for cached frames, bytes
+ *
+ * @return     Compress Icon instance
+ */
+CompressIcon* compress_icon_alloc_cached(size_t decode_buf_size, size_t cache_size);
+
 /** Free icon compressor
  *
  * @param      instance  The Compress Icon instance
@@ -44,6 +66,33 @@ void compress_icon_free(CompressIcon* instance);
  */
 void compress_icon_decode(CompressIcon* instance, const uint8_t* icon_data, uint8_t** output);
 
+/** Decompress icon through decoded frame cache
+ *
+ * Same as `compress_icon_decode`, but decoded frame is kept in cache and
+ * reused on the next call with the same icon data pointer. Cache is keyed by
+ * pointer only: icon data must stay unchanged for the instance lifetime, which
+ * is true for assets in firmware image, but not for icons loaded to RAM.
+ * Without cache it is the same as `compress_icon_decode`.
+ *
+ * @warning    output is valid until the next decode call, instance is not
+ *             thread safe
+ *
+ * @param      instance   The Compress Icon instance
+ * @param      icon_data  pointer to icon data
+ * @param[in]  output     pointer to decoded buffer pointer
+ */
+void compress_icon_decode_cached(
+    CompressIcon* instance,
+    const uint8_t* icon_data,
+    uint8_t** output);
+
+/** Get decoded frame cache statistics
+ *
+ * @param      instance  The Compress Icon instance
+ * @param[out] stats     statistics, all zeroes if instance has no cache
+ */
+void compress_icon_get_cache_stats(CompressIcon* instance, CompressIconCacheStats* stats);
+
 //////////////////////////////////////////////////////////////////////////
 
 /** Compress control structure */
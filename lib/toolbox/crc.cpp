@@ -0,0 +1,181 @@
+#include "crc.h"
+
+#include <furi.h>
+#include <furi_hal_crc.h>
+
+#include <array>
+#include <cstring>
+
+// Smaller buffers are faster in software than locking the CRC unit
+#ifndef CRC_HARDWARE_SIZE_MIN
+#define CRC_HARDWARE_SIZE_MIN (64U)
+#endif
+
+static_assert(__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__, "Slice loads assume little endian");
+
+namespace {
+
+template <typename T>
+constexpr T crc_reflect(T value) {
+    T result = 0;
+    for(size_t bit = 0; bit < sizeof(T) * 8; bit++) {
+        result = T((result << 1) | ((value >> bit) & 1U));
+    }
+    return result;
+}
+
+template <typename T>
+inline T crc_byteswap(T value) {
+    if constexpr(sizeof(T) == sizeof(uint32_t)) {
+        return __builtin_bswap32(value);
+    } else if constexpr(sizeof(T) == sizeof(uint16_t)) {
+        return __builtin_bswap16(value);
+    } else {
+        return value;
+    }
+}
+
+/**
+ * @brief CRC kernel with lookup tables generated at compile time
+ *
+ * Slices == 1 is the classic byte-at-a-time table. Slices == sizeof(T) consumes
+ * a whole register width per step: every byte of the step is looked up in its own
+ * table, which already accounts for the bytes that follow it, so lookups are
+ * independent from each other and only one dependent XOR chain remains.
+ * Every slice costs 256 * sizeof(T) bytes of flash.
+ */
+template <typename T, T Polynomial, bool Reflected, size_t Slices>
+struct CrcKernel {
+    static_assert(Slices == 1 || Slices == sizeof(T), "Slices must be 1 or CRC width in bytes");
+
+    static constexpr uint8_t width = sizeof(T) * 8;
+    static constexpr T polynomial = Polynomial;
+    static constexpr bool reflected = Reflected;
+
+    using Slice = std::array<T, 256>;
+    using Table = std::array<Slice, Slices>;
+
+    static constexpr T shift_byte(const Slice& slice, T crc, uint8_t byte) {
+        if constexpr(Reflected) {
+            return T((crc >> 8) ^ slice[uint8_t(crc ^ byte)]);
+        } else {
+            return T((crc << 8) ^ slice[uint8_t((crc >> (width - 8)) ^ byte)]);
+        }
+    }
+
+    static constexpr Table make_table() {
+        constexpr T top_bit = T(1) << (width - 1);
+        constexpr T reflected_polynomial = crc_reflect(Polynomial);
+
+        Table table{};
+        for(size_t i = 0; i < 256; i++) {
+            T crc = Reflected ? T(i) : T(i << (width - 8));
+            for(size_t bit = 0; bit < 8; bit++) {
+                if constexpr(Reflected) {
+                    crc = (crc & 1U) ? T((crc >> 1) ^ reflected_polynomial) : T(crc >> 1);
+                } else {
+                    crc = (crc & top_bit) ? T((crc << 1) ^ Polynomial) : T(crc << 1);
+                }
+            }
+            table[0][i] = crc;
+        }
+
+        // Slice N is byte i followed by N zero bytes
+        for(size_t slice = 1; slice < Slices; slice++) {
+            for(size_t i = 0; i < 256; i++) {
+                table[slice][i] = shift_byte(table[0], table[slice - 1][i], 0);
+            }
+        }
+
+        return table;
+    }
+
+    static constexpr Table table = make_table();
+
+    static uint32_t update(uint32_t crc_in, const uint8_t* data, size_t size) {
+        T crc = T(crc_in);
+
+        if constexpr(Slices > 1) {
+            for(; size >= Slices; size -= Slices, data += Slices) {
+                T word;
+                memcpy(&word, data, sizeof(T));
+                if constexpr(!Reflected) {
+                    word = crc_byteswap(word);
+                }
+                crc ^= word;
+
+                T next = 0;
+                for(size_t i = 0; i < Slices; i++) {
+                    const uint8_t index = Reflected ? uint8_t(crc >> (8 * i)) :
+                                                      uint8_t(crc >> (8 * (Slices - 1 - i)));
+                    next ^= table[Slices - 1 - i][index];
+                }
+                crc = next;
+            }
+        }
+
+        for(; size > 0; size--, data++) {
+            crc = shift_byte(table[0], crc, *data);
+        }
+
+        return crc;
+    }
+};
+
+typedef uint32_t (*CrcEngineUpdate)(uint32_t crc, const uint8_t* data, size_t size);
+
+struct CrcEngineDescriptor {
+    uint8_t width;
+    bool reflected;
+    uint32_t polynomial;
+    CrcEngineUpdate update;
+};
+
+template <typename Kernel>
+constexpr CrcEngineDescriptor crc_engine_descriptor() {
+    return {Kernel::width, Kernel::reflected, Kernel::polynomial, Kernel::update};
+}
+
+// Same order as CrcEngine. Slicing is only used where throughput matters:
+// NFC frames for the reflected CCITT and files and firmware images for CRC-32.
+const std::array<CrcEngineDescriptor, CrcEngineNum> crc_engines = {
+    crc_engine_descriptor<CrcKernel<uint8_t, 0x1D, false, 1>>(),
+    crc_engine_descriptor<CrcKernel<uint8_t, 0x31, false, 1>>(),
+    crc_engine_descriptor<CrcKernel<uint8_t, 0x7F, false, 1>>(),
+    crc_engine_descriptor<CrcKernel<uint16_t, 0x1021, false, 1>>(),
+    crc_engine_descriptor<CrcKernel<uint16_t, 0x1021, true, 2>>(),
+    crc_engine_descriptor<CrcKernel<uint32_t, 0x04C11DB7, true, 4>>(),
+};
+
+} // namespace
+
+uint32_t crc_update(CrcEngine engine, uint32_t crc, const void* data, size_t size) {
+    furi_check(engine < CrcEngineNum);
+    furi_check(data || size == 0);
+
+    const uint8_t* bytes = static_cast<const uint8_t*>(data);
+
+    if(engine == CrcEngine32Poly04C11DB7Reflected && size >= CRC_HARDWARE_SIZE_MIN &&
+       furi_hal_crc_acquire(0)) {
+        crc = furi_hal_crc_crc32(crc, bytes, size);
+        furi_hal_crc_release();
+        return crc;
+    }
+
+    return crc_engines[engine].update(crc, bytes, size);
+}
+
+bool crc_engine_find(uint8_t width, uint32_t polynomial, bool reflected, CrcEngine* engine) {
+    furi_check(engine);
+
+    for(size_t i = 0; i < crc_engines.size(); i++) {
+        const CrcEngineDescriptor& descriptor = crc_engines[i];
+        if(descriptor.width == width && descriptor.polynomial == polynomial &&
+           descriptor.reflected == reflected) {
+            *engine = static_cast<CrcEngine>(i);
+            return true;
+        }
+    }
+
+    return false;
+}
@@ -0,0 +1,66 @@
+/**
+ * @file crc.h
+ *
+ * Table driven CRC engines
+ *
+ * Every engine is a polynomial with a lookup table generated at compile time.
+ * Engines only advance CRC register, initial value, final XOR and byte order
+ * of the result are protocol specific and stay with the caller:
+ *
+ *   // ISO14443-3A: init 0x6363, no final XOR
+ *   uint16_t crc = crc_update(CrcEngine16Poly1021Reflected, 0x6363, data, size);
+ *
+ *   // CRC-32: init and final XOR 0xFFFFFFFF
+ *   uint32_t crc = ~crc_update(CrcEngine32Poly04C11DB7Reflected, ~0U, data, size);
+ *
+ * Register of a reflected engine is kept reflected, as in the usual
+ * "shift right" implementations.
+ *
+ * CRC-32 of large buffers is offloaded to the CRC unit when it is available.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    CrcEngine8Poly1D, /**< CRC-8, poly 0x1D, MSB first */
+    CrcEngine8Poly31, /**< CRC-8, poly 0x31, MSB first */
+    CrcEngine8Poly7F, /**< CRC-8, poly 0x7F, MSB first */
+    CrcEngine16Poly1021, /**< CRC-16 CCITT, MSB first */
+    CrcEngine16Poly1021Reflected, /**< CRC-16 CCITT, LSB first, ISO14443/ISO13239 */
+    CrcEngine32Poly04C11DB7Reflected, /**< CRC-32 IEEE 802.3, LSB first */
+
+    CrcEngineNum,
+} CrcEngine;
+
+/** Advance CRC register over the data
+ *
+ * @param      engine  CRC engine
+ * @param      crc     current CRC register value, bits beyond engine width are ignored
+ * @param      data    pointer to the data, may be NULL if size is zero
+ * @param      size    data size in bytes
+ *
+ * @return     updated CRC register value
+ */
+uint32_t crc_update(CrcEngine engine, uint32_t crc, const void* data, size_t size);
+
+/** Find engine for runtime CRC parameters
+ *
+ * @param      width       CRC width in bits
+ * @param      polynomial  polynomial in normal (MSB first) notation, without top bit
+ * @param      reflected   true for LSB first engines
+ * @param[out] engine      found engine
+ *
+ * @return     true if there is an engine with such parameters
+ */
+bool crc_engine_find(uint8_t width, uint32_t polynomial, bool reflected, CrcEngine* engine);
+
+#ifdef __cplusplus
+}
+#endif
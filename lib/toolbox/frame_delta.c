@@ -0,0 +1,122 @@
+#include "frame_delta.h"
+
+#include <furi.h>
+
+#define FRAME_DELTA_TOKEN_SKIP    (0x80U)
+#define FRAME_DELTA_TOKEN_RUN_MAX (0x80U)
+
+/* Literal run is split only by at least this many unchanged bytes, shorter
+ * gaps cost less to send as part of literal run than as a separate token */
+#define FRAME_DELTA_SKIP_MIN (3U)
+
+static inline uint8_t
+    frame_delta_get_xor(const uint8_t* frame, const uint8_t* reference, size_t index) {
+    return reference ? frame[index] ^ reference[index] : frame[index];
+}
+
+static size_t frame_delta_get_skip_length(
+    const uint8_t* frame,
+    const uint8_t* reference,
+    size_t frame_size,
+    size_t index) {
+    size_t length = 0;
+    while(index + length < frame_size && !frame_delta_get_xor(frame, reference, index + length)) {
+        length++;
+    }
+    return length;
+}
+
+size_t frame_delta_get_max_size(size_t frame_size) {
+    // One control byte per literal run, skips never make output longer than input
+    return FRAME_DELTA_HEADER_SIZE + frame_size +
+           (frame_size + FRAME_DELTA_TOKEN_RUN_MAX - 1) / FRAME_DELTA_TOKEN_RUN_MAX;
+}
+
+size_t frame_delta_encode(
+    const uint8_t* frame,
+    const uint8_t* reference,
+    size_t frame_size,
+    uint16_t sequence,
+    uint8_t* output) {
+    furi_check(frame);
+    furi_check(output);
+
+    output[0] = FRAME_DELTA_MAGIC;
+    output[1] = reference ? FrameDeltaTypeDelta : FrameDeltaTypeKey;
+    output[2] = sequence & 0xFF;
+    output[3] = sequence >> 8;
+    size_t size = FRAME_DELTA_HEADER_SIZE;
+
+    size_t index = 0;
+    while(index < frame_size) {
+        size_t skip = frame_delta_get_skip_length(frame, reference, frame_size, index);
+
+        if(skip) {
+            index += skip;
+            // Trailing unchanged bytes need no token
+            if(index == frame_size) break;
+            while(skip) {
+                const size_t run = MIN(skip, FRAME_DELTA_TOKEN_RUN_MAX);
+                output[size++] = FRAME_DELTA_TOKEN_SKIP | (run - 1);
+                skip -= run;
+            }
+        }
+
+        // Literal run up to the next long enough gap
+        const size_t control = size++;
+        size_t run = 0;
+        while(index < frame_size && run < FRAME_DELTA_TOKEN_RUN_MAX) {
+            const uint8_t value = frame_delta_get_xor(frame, reference, index);
+            if(!value && frame_delta_get_skip_length(frame, reference, frame_size, index) >=
+                             MIN(FRAME_DELTA_SKIP_MIN, frame_size - index)) {
+                break;
+            }
+            output[size++] = value;
+            index++;
+            run++;
+        }
+        output[control] = run - 1;
+    }
+
+    return size;
+}
+
+bool frame_delta_decode(
+    const uint8_t* data,
+    size_t data_size,
+    uint8_t* frame,
+    size_t frame_size,
+    uint16_t* sequence) {
+    furi_check(data);
+    furi_check(frame);
+
+    if(data_size < FRAME_DELTA_HEADER_SIZE || data[0] != FRAME_DELTA_MAGIC) return false;
+
+    if(data[1] == FrameDeltaTypeKey) {
+        memset(frame, 0, frame_size);
+    } else if(data[1] != FrameDeltaTypeDelta) {
+        return false;
+    }
+
+    if(sequence) *sequence = data[2] | (data[3] << 8);
+
+    size_t position = FRAME_DELTA_HEADER_SIZE;
+    size_t index = 0;
+    while(position < data_size) {
+        const uint8_t control = data[position++];
+        const size_t run = (control & ~FRAME_DELTA_TOKEN_SKIP) + 1;
+
+        if(index + run > frame_size) return false;
+
+        if(control & FRAME_DELTA_TOKEN_SKIP) {
+            index += run;
+        } else {
+            if(position + run > data_size) return false;
+            for(size_t i = 0; i < run; i++) {
+                frame[index++] ^= data[position++];
+            }
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,79 @@
+/**
+ * @file frame_delta.h
+ * Framebuffer delta codec
+ *
+ * Encodes a frame as XOR against a reference frame, with runs of unchanged
+ * bytes collapsed. Used for screen streaming over slow transports.
+ *
+ * Encoded frame layout:
+ * - header: magic (0xFD), type (FrameDeltaType), sequence (uint16, little endian)
+ * - tokens: control byte `c`, then
+ *   - `c & 0x80`: (c & 0x7F) + 1 bytes are unchanged
+ *   - otherwise: c + 1 bytes follow, each XORed into the reference frame
+ *
+ * Key frames are encoded against all-zero reference frame.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define FRAME_DELTA_MAGIC       (0xFDU)
+#define FRAME_DELTA_HEADER_SIZE (4U)
+
+typedef enum {
+    FrameDeltaTypeKey = 0x00, /**< Self-contained frame */
+    FrameDeltaTypeDelta = 0x01, /**< Changes against previous frame */
+} FrameDeltaType;
+
+/** Get worst case encoded size
+ *
+ * @param      frame_size  frame size in bytes
+ *
+ * @return     maximum size of encoded frame, including header
+ */
+size_t frame_delta_get_max_size(size_t frame_size);
+
+/** Encode frame
+ *
+ * @param      frame        frame to encode
+ * @param      reference    frame previously delivered to the decoder, NULL to encode key frame
+ * @param      frame_size   size of both frames in bytes
+ * @param      sequence     frame sequence number, stored in header
+ * @param      output       output buffer, at least frame_delta_get_max_size(frame_size) bytes
+ *
+ * @return     encoded size in bytes
+ */
+size_t frame_delta_encode(
+    const uint8_t* frame,
+    const uint8_t* reference,
+    size_t frame_size,
+    uint16_t sequence,
+    uint8_t* output);
+
+/** Decode frame in place
+ *
+ * @param      data         encoded frame
+ * @param      data_size    encoded frame size in bytes
+ * @param      frame        previous frame, replaced with decoded one
+ * @param      frame_size   frame size in bytes
+ * @param[out] sequence     decoded frame sequence number, may be NULL
+ *
+ * @return     true on success, false if data is malformed. Frame content is
+ *             undefined on failure, decoder must wait for the next key frame.
+ */
+bool frame_delta_decode(
+    const uint8_t* data,
+    size_t data_size,
+    uint8_t* frame,
+    size_t frame_size,
+    uint16_t* sequence);
+
+#ifdef __cplusplus
+}
+#endif
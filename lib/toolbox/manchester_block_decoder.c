@@ -0,0 +1,281 @@
+#include "manchester_block_decoder.h"
+#include <furi.h>
+
+#define MANCHESTER_BLOCK_STATES (4)
+#define MANCHESTER_BLOCK_EVENTS (ManchesterEventReset / 2 + 1)
+
+#define MANCHESTER_BLOCK_CLOCK_GAIN (8)
+
+/* Step: next state, decoded bit count and decoded bits, first bit in LSB */
+#define STEP(state, count, bits) ((state) | ((count) << 2) | ((bits) << 4))
+#define STEP_GET_STATE(step)     ((step) & 0x3)
+#define STEP_GET_COUNT(step)     (((step) >> 2) & 0x3)
+#define STEP_GET_BITS(step)      ((step) >> 4)
+
+#define EVENT_INDEX(event) ((event) / 2)
+
+typedef uint8_t ManchesterBlockStep;
+typedef ManchesterBlockStep ManchesterBlockSteps[MANCHESTER_BLOCK_STATES][MANCHESTER_BLOCK_EVENTS];
+
+// Same transitions as manchester_advance(), invalid events go to ManchesterStateMid1
+static const ManchesterBlockSteps manchester_steps = {
+    [ManchesterStateStart1] =
+        {
+            [EVENT_INDEX(ManchesterEventShortLow)] = STEP(ManchesterStateMid1, 1, 1),
+            [EVENT_INDEX(ManchesterEventShortHigh)] = STEP(ManchesterStateMid1, 0, 0),
+            [EVENT_INDEX(ManchesterEventLongLow)] = STEP(ManchesterStateMid1, 0, 0),
+            [EVENT_INDEX(ManchesterEventLongHigh)] = STEP(ManchesterStateMid1, 0, 0),
+            [EVENT_INDEX(ManchesterEventReset)] = STEP(ManchesterStateMid1, 0, 0),
+        },
+    [ManchesterStateMid1] =
+        {
+            [EVENT_INDEX(ManchesterEventShortLow)] = STEP(ManchesterStateMid1, 0, 0),
+            [EVENT_INDEX(ManchesterEventShortHigh)] = STEP(ManchesterStateStart1, 0, 0),
+            [EVENT_INDEX(ManchesterEventLongLow)] = STEP(ManchesterStateMid1, 0, 0),
+            [EVENT_INDEX(ManchesterEventLongHigh)] = STEP(ManchesterStateMid0, 1, 0),
+            [EVENT_INDEX(ManchesterEventReset)] = STEP(ManchesterStateMid1, 0, 0),
+        },
+    [ManchesterStateMid0] =
+        {
+            [EVENT_INDEX(ManchesterEventShortLow)] = STEP(ManchesterStateStart0, 0, 0),
+            [EVENT_INDEX(ManchesterEventShortHigh)] = STEP(ManchesterStateMid1, 0, 0),
+            [EVENT_INDEX(ManchesterEventLongLow)] = STEP(ManchesterStateMid1, 1, 1),
+            [EVENT_INDEX(ManchesterEventLongHigh)] = STEP(ManchesterStateMid1, 0, 0),
+            [EVENT_INDEX(ManchesterEventReset)] = STEP(ManchesterStateMid1, 0, 0),
+        },
+    [ManchesterStateStart0] =
+        {
+            [EVENT_INDEX(ManchesterEventShortLow)] = STEP(ManchesterStateMid1, 0, 0),
+            [EVENT_INDEX(ManchesterEventShortHigh)] = STEP(ManchesterStateMid0, 1, 0),
+            [EVENT_INDEX(ManchesterEventLongLow)] = STEP(ManchesterStateMid1, 0, 0),
+            [EVENT_INDEX(ManchesterEventLongHigh)] = STEP(ManchesterStateMid1, 0, 0),
+            [EVENT_INDEX(ManchesterEventReset)] = STEP(ManchesterStateMid1, 0, 0),
+        },
+};
+
+// Differential codings don't depend on levels: short is half a bit, long is a whole bit
+typedef enum {
+    DifferentialStateMid, // Mid-bit transition, reset state
+    DifferentialStateStart, // Bit start transition
+} DifferentialState;
+
+#define DIFFERENTIAL_STEPS(short_step, long_step, reset_step) \
+    {                                                          \
+        [EVENT_INDEX(ManchesterEventShortLow)] = short_step,   \
+        [EVENT_INDEX(ManchesterEventShortHigh)] = short_step,  \
+        [EVENT_INDEX(ManchesterEventLongLow)] = long_step,     \
+        [EVENT_INDEX(ManchesterEventLongHigh)] = long_step,    \
+        [EVENT_INDEX(ManchesterEventReset)] = reset_step,      \
+    }
+
+static const ManchesterBlockSteps differential_steps = {
+    // Short: transition at the next bit start, so it is 0. Long: no transition, 1
+    [DifferentialStateMid] = DIFFERENTIAL_STEPS(
+        STEP(DifferentialStateStart, 1, 0),
+        STEP(DifferentialStateMid, 1, 1),
+        STEP(DifferentialStateMid, 0, 0)),
+    // Short: mid-bit of the same bit. Long: mid-bit transition is missing
+    [DifferentialStateStart] = DIFFERENTIAL_STEPS(
+        STEP(DifferentialStateMid, 0, 0),
+        STEP(DifferentialStateMid, 0, 0),
+        STEP(DifferentialStateMid, 0, 0)),
+    // Unused states
+    [2] = DIFFERENTIAL_STEPS(0, 0, 0),
+    [3] = DIFFERENTIAL_STEPS(0, 0, 0),
+};
+
+typedef enum {
+    BiphaseStateStart, // Bit start transition, reset state
+    BiphaseStateMid, // Mid-bit transition
+} BiphaseState;
+
+static const ManchesterBlockSteps biphase_steps = {
+    // Short: mid-bit transition, so it is 1. Long: no transition, 0
+    [BiphaseStateStart] = DIFFERENTIAL_STEPS(
+        STEP(BiphaseStateMid, 0, 0),
+        STEP(BiphaseStateStart, 1, 0),
+        STEP(BiphaseStateStart, 0, 0)),
+    // Short: next bit start. Long: bit start transition is missing
+    [BiphaseStateMid] = DIFFERENTIAL_STEPS(
+        STEP(BiphaseStateStart, 1, 1),
+        STEP(BiphaseStateStart, 0, 0),
+        STEP(BiphaseStateStart, 0, 0)),
+    // Unused states
+    [2] = DIFFERENTIAL_STEPS(0, 0, 0),
+    [3] = DIFFERENTIAL_STEPS(0, 0, 0),
+};
+
+struct ManchesterBlockDecoder {
+    const ManchesterBlockSteps* steps;
+    ManchesterBlockStep pair_steps[MANCHESTER_BLOCK_STATES][MANCHESTER_BLOCK_EVENTS]
+                                  [MANCHESTER_BLOCK_EVENTS];
+    uint8_t state;
+    uint8_t reset_state;
+
+    uint32_t half_period;
+    bool recovery;
+};
+
+ManchesterBlockDecoder* manchester_block_decoder_alloc(ManchesterBlockCoding coding) {
+    ManchesterBlockDecoder* decoder = malloc(sizeof(ManchesterBlockDecoder));
+
+    switch(coding) {
+    case ManchesterBlockCodingManchester:
+        decoder->steps = &manchester_steps;
+        decoder->reset_state = ManchesterStateMid1;
+        break;
+    case ManchesterBlockCodingDifferential:
+        decoder->steps = &differential_steps;
+        decoder->reset_state = DifferentialStateMid;
+        break;
+    case ManchesterBlockCodingBiphase:
+        decoder->steps = &biphase_steps;
+        decoder->reset_state = BiphaseStateStart;
+        break;
+    default:
+        furi_crash();
+    }
+
+    // Two events per lookup: second step starts from the state the first one ends in
+    for(size_t state = 0; state < MANCHESTER_BLOCK_STATES; state++) {
+        for(size_t first = 0; first < MANCHESTER_BLOCK_EVENTS; first++) {
+            const ManchesterBlockStep a = (*decoder->steps)[state][first];
+            for(size_t second = 0; second < MANCHESTER_BLOCK_EVENTS; second++) {
+                const ManchesterBlockStep b = (*decoder->steps)[STEP_GET_STATE(a)][second];
+                decoder->pair_steps[state][first][second] =
+                    STEP(STEP_GET_STATE(b),
+                         STEP_GET_COUNT(a) + STEP_GET_COUNT(b),
+                         STEP_GET_BITS(a) | (STEP_GET_BITS(b) << STEP_GET_COUNT(a)));
+            }
+        }
+    }
+
+    decoder->state = decoder->reset_state;
+
+    return decoder;
+}
+
+void manchester_block_decoder_free(ManchesterBlockDecoder* decoder) {
+    furi_check(decoder);
+    free(decoder);
+}
+
+void manchester_block_decoder_reset(ManchesterBlockDecoder* decoder) {
+    furi_check(decoder);
+    decoder->state = decoder->reset_state;
+}
+
+size_t manchester_block_decoder_decode(
+    ManchesterBlockDecoder* decoder,
+    const ManchesterEvent* events,
+    size_t count,
+    BitBuffer* bits) {
+    furi_check(decoder);
+    furi_check(events || count == 0);
+    furi_check(bits);
+
+    const size_t size = bit_buffer_get_size(bits);
+    const bool is_aligned = (size % 8) == 0;
+    size_t room = bit_buffer_get_capacity_bytes(bits) * 8 - size;
+
+    uint8_t state = decoder->state;
+    uint32_t acc = 0;
+    size_t acc_count = 0;
+    size_t index = 0;
+
+    while(index < count) {
+        ManchesterBlockStep step;
+
+        if(room >= 2 && index + 1 < count) {
+            step = decoder->pair_steps[state][EVENT_INDEX(events[index])]
+                                      [EVENT_INDEX(events[index + 1])];
+            index += 2;
+        } else if(room >= 1) {
+            step = (*decoder->steps)[state][EVENT_INDEX(events[index])];
+            index += 1;
+        } else {
+            break;
+        }
+
+        state = STEP_GET_STATE(step);
+        acc |= STEP_GET_BITS(step) << acc_count;
+        acc_count += STEP_GET_COUNT(step);
+        room -= STEP_GET_COUNT(step);
+
+        if(acc_count >= 8) {
+            if(is_aligned) {
+                bit_buffer_append_byte(bits, acc & 0xFF);
+            } else {
+                for(size_t i = 0; i < 8; i++) {
+                    bit_buffer_append_bit(bits, (acc >> i) & 1);
+                }
+            }
+            acc >>= 8;
+            acc_count -= 8;
+        }
+    }
+
+    for(size_t i = 0; i < acc_count; i++) {
+        bit_buffer_append_bit(bits, (acc >> i) & 1);
+    }
+
+    decoder->state = state;
+
+    return index;
+}
+
+void manchester_block_decoder_set_clock(
+    ManchesterBlockDecoder* decoder,
+    uint32_t half_period,
+    bool recovery) {
+    furi_check(decoder);
+    furi_check(half_period);
+
+    decoder->half_period = half_period;
+    decoder->recovery = recovery;
+}
+
+uint32_t manchester_block_decoder_get_clock(const ManchesterBlockDecoder* decoder) {
+    furi_check(decoder);
+    return decoder->half_period;
+}
+
+void manchester_block_decoder_classify(
+    ManchesterBlockDecoder* decoder,
+    const LevelDuration* durations,
+    size_t count,
+    ManchesterEvent* events) {
+    furi_check(decoder);
+    furi_check(decoder->half_period);
+    furi_check((durations && events) || count == 0);
+
+    uint32_t half_period = decoder->half_period;
+
+    for(size_t i = 0; i < count; i++) {
+        const LevelDuration level_duration = durations[i];
+        ManchesterEvent event = ManchesterEventReset;
+
+        if(!level_duration_is_reset(level_duration) && !level_duration_is_wait(level_duration)) {
+            const uint32_t duration = level_duration_get_duration(level_duration);
+            const bool level = level_duration_get_level(level_duration);
+            uint32_t measured = 0;
+
+            if(duration >= half_period / 2 && duration < half_period * 3 / 2) {
+                event = level ? ManchesterEventShortLow : ManchesterEventShortHigh;
+                measured = duration;
+            } else if(duration >= half_period * 3 / 2 && duration < half_period * 5 / 2) {
+                event = level ? ManchesterEventLongLow : ManchesterEventLongHigh;
+                measured = duration / 2;
+            }
+
+            if(decoder->recovery && measured) {
+                const int32_t error = (int32_t)(measured - half_period);
+                half_period += error / MANCHESTER_BLOCK_CLOCK_GAIN;
+            }
+        }
+
+        events[i] = event;
+    }
+
+    decoder->half_period = half_period;
+}
@@ -0,0 +1,116 @@
+/**
+ * @file manchester_block_decoder.h
+ * Block Manchester, differential Manchester and biphase decoder
+ *
+ * Decodes arrays of classified edge events at once instead of calling
+ * manchester_advance() for every edge. Two events are consumed per table lookup,
+ * decoded bits are appended to a BitBuffer, LSB first.
+ *
+ * Manchester coding gives exactly the same bits as manchester_advance().
+ *
+ * Edges can also be classified by the decoder with optional clock recovery,
+ * see manchester_block_decoder_set_clock().
+ */
+#pragma once
+#include "manchester_decoder.h"
+#include "level_duration.h"
+#include "bit_buffer.h"
+
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef enum {
+    ManchesterBlockCodingManchester, /**< Mid-bit level, same as manchester_advance() */
+    ManchesterBlockCodingDifferential, /**< Transition at bit start is 0, no transition is 1 */
+    ManchesterBlockCodingBiphase, /**< Biphase mark: transition at mid-bit is 1, none is 0 */
+} ManchesterBlockCoding;
+
+typedef struct ManchesterBlockDecoder ManchesterBlockDecoder;
+
+/**
+ * @brief Allocate decoder
+ *
+ * @param coding line coding
+ * @return ManchesterBlockDecoder* decoder instance
+ */
+ManchesterBlockDecoder* manchester_block_decoder_alloc(ManchesterBlockCoding coding);
+
+/**
+ * @brief Free decoder
+ *
+ * @param decoder decoder instance
+ */
+void manchester_block_decoder_free(ManchesterBlockDecoder* decoder);
+
+/**
+ * @brief Reset decoder state, same as feeding ManchesterEventReset
+ *
+ * @param decoder decoder instance
+ */
+void manchester_block_decoder_reset(ManchesterBlockDecoder* decoder);
+
+/**
+ * @brief Decode events
+ *
+ * Decoding stops early if there is no room for more bits in the buffer.
+ *
+ * @param decoder decoder instance
+ * @param events edge events
+ * @param count event count
+ * @param bits buffer to append decoded bits to
+ * @return size_t consumed event count
+ */
+size_t manchester_block_decoder_decode(
+    ManchesterBlockDecoder* decoder,
+    const ManchesterEvent* events,
+    size_t count,
+    BitBuffer* bits);
+
+/**
+ * @brief Set clock used by manchester_block_decoder_classify()
+ *
+ * Durations from half_period / 2 to 3 * half_period / 2 are short,
+ * up to 5 * half_period / 2 are long, anything else resets the decoder.
+ * With recovery enabled, every classified duration pulls the half period towards itself,
+ * so the decoder follows slow drift of the transmitter clock.
+ *
+ * @param decoder decoder instance
+ * @param half_period half bit period, in duration units
+ * @param recovery enable clock recovery
+ */
+void manchester_block_decoder_set_clock(
+    ManchesterBlockDecoder* decoder,
+    uint32_t half_period,
+    bool recovery);
+
+/**
+ * @brief Get current half bit period
+ *
+ * @param decoder decoder instance
+ * @return uint32_t half bit period, in duration units
+ */
+uint32_t manchester_block_decoder_get_clock(const ManchesterBlockDecoder* decoder);
+
+/**
+ * @brief Classify durations into edge events
+ *
+ * Event level is the level after the edge, so that high duration gives low event,
+ * same as in LF RFID decoders. Reset and wait durations give ManchesterEventReset.
+ *
+ * @param decoder decoder instance
+ * @param durations level durations
+ * @param count duration count
+ * @param events output events, count items
+ */
+void manchester_block_decoder_classify(
+    ManchesterBlockDecoder* decoder,
+    const LevelDuration* durations,
+    size_t count,
+    ManchesterEvent* events);
+
+#ifdef __cplusplus
+}
+#endif
@@ -11,6 +11,9 @@ typedef uint8_t* (*ProtocolGetData)(void* protocol);
 
 typedef void (*ProtocolDecoderStart)(void* protocol);
 typedef bool (*ProtocolDecoderFeed)(void* protocol, bool level, uint32_t duration);
+typedef bool (*ProtocolDecoderFeedSymbol)(void* protocol, const void* symbol);
+typedef size_t (
+    *ProtocolDecoderFeedBatch)(void* protocol, const LevelDuration* data, size_t count);
 
 typedef bool (*ProtocolEncoderStart)(void* protocol);
 typedef LevelDuration (*ProtocolEncoderYield)(void* protocol);
@@ -21,6 +24,11 @@ typedef bool (*ProtocolWriteData)(void* protocol, void* data);
 typedef struct {
     ProtocolDecoderStart start;
     ProtocolDecoderFeed feed;
+    /** Optional, takes edge pre-classified by protocol family front end instead of raw edge */
+    ProtocolDecoderFeedSymbol feed_symbol;
+    /** Optional, feeds edges until data is decoded.
+     * Returns index of the edge that completed decoding plus one, 0 if all edges were consumed */
+    ProtocolDecoderFeedBatch feed_batch;
 } ProtocolDecoder;
 
 typedef struct {
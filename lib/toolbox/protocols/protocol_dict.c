@@ -1,9 +1,17 @@
 #include <furi.h>
 #include "protocol_dict.h"
 
+typedef struct {
+    // edges after the last batch result already fed to decoder
+    size_t ahead;
+    // last of them completed decoding
+    bool decoded;
+} ProtocolDictBatchState;
+
 struct ProtocolDict {
     const ProtocolBase** base;
     size_t count;
+    ProtocolDictBatchState* batch;
     void* data[];
 };
 
@@ -13,6 +21,8 @@ ProtocolDict* protocol_dict_alloc(const ProtocolBase** protocols, size_t count)
     ProtocolDict* dict = malloc(sizeof(ProtocolDict) + (sizeof(void*) * count));
     dict->base = protocols;
     dict->count = count;
+    dict->batch = malloc(sizeof(ProtocolDictBatchState) * count);
+    memset(dict->batch, 0, sizeof(ProtocolDictBatchState) * count);
 
     for(size_t i = 0; i < dict->count; i++) {
         dict->data[i] = dict->base[i]->alloc();
@@ -28,6 +38,7 @@ void protocol_dict_free(ProtocolDict* dict) {
         dict->base[i]->free(dict->data[i]);
     }
 
+    free(dict->batch);
     free(dict);
 }
 
@@ -97,6 +108,8 @@ void protocol_dict_decoders_start(ProtocolDict* dict) {
             fn(dict->data[i]);
         }
     }
+
+    memset(dict->batch, 0, sizeof(ProtocolDictBatchState) * dict->count);
 }
 
 uint32_t protocol_dict_get_features(ProtocolDict* dict, size_t protocol_index) {
@@ -155,6 +168,147 @@ ProtocolId protocol_dict_decoders_feed_by_feature(
     return ready_protocol_id;
 }
 
+static bool protocol_dict_decoder_feed_symbol(
+    ProtocolDict* dict,
+    size_t protocol_index,
+    bool level,
+    uint32_t duration,
+    const void* symbol) {
+    const ProtocolDecoder* decoder = &dict->base[protocol_index]->decoder;
+
+    if(decoder->feed_symbol) {
+        return decoder->feed_symbol(dict->data[protocol_index], symbol);
+    } else if(decoder->feed) {
+        return decoder->feed(dict->data[protocol_index], level, duration);
+    } else {
+        return false;
+    }
+}
+
+ProtocolId protocol_dict_decoders_feed_symbol(
+    ProtocolDict* dict,
+    bool level,
+    uint32_t duration,
+    const void* symbol) {
+    furi_check(dict);
+
+    bool done = false;
+    ProtocolId ready_protocol_id = PROTOCOL_NO;
+
+    for(size_t i = 0; i < dict->count; i++) {
+        if(protocol_dict_decoder_feed_symbol(dict, i, level, duration, symbol)) {
+            if(!done) {
+                ready_protocol_id = i;
+                done = true;
+            }
+        }
+    }
+
+    return ready_protocol_id;
+}
+
+ProtocolId protocol_dict_decoders_feed_symbol_by_feature(
+    ProtocolDict* dict,
+    uint32_t feature,
+    bool level,
+    uint32_t duration,
+    const void* symbol) {
+    furi_check(dict);
+
+    bool done = false;
+    ProtocolId ready_protocol_id = PROTOCOL_NO;
+
+    for(size_t i = 0; i < dict->count; i++) {
+        uint32_t features = dict->base[i]->features;
+        if(features & feature) {
+            if(protocol_dict_decoder_feed_symbol(dict, i, level, duration, symbol)) {
+                if(!done) {
+                    ready_protocol_id = i;
+                    done = true;
+                }
+            }
+        }
+    }
+
+    return ready_protocol_id;
+}
+
+static size_t protocol_dict_decoder_feed_batch(
+    ProtocolDict* dict,
+    size_t protocol_index,
+    const LevelDuration* data,
+    size_t count) {
+    const ProtocolDecoder* decoder = &dict->base[protocol_index]->decoder;
+
+    if(decoder->feed_batch) {
+        return decoder->feed_batch(dict->data[protocol_index], data, count);
+    } else if(decoder->feed) {
+        for(size_t i = 0; i < count; i++) {
+            if(decoder->feed(
+                   dict->data[protocol_index],
+                   level_duration_get_level(data[i]),
+                   level_duration_get_duration(data[i]))) {
+                return i + 1;
+            }
+        }
+    }
+
+    return 0;
+}
+
+ProtocolId protocol_dict_decoders_feed_batch(
+    ProtocolDict* dict,
+    const LevelDuration* data,
+    size_t count,
+    size_t* consumed) {
+    furi_check(dict);
+    furi_check(data);
+    furi_check(consumed);
+
+    ProtocolId ready_protocol_id = PROTOCOL_NO;
+    size_t limit = count;
+
+    // protocol by protocol, every decoder runs over the edges until the earliest result so far
+    for(size_t i = 0; i < dict->count; i++) {
+        ProtocolDictBatchState* state = &dict->batch[i];
+        size_t fed = state->ahead;
+        bool decoded = fed > 0 && state->decoded;
+
+        if(!decoded && fed < limit) {
+            size_t result = protocol_dict_decoder_feed_batch(dict, i, &data[fed], limit - fed);
+            if(result > 0) {
+                fed += result;
+                decoded = true;
+            } else {
+                fed = limit;
+            }
+        }
+
+        // earlier edge wins, lower index wins on the same edge
+        if(decoded && (fed < limit || (fed == limit && ready_protocol_id == PROTOCOL_NO))) {
+            ready_protocol_id = i;
+            limit = fed;
+        }
+
+        state->ahead = fed;
+        state->decoded = decoded;
+    }
+
+    // decoders that went past the result must not get those edges again
+    for(size_t i = 0; i < dict->count; i++) {
+        ProtocolDictBatchState* state = &dict->batch[i];
+        if(state->ahead > limit) {
+            state->ahead -= limit;
+        } else {
+            state->ahead = 0;
+            state->decoded = false;
+        }
+    }
+
+    *consumed = limit;
+    return ready_protocol_id;
+}
+
 ProtocolId protocol_dict_decoders_feed_by_id(
     ProtocolDict* dict,
     size_t protocol_index,
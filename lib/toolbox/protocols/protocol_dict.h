@@ -48,6 +48,29 @@ ProtocolId protocol_dict_decoders_feed_by_feature(
     bool level,
     uint32_t duration);
 
+ProtocolId protocol_dict_decoders_feed_symbol(
+    ProtocolDict* dict,
+    bool level,
+    uint32_t duration,
+    const void* symbol);
+
+ProtocolId protocol_dict_decoders_feed_symbol_by_feature(
+    ProtocolDict* dict,
+    uint32_t feature,
+    bool level,
+    uint32_t duration,
+    const void* symbol);
+
+/** Feeds edges to all decoders, result is the same as feeding them one by one.
+ * Stops at the first decoded edge and returns its protocol, consumed is set to the count of
+ * edges up to and including it. Remaining edges should be passed to the next call.
+ * Don't mix with other feed functions until decoders are restarted. */
+ProtocolId protocol_dict_decoders_feed_batch(
+    ProtocolDict* dict,
+    const LevelDuration* data,
+    size_t count,
+    size_t* consumed);
+
 ProtocolId protocol_dict_decoders_feed_by_id(
     ProtocolDict* dict,
     size_t protocol_index,
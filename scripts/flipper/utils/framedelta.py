@@ -0,0 +1,117 @@
+# Must match lib/toolbox/frame_delta.c
+
+FRAME_DELTA_MAGIC = 0xFD
+FRAME_DELTA_HEADER_SIZE = 4
+
+FRAME_DELTA_TYPE_KEY = 0x00
+FRAME_DELTA_TYPE_DELTA = 0x01
+
+FRAME_DELTA_TOKEN_SKIP = 0x80
+FRAME_DELTA_TOKEN_RUN_MAX = 0x80
+FRAME_DELTA_SKIP_MIN = 3
+
+
+class FrameDeltaError(Exception):
+    pass
+
+
+def _skip_length(xored: bytes, index: int) -> int:
+    length = 0
+    while index + length < len(xored) and not xored[index + length]:
+        length += 1
+    return length
+
+
+def encode(frame: bytes, reference: bytes = None, sequence: int = 0) -> bytes:
+    """Encode frame against reference, key frame if reference is None"""
+    if reference is None:
+        xored = bytes(frame)
+        frame_type = FRAME_DELTA_TYPE_KEY
+    else:
+        if len(reference) != len(frame):
+            raise FrameDeltaError("Frame size mismatch")
+        xored = bytes(a ^ b for a, b in zip(frame, reference))
+        frame_type = FRAME_DELTA_TYPE_DELTA
+
+    output = bytearray(
+        (FRAME_DELTA_MAGIC, frame_type, sequence & 0xFF, (sequence >> 8) & 0xFF)
+    )
+
+    index = 0
+    while index < len(xored):
+        skip = _skip_length(xored, index)
+        if skip:
+            index += skip
+            if index == len(xored):
+                break
+            while skip:
+                run = min(skip, FRAME_DELTA_TOKEN_RUN_MAX)
+                output.append(FRAME_DELTA_TOKEN_SKIP | (run - 1))
+                skip -= run
+
+        control = len(output)
+        output.append(0)
+        run = 0
+        while index < len(xored) and run < FRAME_DELTA_TOKEN_RUN_MAX:
+            value = xored[index]
+            if not value and _skip_length(xored, index) >= min(
+                FRAME_DELTA_SKIP_MIN, len(xored) - index
+            ):
+                break
+            output.append(value)
+            index += 1
+            run += 1
+        output[control] = run - 1
+
+    return bytes(output)
+
+
+class FrameDeltaDecoder:
+    """Stateful decoder: keeps last frame, waits for key frame after errors"""
+
+    def __init__(self, frame_size: int):
+        self.frame = bytearray(frame_size)
+        self.sequence = None
+        self.synchronized = False
+
+    def decode(self, data: bytes) -> bytes:
+        if len(data) < FRAME_DELTA_HEADER_SIZE or data[0] != FRAME_DELTA_MAGIC:
+            raise FrameDeltaError("Invalid header")
+
+        frame_type = data[1]
+        sequence = data[2] | (data[3] << 8)
+
+        if frame_type == FRAME_DELTA_TYPE_KEY:
+            self.frame = bytearray(len(self.frame))
+        elif frame_type == FRAME_DELTA_TYPE_DELTA:
+            if not self.synchronized:
+                raise FrameDeltaError("Delta frame without key frame")
+            if sequence != (self.sequence + 1) & 0xFFFF:
+                self.synchronized = False
+                raise FrameDeltaError(f"Sequence gap: {self.sequence} -> {sequence}")
+        else:
+            raise FrameDeltaError(f"Unknown frame type {frame_type}")
+
+        position = FRAME_DELTA_HEADER_SIZE
+        index = 0
+        while position < len(data):
+            control = data[position]
+            position += 1
+            run = (control & ~FRAME_DELTA_TOKEN_SKIP) + 1
+            if index + run > len(self.frame):
+                self.synchronized = False
+                raise FrameDeltaError("Frame overflow")
+            if control & FRAME_DELTA_TOKEN_SKIP:
+                index += run
+            else:
+                if position + run > len(data):
+                    self.synchronized = False
+                    raise FrameDeltaError("Truncated literal run")
+                for i in range(run):
+                    self.frame[index + i] ^= data[position + i]
+                index += run
+                position += run
+
+        self.sequence = sequence
+        self.synchronized = True
+        return bytes(self.frame)
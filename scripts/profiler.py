@@ -0,0 +1,200 @@
+#!/usr/bin/env python3
+
+import struct
+import time
+from collections import defaultdict
+
+from flipper.app import App
+from flipper.storage import FlipperStorage
+from flipper.utils.cdc import resolve_port
+
+# Must match applications/services/cli/cli_command_profiler.c
+PROFILER_MAGIC = 0x5054
+PROFILER_FORMAT_VERSION = 1
+PROFILER_THREAD_NAME_SIZE = 16
+
+FRAME_SIZE = struct.Struct("<H")
+FRAME_HEADER = struct.Struct("<HBBIIIII")
+FRAME_THREAD = struct.Struct(
+    f"<IIIHHB{PROFILER_THREAD_NAME_SIZE}s{PROFILER_THREAD_NAME_SIZE}s"
+)
+
+
+class ProfilerFrame:
+    def __init__(self, data: bytes):
+        (
+            magic,
+            version,
+            thread_count,
+            self.tick,
+            self.cycles,
+            self.isr_cycles,
+            self.window_cycles,
+            self.heap_free,
+        ) = FRAME_HEADER.unpack_from(data)
+
+        if magic != PROFILER_MAGIC or version != PROFILER_FORMAT_VERSION:
+            raise ValueError(f"Unsupported frame: magic {magic:#x}, version {version}")
+
+        self.threads = []
+        offset = FRAME_HEADER.size
+        for _ in range(thread_count):
+            (
+                thread_id,
+                cycles,
+                window_cycles,
+                context_switches,
+                stack_min_free,
+                priority,
+                app_id,
+                name,
+            ) = FRAME_THREAD.unpack_from(data, offset)
+            offset += FRAME_THREAD.size
+            self.threads.append(
+                {
+                    "id": thread_id,
+                    "cycles": cycles,
+                    "window_cycles": window_cycles,
+                    "context_switches": context_switches,
+                    "stack_min_free": stack_min_free,
+                    "priority": priority,
+                    "app_id": app_id.split(b"\0", 1)[0].decode("ascii", "replace"),
+                    "name": name.split(b"\0", 1)[0].decode("ascii", "replace"),
+                }
+            )
+
+
+class ProfilerSummary:
+    def __init__(self):
+        self.frames = 0
+        self.cycles = 0
+        self.isr_cycles = 0
+        self.thread_cycles = defaultdict(int)
+        self.thread_switches = defaultdict(int)
+        self.thread_stack_min = {}
+
+    def add(self, frame: ProfilerFrame):
+        self.frames += 1
+        self.cycles += frame.cycles
+        self.isr_cycles += frame.isr_cycles
+        for thread in frame.threads:
+            key = (thread["app_id"] or "?", thread["name"] or "?")
+            self.thread_cycles[key] += thread["cycles"]
+            self.thread_switches[key] += thread["context_switches"]
+            self.thread_stack_min[key] = min(
+                self.thread_stack_min.get(key, thread["stack_min_free"]),
+                thread["stack_min_free"],
+            )
+
+    def folded(self):
+        """Flame graph friendly folded stacks: app;thread cycles"""
+        lines = [f"ISR {self.isr_cycles}"]
+        for (app_id, name), cycles in sorted(self.thread_cycles.items()):
+            lines.append(f"{app_id};{name} {cycles}")
+        return "\n".join(lines)
+
+    def table(self):
+        total = max(self.cycles, 1)
+        lines = [
+            f"Frames: {self.frames}, ISR: {self.isr_cycles * 100 / total:.2f}%",
+            f"{'AppID':<17} {'Name':<17} {'CPU':>6} {'Switches':>9} {'Stack Min':>10}",
+        ]
+        for key, cycles in sorted(
+            self.thread_cycles.items(), key=lambda item: item[1], reverse=True
+        ):
+            lines.append(
+                f"{key[0]:<17} {key[1]:<17} {cycles * 100 / total:>5.1f}% "
+                f"{self.thread_switches[key]:>9} {self.thread_stack_min[key]:>10}"
+            )
+        return "\n".join(lines)
+
+
+def read_frames(stream):
+    """Yield frames from file-like object with read(size) method"""
+    while True:
+        size_data = stream.read(FRAME_SIZE.size)
+        if len(size_data) < FRAME_SIZE.size:
+            return
+        (size,) = FRAME_SIZE.unpack(size_data)
+        data = stream.read(size)
+        if len(data) < size:
+            return
+        yield ProfilerFrame(data)
+
+
+def read_exactly(flipper: FlipperStorage, size: int) -> bytes:
+    """Read binary data, starting with whatever is left in line buffer"""
+    data = flipper.read.buffer[:size]
+    flipper.read.buffer = flipper.read.buffer[size:]
+    while len(data) < size:
+        chunk = flipper.port.read(size - len(data))
+        if not chunk:
+            raise TimeoutError("Profiler stream stalled")
+        data.extend(chunk)
+    return bytes(data)
+
+
+class Main(App):
+    def init(self):
+        self.parser.add_argument("-p", "--port", help="CDC Port", default="auto")
+        self.subparsers = self.parser.add_subparsers(help="sub-command help")
+
+        self.parser_capture = self.subparsers.add_parser(
+            "capture", help="Capture profiler stream from device"
+        )
+        self.parser_capture.add_argument(
+            "-i", "--interval", type=int, default=250, help="Sampling interval, ms"
+        )
+        self.parser_capture.add_argument(
+            "-t", "--time", type=float, default=10, help="Capture duration, s"
+        )
+        self.parser_capture.add_argument("output", help="Raw capture file")
+        self.parser_capture.set_defaults(func=self.capture)
+
+        self.parser_decode = self.subparsers.add_parser(
+            "decode", help="Decode raw capture file"
+        )
+        self.parser_decode.add_argument(
+            "-f", "--folded", action="store_true", help="Output folded stacks"
+        )
+        self.parser_decode.add_argument("input", help="Raw capture file")
+        self.parser_decode.set_defaults(func=self.decode)
+
+    def capture(self):
+        if not (port := resolve_port(self.logger, self.args.port)):
+            return 1
+
+        with FlipperStorage(port) as flipper, open(self.args.output, "wb") as output:
+            flipper.send_and_wait_eol(f"profiler {self.args.interval}\r")
+            # Skip banner
+            flipper.read.until(flipper.CLI_EOL)
+
+            self.logger.info(f"Capturing for {self.args.time}s")
+            deadline = time.monotonic() + self.args.time
+            while time.monotonic() < deadline:
+                (size,) = FRAME_SIZE.unpack(read_exactly(flipper, FRAME_SIZE.size))
+                data = read_exactly(flipper, size)
+                output.write(FRAME_SIZE.pack(size))
+                output.write(data)
+
+            flipper.send("\x03")
+            flipper.read.until(flipper.CLI_PROMPT)
+
+        return 0
+
+    def decode(self):
+        summary = ProfilerSummary()
+        with open(self.args.input, "rb") as stream:
+            for frame in read_frames(stream):
+                summary.add(frame)
+
+        if self.args.folded:
+            print(summary.folded())
+        else:
+            print(summary.table())
+
+        return 0
+
+
+if __name__ == "__main__":
+    Main()()
@@ -107,14 +107,26 @@ void ble_profile_serial_set_rpc_active(FuriHalBleProfileBase* profile, bool acti
     ble_svc_serial_set_rpc_active(serial_profile->serial_svc, active);
 }
 
+SerialServiceTxMode ble_profile_serial_get_tx_mode(FuriHalBleProfileBase* profile) {
+    furi_check(profile && (profile->config == ble_profile_serial));
+
+    BleProfileSerial* serial_profile = (BleProfileSerial*)profile;
+    return ble_svc_serial_get_tx_mode(serial_profile->serial_svc);
+}
+
 bool ble_profile_serial_tx(FuriHalBleProfileBase* profile, uint8_t* data, uint16_t size) {
+    return ble_profile_serial_tx_ex(profile, data, size) == SerialServiceTxStatusOk;
+}
+
+SerialServiceTxStatus
+    ble_profile_serial_tx_ex(FuriHalBleProfileBase* profile, uint8_t* data, uint16_t size) {
     furi_check(profile && (profile->config == ble_profile_serial));
 
     BleProfileSerial* serial_profile = (BleProfileSerial*)profile;
 
     if(size > BLE_PROFILE_SERIAL_PACKET_SIZE_MAX) {
-        return false;
+        return SerialServiceTxStatusError;
     }
 
-    return ble_svc_serial_update_tx(serial_profile->serial_svc, data, size);
+    return ble_svc_serial_update_tx_ex(serial_profile->serial_svc, data, size);
 }
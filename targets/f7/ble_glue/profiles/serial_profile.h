@@ -31,6 +31,17 @@ extern const FuriHalBleProfileTemplate* ble_profile_serial;
  */
 bool ble_profile_serial_tx(FuriHalBleProfileBase* profile, uint8_t* data, uint16_t size);
 
+/** Send data through BLE, telling a full TX buffer pool apart from errors
+ *
+ * @param profile       Profile instance
+ * @param data          data buffer
+ * @param size          data buffer size
+ *
+ * @return      SerialServiceTxStatus
+ */
+SerialServiceTxStatus
+    ble_profile_serial_tx_ex(FuriHalBleProfileBase* profile, uint8_t* data, uint16_t size);
+
 /** Set BLE RPC status
  *
  * @param profile       Profile instance
@@ -43,6 +54,18 @@ void ble_profile_serial_set_rpc_active(FuriHalBleProfileBase* profile, bool acti
  */
 void ble_profile_serial_notify_buffer_is_empty(FuriHalBleProfileBase* profile);
 
+/** Get TX mode selected by client subscription
+ *
+ * With notifications data can be sent without waiting for the previous packet to be delivered,
+ * until ble_profile_serial_tx_ex() returns SerialServiceTxStatusBusy.
+ * SerialServiceEventTypeDataSent follows then, once there is room for more.
+ *
+ * @param profile       Profile instance
+ *
+ * @return      SerialServiceTxMode
+ */
+SerialServiceTxMode ble_profile_serial_get_tx_mode(FuriHalBleProfileBase* profile);
+
 /** Set Serial service events callback
  *
  * @param profile       Profile instance
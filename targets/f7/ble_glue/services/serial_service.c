@@ -11,6 +11,11 @@
 
 #define TAG "BtSerialSvc"
 
+#define BLE_SVC_SERIAL_CCCD_NOTIFICATION (0x0001)
+
+/* Credit mode: credit is updated once this part of the buffer is freed */
+#define BLE_SVC_SERIAL_CREDIT_UPDATE_DIV (4)
+
 typedef enum {
     SerialSvcGattCharacteristicRx = 0,
     SerialSvcGattCharacteristicTx,
@@ -36,7 +41,7 @@ static const BleGattCharacteristicParams ble_svc_serial_chars[SerialSvcGattChara
          .data.fixed.length = BLE_SVC_SERIAL_DATA_LEN_MAX,
          .uuid.Char_UUID_128 = BLE_SVC_SERIAL_TX_CHAR_UUID,
          .uuid_type = UUID_TYPE_128,
-         .char_properties = CHAR_PROP_READ | CHAR_PROP_INDICATE,
+         .char_properties = CHAR_PROP_READ | CHAR_PROP_INDICATE | CHAR_PROP_NOTIFY,
          .security_permissions = ATTR_PERMISSION_AUTHEN_READ,
          .gatt_evt_mask = GATT_DONT_NOTIFY_EVENTS,
          .is_variable = CHAR_VALUE_LEN_VARIABLE},
@@ -46,9 +51,9 @@ static const BleGattCharacteristicParams ble_svc_serial_chars[SerialSvcGattChara
          .data.fixed.length = sizeof(uint32_t),
          .uuid.Char_UUID_128 = BLE_SVC_SERIAL_FLOW_CONTROL_UUID,
          .uuid_type = UUID_TYPE_128,
-         .char_properties = CHAR_PROP_READ | CHAR_PROP_NOTIFY,
-         .security_permissions = ATTR_PERMISSION_AUTHEN_READ,
-         .gatt_evt_mask = GATT_DONT_NOTIFY_EVENTS,
+         .char_properties = CHAR_PROP_READ | CHAR_PROP_WRITE | CHAR_PROP_NOTIFY,
+         .security_permissions = ATTR_PERMISSION_AUTHEN_READ | ATTR_PERMISSION_AUTHEN_WRITE,
+         .gatt_evt_mask = GATT_NOTIFY_ATTRIBUTE_WRITE,
          .is_variable = CHAR_VALUE_LEN_CONSTANT},
     [SerialSvcGattCharacteristicStatus] = {
         .name = "RPC status",
@@ -67,18 +72,53 @@ struct BleServiceSerial {
     FuriMutex* buff_size_mtx;
     uint32_t buff_size;
     uint16_t bytes_ready_to_receive;
+    bool is_credit_mode;
+    uint32_t credit_total;
+    SerialServiceTxMode tx_mode;
     SerialServiceEventCallback callback;
     void* context;
     GapSvcEventHandler* event_handler;
 };
 
+static void ble_svc_serial_update_flow_ctrl_char(BleServiceSerial* serial_svc, uint32_t value) {
+    uint32_t value_reversed = REVERSE_BYTES_U32(value);
+    ble_gatt_characteristic_update(
+        serial_svc->svc_handle,
+        &serial_svc->chars[SerialSvcGattCharacteristicFlowCtrl],
+        &value_reversed);
+}
+
+/* Credit mode: let the client fill all free buffer space, once at least min_credit bytes
+ * can be added to what it is already allowed to send. Called with buff_size_mtx acquired */
+static void ble_svc_serial_grant_credit(
+    BleServiceSerial* serial_svc,
+    uint32_t buff_free_size,
+    uint32_t min_credit) {
+    buff_free_size = MIN(buff_free_size, serial_svc->buff_size);
+    if(buff_free_size < serial_svc->bytes_ready_to_receive + MAX(min_credit, 1U)) {
+        return;
+    }
+
+    serial_svc->credit_total += buff_free_size - serial_svc->bytes_ready_to_receive;
+    serial_svc->bytes_ready_to_receive = buff_free_size;
+    FURI_LOG_D(TAG, "Credit total: %ld", serial_svc->credit_total);
+
+    ble_svc_serial_update_flow_ctrl_char(serial_svc, serial_svc->credit_total);
+}
+
 static BleEventAckStatus ble_svc_serial_event_handler(void* event, void* context) {
     BleServiceSerial* serial_svc = (BleServiceSerial*)context;
     BleEventAckStatus ret = BleEventNotAck;
     hci_event_pckt* event_pckt = (hci_event_pckt*)(((hci_uart_pckt*)event)->data);
     evt_blecore_aci* blecore_evt = (evt_blecore_aci*)event_pckt->data;
     aci_gatt_attribute_modified_event_rp0* attribute_modified;
-    if(event_pckt->evt == HCI_VENDOR_SPECIFIC_DEBUG_EVT_CODE) {
+    if(event_pckt->evt == HCI_DISCONNECTION_COMPLETE_EVT_CODE) {
+        // Subscription and flow control mode belong to the connection, GAP handles the rest
+        furi_check(furi_mutex_acquire(serial_svc->buff_size_mtx, FuriWaitForever) == FuriStatusOk);
+        serial_svc->tx_mode = SerialServiceTxModeIndication;
+        serial_svc->is_credit_mode = false;
+        furi_check(furi_mutex_release(serial_svc->buff_size_mtx) == FuriStatusOk);
+    } else if(event_pckt->evt == HCI_VENDOR_SPECIFIC_DEBUG_EVT_CODE) {
         if(blecore_evt->ecode == ACI_GATT_ATTRIBUTE_MODIFIED_VSEVT_CODE) {
             attribute_modified = (aci_gatt_attribute_modified_event_rp0*)blecore_evt->data;
             if(attribute_modified->Attr_Handle ==
@@ -86,6 +126,38 @@ static BleEventAckStatus ble_svc_serial_event_handler(void* event, void* context
                 // Descriptor handle
                 ret = BleEventAckFlowEnable;
                 FURI_LOG_D(TAG, "RX descriptor event");
+            } else if(
+                attribute_modified->Attr_Handle ==
+                serial_svc->chars[SerialSvcGattCharacteristicTx].handle + 2) {
+                uint16_t cccd = 0;
+                memcpy(
+                    &cccd,
+                    attribute_modified->Attr_Data,
+                    MIN(attribute_modified->Attr_Data_Length, sizeof(cccd)));
+                serial_svc->tx_mode = (cccd == BLE_SVC_SERIAL_CCCD_NOTIFICATION) ?
+                                          SerialServiceTxModeNotification :
+                                          SerialServiceTxModeIndication;
+                FURI_LOG_D(TAG, "TX descriptor event, mode %d", serial_svc->tx_mode);
+                ret = BleEventAckFlowEnable;
+            } else if(
+                attribute_modified->Attr_Handle ==
+                serial_svc->chars[SerialSvcGattCharacteristicFlowCtrl].handle + 1) {
+                uint32_t mode_reversed = 0;
+                memcpy(
+                    &mode_reversed,
+                    attribute_modified->Attr_Data,
+                    MIN(attribute_modified->Attr_Data_Length, sizeof(mode_reversed)));
+                furi_check(
+                    furi_mutex_acquire(serial_svc->buff_size_mtx, FuriWaitForever) ==
+                    FuriStatusOk);
+                serial_svc->is_credit_mode = REVERSE_BYTES_U32(mode_reversed) ==
+                                             BLE_SVC_SERIAL_FLOW_CONTROL_MODE_CREDIT;
+                // Credit total starts from what client is allowed to send now
+                serial_svc->credit_total = serial_svc->bytes_ready_to_receive;
+                ble_svc_serial_update_flow_ctrl_char(serial_svc, serial_svc->credit_total);
+                furi_check(furi_mutex_release(serial_svc->buff_size_mtx) == FuriStatusOk);
+                FURI_LOG_D(TAG, "Credit mode: %d", serial_svc->is_credit_mode);
+                ret = BleEventAckFlowEnable;
             } else if(
                 attribute_modified->Attr_Handle ==
                 serial_svc->chars[SerialSvcGattCharacteristicRx].handle + 1) {
@@ -111,6 +183,12 @@ static BleEventAckStatus ble_svc_serial_event_handler(void* event, void* context
                         }};
                     uint32_t buff_free_size = serial_svc->callback(event, serial_svc->context);
                     FURI_LOG_D(TAG, "Available buff size: %ld", buff_free_size);
+                    if(serial_svc->is_credit_mode) {
+                        ble_svc_serial_grant_credit(
+                            serial_svc,
+                            buff_free_size,
+                            serial_svc->buff_size / BLE_SVC_SERIAL_CREDIT_UPDATE_DIV);
+                    }
                     furi_check(furi_mutex_release(serial_svc->buff_size_mtx) == FuriStatusOk);
                 }
                 ret = BleEventAckFlowEnable;
@@ -136,6 +214,18 @@ static BleEventAckStatus ble_svc_serial_event_handler(void* event, void* context
                 serial_svc->callback(event, serial_svc->context);
             }
             ret = BleEventAckFlowEnable;
+        } else if(
+            blecore_evt->ecode == ACI_GATT_TX_POOL_AVAILABLE_VSEVT_CODE &&
+            serial_svc->tx_mode == SerialServiceTxModeNotification) {
+            // Notifications are not confirmed, more can be sent once the stack has buffers
+            FURI_LOG_T(TAG, "TX pool available");
+            if(serial_svc->callback) {
+                SerialServiceEvent event = {
+                    .event = SerialServiceEventTypeDataSent,
+                };
+                serial_svc->callback(event, serial_svc->context);
+            }
+            ret = BleEventAckFlowEnable;
         }
     }
     return ret;
@@ -184,12 +274,9 @@ void ble_svc_serial_set_callbacks(
     serial_svc->context = context;
     serial_svc->buff_size = buff_size;
     serial_svc->bytes_ready_to_receive = buff_size;
+    serial_svc->is_credit_mode = false;
 
-    uint32_t buff_size_reversed = REVERSE_BYTES_U32(serial_svc->buff_size);
-    ble_gatt_characteristic_update(
-        serial_svc->svc_handle,
-        &serial_svc->chars[SerialSvcGattCharacteristicFlowCtrl],
-        &buff_size_reversed);
+    ble_svc_serial_update_flow_ctrl_char(serial_svc, serial_svc->buff_size);
 }
 
 void ble_svc_serial_notify_buffer_is_empty(BleServiceSerial* serial_svc) {
@@ -197,15 +284,20 @@ void ble_svc_serial_notify_buffer_is_empty(BleServiceSerial* serial_svc) {
     furi_check(serial_svc->buff_size_mtx);
 
     furi_check(furi_mutex_acquire(serial_svc->buff_size_mtx, FuriWaitForever) == FuriStatusOk);
-    if(serial_svc->bytes_ready_to_receive == 0) {
+    if(serial_svc->is_credit_mode) {
+        // Data may have arrived since the buffer was found empty, ask for actual free size
+        if(serial_svc->callback) {
+            SerialServiceEvent event = {
+                .event = SerialServiceEventTypeFreeSizeRequest,
+            };
+            uint32_t buff_free_size = serial_svc->callback(event, serial_svc->context);
+            ble_svc_serial_grant_credit(serial_svc, buff_free_size, 1);
+        }
+    } else if(serial_svc->bytes_ready_to_receive == 0) {
         FURI_LOG_D(TAG, "Buffer is empty. Notifying client");
         serial_svc->bytes_ready_to_receive = serial_svc->buff_size;
 
-        uint32_t buff_size_reversed = REVERSE_BYTES_U32(serial_svc->buff_size);
-        ble_gatt_characteristic_update(
-            serial_svc->svc_handle,
-            &serial_svc->chars[SerialSvcGattCharacteristicFlowCtrl],
-            &buff_size_reversed);
+        ble_svc_serial_update_flow_ctrl_char(serial_svc, serial_svc->buff_size);
     }
     furi_check(furi_mutex_release(serial_svc->buff_size_mtx) == FuriStatusOk);
 }
@@ -223,11 +315,16 @@ void ble_svc_serial_stop(BleServiceSerial* serial_svc) {
     free(serial_svc);
 }
 
-bool ble_svc_serial_update_tx(BleServiceSerial* serial_svc, uint8_t* data, uint16_t data_len) {
+SerialServiceTxStatus
+    ble_svc_serial_update_tx_ex(BleServiceSerial* serial_svc, uint8_t* data, uint16_t data_len) {
     if(data_len > BLE_SVC_SERIAL_DATA_LEN_MAX) {
-        return false;
+        return SerialServiceTxStatusError;
     }
 
+    // Value is sent with its last part
+    const uint8_t update_type = (serial_svc->tx_mode == SerialServiceTxModeNotification) ? 0x01 :
+                                                                                           0x02;
+
     for(uint16_t remained = data_len; remained > 0;) {
         uint8_t value_len = MIN(BLE_SVC_SERIAL_CHAR_VALUE_LEN_MAX, remained);
         uint16_t value_offset = data_len - remained;
@@ -237,19 +334,27 @@ bool ble_svc_serial_update_tx(BleServiceSerial* serial_svc, uint8_t* data, uint1
             0,
             serial_svc->svc_handle,
             serial_svc->chars[SerialSvcGattCharacteristicTx].handle,
-            remained ? 0x00 : 0x02,
+            remained ? 0x00 : update_type,
             data_len,
             value_offset,
             value_len,
             data + value_offset);
 
-        if(result) {
+        if(result == BLE_STATUS_INSUFFICIENT_RESOURCES) {
+            // No free buffers for notification, DataSent event follows when there are
+            FURI_LOG_T(TAG, "TX pool is full");
+            return SerialServiceTxStatusBusy;
+        } else if(result) {
             FURI_LOG_E(TAG, "Failed updating TX characteristic: %d", result);
-            return false;
+            return SerialServiceTxStatusError;
         }
     }
 
-    return true;
+    return SerialServiceTxStatusOk;
+}
+
+bool ble_svc_serial_update_tx(BleServiceSerial* serial_svc, uint8_t* data, uint16_t data_len) {
+    return ble_svc_serial_update_tx_ex(serial_svc, data, data_len) == SerialServiceTxStatusOk;
 }
 
 void ble_svc_serial_set_rpc_active(BleServiceSerial* serial_svc, bool active) {
@@ -257,3 +362,8 @@ void ble_svc_serial_set_rpc_active(BleServiceSerial* serial_svc, bool active) {
     ble_svc_serial_update_rpc_char(
         serial_svc, active ? SerialServiceRpcStatusActive : SerialServiceRpcStatusNotActive);
 }
+
+SerialServiceTxMode ble_svc_serial_get_tx_mode(BleServiceSerial* serial_svc) {
+    furi_check(serial_svc);
+    return serial_svc->tx_mode;
+}
@@ -9,17 +9,41 @@ extern "C" {
 
 /* 
  * Serial service. Implements RPC over BLE, with flow control.
+ *
+ * TX follows client subscription: with indications every packet waits for confirmation,
+ * with notifications packets are sent back to back while the stack has free buffers.
+ *
+ * Flow control characteristic holds the number of bytes client can send, refilled to the whole
+ * buffer size once application buffer is empty. Before sending any data client can switch it
+ * to credit mode by writing BLE_SVC_SERIAL_FLOW_CONTROL_MODE_CREDIT to it. Then it holds the
+ * running total of bytes client is allowed to send since the switch, which grows as soon as
+ * enough buffer space is freed, so client doesn't have to wait for the buffer to drain.
  */
 
 #define BLE_SVC_SERIAL_DATA_LEN_MAX       (486)
 #define BLE_SVC_SERIAL_CHAR_VALUE_LEN_MAX (243)
 
+#define BLE_SVC_SERIAL_FLOW_CONTROL_MODE_LEGACY (0UL)
+#define BLE_SVC_SERIAL_FLOW_CONTROL_MODE_CREDIT (1UL)
+
 typedef enum {
     SerialServiceEventTypeDataReceived,
     SerialServiceEventTypeDataSent,
     SerialServiceEventTypesBleResetRequest,
+    SerialServiceEventTypeFreeSizeRequest, /**< Credit mode, return free application buffer size */
 } SerialServiceEventType;
 
+typedef enum {
+    SerialServiceTxModeIndication,
+    SerialServiceTxModeNotification,
+} SerialServiceTxMode;
+
+typedef enum {
+    SerialServiceTxStatusOk,
+    SerialServiceTxStatusBusy, /**< Stack is out of TX buffers, DataSent event follows */
+    SerialServiceTxStatusError, /**< Data was not sent and retrying won't help */
+} SerialServiceTxStatus;
+
 typedef struct {
     uint8_t* buffer;
     uint16_t size;
@@ -50,6 +74,11 @@ void ble_svc_serial_notify_buffer_is_empty(BleServiceSerial* service);
 
 bool ble_svc_serial_update_tx(BleServiceSerial* service, uint8_t* data, uint16_t data_len);
 
+SerialServiceTxStatus
+    ble_svc_serial_update_tx_ex(BleServiceSerial* service, uint8_t* data, uint16_t data_len);
+
+SerialServiceTxMode ble_svc_serial_get_tx_mode(BleServiceSerial* service);
+
 #ifdef __cplusplus
 }
 #endif
@@ -46,6 +46,7 @@ void furi_hal_init(void) {
     furi_hal_ibutton_init();
     furi_hal_speaker_init();
     furi_hal_crypto_init();
+    furi_hal_crc_init();
     furi_hal_i2c_init();
     furi_hal_power_init();
     furi_hal_light_init();
@@ -0,0 +1,66 @@
+#include <furi_hal_crc.h>
+#include <furi_hal_bus.h>
+#include <furi.h>
+
+#include <stm32wbxx_ll_crc.h>
+
+#include <string.h>
+
+#define TAG "FuriHalCrc"
+
+static FuriMutex* furi_hal_crc_mutex = NULL;
+
+void furi_hal_crc_init(void) {
+    furi_hal_crc_mutex = furi_mutex_alloc(FuriMutexTypeNormal);
+    FURI_LOG_I(TAG, "Init OK");
+}
+
+bool furi_hal_crc_acquire(uint32_t timeout) {
+    if(!furi_hal_crc_mutex || FURI_IS_IRQ_MODE()) {
+        return false;
+    }
+
+    if(furi_mutex_acquire(furi_hal_crc_mutex, timeout) != FuriStatusOk) {
+        return false;
+    }
+
+    // Bus is owned by furi_hal_bt, it is disabled while the radio stack restarts
+    if(!furi_hal_bus_is_enabled(FuriHalBusCRC)) {
+        furi_check(furi_mutex_release(furi_hal_crc_mutex) == FuriStatusOk);
+        return false;
+    }
+
+    return true;
+}
+
+void furi_hal_crc_release(void) {
+    furi_check(furi_hal_crc_mutex);
+    furi_check(furi_mutex_release(furi_hal_crc_mutex) == FuriStatusOk);
+}
+
+uint32_t furi_hal_crc_crc32(uint32_t crc, const uint8_t* data, size_t size) {
+    furi_check(data || size == 0);
+
+    // Unit shifts MSB first: reflect input per byte and output per word,
+    // register is loaded in the unit bit order. Configuration is lost on bus reset,
+    // so it is applied every time.
+    LL_CRC_SetPolynomialSize(CRC, LL_CRC_POLYLENGTH_32B);
+    LL_CRC_SetPolynomialCoef(CRC, LL_CRC_DEFAULT_CRC32_POLY);
+    LL_CRC_SetInputDataReverseMode(CRC, LL_CRC_INDATA_REVERSE_BYTE);
+    LL_CRC_SetOutputDataReverseMode(CRC, LL_CRC_OUTDATA_REVERSE_BIT);
+    LL_CRC_SetInitialData(CRC, __RBIT(crc));
+    LL_CRC_ResetCRCCalculationUnit(CRC);
+
+    // Word is shifted in starting from the most significant byte
+    for(; size >= sizeof(uint32_t); size -= sizeof(uint32_t), data += sizeof(uint32_t)) {
+        uint32_t word;
+        memcpy(&word, data, sizeof(uint32_t));
+        LL_CRC_FeedData32(CRC, __REV(word));
+    }
+
+    for(; size > 0; size--, data++) {
+        LL_CRC_FeedData8(CRC, *data);
+    }
+
+    return LL_CRC_ReadData32(CRC);
+}
@@ -135,9 +135,11 @@ standard names. */
 #define vPortSVCHandler    SVC_Handler
 #define xPortPendSVHandler PendSV_Handler
 
+// `uxTaskNumber' is reserved for trace code, we use it as per-thread context switch counter
 #define traceTASK_SWITCHED_IN()                                          \
     extern void furi_hal_mpu_set_stack_protection(uint32_t* stack);      \
     furi_hal_mpu_set_stack_protection((uint32_t*)pxCurrentTCB->pxStack); \
+    pxCurrentTCB->uxTaskNumber++;                                        \
     errno = pxCurrentTCB->iTaskErrno
 //  ^^^^^   acquire errno directly from TCB because FreeRTOS assigns its `FreeRTOS_errno' _after_ our hook is called
 
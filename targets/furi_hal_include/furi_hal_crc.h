@@ -0,0 +1,54 @@
+/**
+ * @file furi_hal_crc.h
+ *
+ * CRC calculation unit HAL API
+ *
+ * CRC unit is clocked together with the radio stack (see furi_hal_bt), so it
+ * may be unavailable for a short time while the stack is restarted. Callers
+ * must always be ready to fall back to software implementation, the toolbox
+ * crc library does that transparently.
+ */
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Initialize CRC HAL */
+void furi_hal_crc_init(void);
+
+/** Acquire exclusive access to the CRC unit
+ *
+ * Fails in interrupt context, before furi_hal_crc_init and while the CRC unit
+ * is not clocked.
+ *
+ * @param      timeout  timeout in ticks
+ *
+ * @return     true if the unit is acquired, release it with furi_hal_crc_release
+ */
+bool furi_hal_crc_acquire(uint32_t timeout);
+
+/** Release the CRC unit */
+void furi_hal_crc_release(void);
+
+/** Update CRC-32 (IEEE 802.3, reflected) register with the CRC unit
+ *
+ * Register is taken and returned as is, without initial value and final
+ * inversion, same as crc_update from toolbox crc library.
+ * The CRC unit must be acquired.
+ *
+ * @param      crc   current CRC register value
+ * @param      data  pointer to the data
+ * @param      size  data size in bytes
+ *
+ * @return     updated CRC register value
+ */
+uint32_t furi_hal_crc_crc32(uint32_t crc, const uint8_t* data, size_t size);
+
+#ifdef __cplusplus
+}
+#endif